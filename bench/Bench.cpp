@@ -0,0 +1,238 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <new>
+#include <exception>
+#include <cstdlib>
+#include <cstring>
+
+#include <Math/Simd.hpp>
+
+#include <Bench.hpp>
+
+// MARK: Allocations
+static std::atomic<uint64_t> allocationCount { 0 };
+static std::atomic<uint64_t> allocatedBytes { 0 };
+
+uint64_t Bench::AllocationCount() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t Bench::AllocatedBytes() {
+	return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+void* Bench::Allocate(size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	return std::malloc(size);
+}
+
+void* Bench::Reallocate(void* pointer, size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	return std::realloc(pointer, size);
+}
+
+void Bench::Free(void* pointer) {
+	std::free(pointer);
+}
+
+// The array, nothrow and sized forms of the standard library call these ones.
+// Over-aligned allocations are not counted.
+void* operator new(size_t size) {
+	void* pointer = Bench::Allocate(size == 0 ? 1 : size);
+	if (pointer == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+	Bench::Free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	Bench::Free(pointer);
+}
+
+// MARK: Runner
+static std::vector<std::pair<char const*, Bench::GroupFunction>>& Groups() {
+	static std::vector<std::pair<char const*, Bench::GroupFunction>> groups {};
+	return groups;
+}
+
+Bench::Group::Group(char const* name, GroupFunction function) {
+	Groups().emplace_back(name, function);
+}
+
+bool Bench::Runner::Selected(std::string const& name) const {
+	return (_group + "/" + name).find(_filter) != std::string::npos;
+}
+
+void Bench::Runner::Speedup(std::string const& name, double baseline, double candidate) {
+	if (baseline > 0.0 && candidate > 0.0) {
+		_speedups.emplace_back(name, baseline / candidate);
+	}
+}
+
+void Bench::Runner::Record(std::string const& name, uint64_t iterations, double seconds, uint64_t allocations, uint64_t allocatedBytes, size_t bytesPerOperation) {
+	Result result {};
+	result.group = _group;
+	result.name = name;
+	result.iterations = iterations;
+	result.nanosecondsPerOperation = 1.0e9 * seconds / static_cast<double>(iterations);
+	result.bytesPerSecond = bytesPerOperation != 0 && seconds > 0.0 ? static_cast<double>(bytesPerOperation) * static_cast<double>(iterations) / seconds : 0.0;
+	result.allocationsPerOperation = static_cast<double>(allocations) / static_cast<double>(iterations);
+	result.allocatedBytesPerOperation = static_cast<double>(allocatedBytes) / static_cast<double>(iterations);
+
+	std::ostringstream throughput {};
+	if (result.bytesPerSecond != 0.0) {
+		throughput << std::fixed << std::setprecision(1) << result.bytesPerSecond / (1024.0 * 1024.0) << " MiB/s";
+	}
+
+	if (_results.empty() || _results.back().group != _group) {
+		std::cout << std::endl << "# " << _group << std::endl;
+	}
+
+	std::cout << std::left << std::setw(44) << name << std::right << std::fixed
+		<< std::setw(14) << std::setprecision(2) << result.nanosecondsPerOperation << " ns/op"
+		<< std::setw(16) << throughput.str()
+		<< std::setw(12) << std::setprecision(1) << result.allocationsPerOperation << " allocs/op" << std::endl;
+
+	_results.push_back(std::move(result));
+}
+
+// MARK: Output
+static char const* BackendName() {
+#if defined(MATH_SIMD_SSE)
+	return "SSE";
+#elif defined(MATH_SIMD_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
+
+static std::string JsonString(std::string const& text) {
+	std::string result = "\"";
+	for (char c : text) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+		}
+
+		result += c;
+	}
+
+	return result + "\"";
+}
+
+static bool WriteJson(std::string const& path, Bench::Runner const& runner) {
+	std::ofstream file(path);
+	if (!file.is_open()) {
+		return false;
+	}
+
+	file << std::setprecision(9);
+	file << "{\n";
+	file << "\t\"backend\": " << JsonString(BackendName()) << ",\n";
+#if defined(NDEBUG)
+	file << "\t\"assertions\": false,\n";
+#else
+	file << "\t\"assertions\": true,\n";
+#endif
+	file << "\t\"benchmarks\": [";
+
+	auto const& results = runner.GetResults();
+	for (size_t i = 0; i < results.size(); ++i) {
+		Bench::Result const& result = results[i];
+		file << (i == 0 ? "\n" : ",\n") << "\t\t{ "
+			<< "\"group\": " << JsonString(result.group) << ", "
+			<< "\"name\": " << JsonString(result.name) << ", "
+			<< "\"iterations\": " << result.iterations << ", "
+			<< "\"ns_per_op\": " << result.nanosecondsPerOperation << ", "
+			<< "\"bytes_per_second\": " << result.bytesPerSecond << ", "
+			<< "\"allocations_per_op\": " << result.allocationsPerOperation << ", "
+			<< "\"allocated_bytes_per_op\": " << result.allocatedBytesPerOperation << " }";
+	}
+
+	file << "\n\t],\n\t\"speedups\": {";
+	auto const& speedups = runner.GetSpeedups();
+	for (size_t i = 0; i < speedups.size(); ++i) {
+		file << (i == 0 ? "\n" : ",\n") << "\t\t" << JsonString(speedups[i].first) << ": " << speedups[i].second;
+	}
+
+	file << "\n\t}\n}\n";
+	return file.good();
+}
+
+static void PrintUsage(char const* program) {
+	std::cout << "Usage: " << program << " [--filter <text>] [--min-time <seconds>] [--json <path>]" << std::endl
+		<< "\t--filter <text>       only runs the measurements whose \"group/name\" contains text" << std::endl
+		<< "\t--min-time <seconds>  minimum duration of each measurement, 0.5 by default" << std::endl
+		<< "\t--json <path>         also writes the results to path as JSON" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::string filter {};
+	std::string jsonPath {};
+	double minimumSeconds = 0.5;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (argument == "--filter" && hasValue) {
+			filter = argv[++i];
+		}
+
+		else if (argument == "--min-time" && hasValue) {
+			minimumSeconds = std::strtod(argv[++i], nullptr);
+		}
+
+		else if (argument == "--json" && hasValue) {
+			jsonPath = argv[++i];
+		}
+
+		else {
+			PrintUsage(argv[0]);
+			return argument == "--help" ? 0 : 1;
+		}
+	}
+
+	std::cout << "Backend: " << BackendName() << std::endl;
+
+	Bench::Runner runner(filter, minimumSeconds);
+	bool failed = false;
+	for (auto const& [name, function] : Groups()) {
+		runner.SetGroup(name);
+
+		try {
+			function(runner);
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Group " << name << " failed: " << e.what() << std::endl;
+			failed = true;
+		}
+	}
+
+	if (!runner.GetSpeedups().empty()) {
+		std::cout << std::endl << "# Speedups" << std::endl;
+		for (auto const& [name, speedup] : runner.GetSpeedups()) {
+			std::cout << std::left << std::setw(44) << name << std::right << std::fixed << std::setprecision(2) << speedup << "x" << std::endl;
+		}
+	}
+
+	if (!jsonPath.empty() && !WriteJson(jsonPath, runner)) {
+		std::cerr << "Failed to write " << jsonPath << std::endl;
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+}
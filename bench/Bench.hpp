@@ -0,0 +1,129 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Minimal benchmark harness: groups of measurements registered from each
+// bench/*.bench.cpp file, run by Bench.cpp, which prints them and can write
+// them as JSON (--json <path>) to compare builds between releases.
+namespace Bench {
+	struct Result {
+	public:
+		std::string group {};
+		std::string name {};
+		uint64_t iterations = 0;
+		double nanosecondsPerOperation = 0.0;
+		double bytesPerSecond = 0.0;          // 0 when the measurement has no throughput
+		double allocationsPerOperation = 0.0; // Through operator new and the C allocators routed to Bench
+		double allocatedBytesPerOperation = 0.0;
+	};
+
+	// Allocation counters, updated by the global operator new of Bench.cpp
+	// and by the C allocators below, which libraries with a malloc hook (stb
+	// with STBI_MALLOC...) can be pointed at
+	uint64_t AllocationCount();
+	uint64_t AllocatedBytes();
+
+	void* Allocate(size_t size);
+	void* Reallocate(void* pointer, size_t size);
+	void Free(void* pointer);
+
+	// Keeps the compiler from discarding a result or hoisting its computation
+	template <typename T>
+	inline void DoNotOptimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+		__asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+		static_cast<void>(*reinterpret_cast<char const volatile*>(&value));
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	class Runner {
+	public:
+		Runner(std::string filter, double minimumSeconds) : _filter(std::move(filter)), _minimumSeconds(minimumSeconds) {}
+
+		// Whether measurements of the current group with this name are run
+		bool Selected(std::string const& name) const;
+
+		// Calls function(i) for i = 0, 1... until at least the minimum time is
+		// spent, and records the mean time. bytesPerOperation gives the
+		// throughput, usually the size of the input of one call.
+		// Returns the nanoseconds per operation, 0 if the filter skipped it.
+		template <typename Function>
+		double Measure(std::string const& name, Function&& function, size_t bytesPerOperation = 0);
+
+		// Ratio of two measurements, printed at the end if both were run
+		void Speedup(std::string const& name, double baseline, double candidate);
+
+		void SetGroup(std::string group) {
+			_group = std::move(group);
+		}
+
+		std::vector<Result> const& GetResults() const {
+			return _results;
+		}
+
+		std::vector<std::pair<std::string, double>> const& GetSpeedups() const {
+			return _speedups;
+		}
+
+	private:
+		void Record(std::string const& name, uint64_t iterations, double seconds, uint64_t allocations, uint64_t allocatedBytes, size_t bytesPerOperation);
+
+	private:
+		std::string _filter {};
+		double _minimumSeconds = 0.5;
+		std::string _group {};
+		std::vector<Result> _results {};
+		std::vector<std::pair<std::string, double>> _speedups {};
+	};
+
+	using GroupFunction = void (*)(Runner& runner);
+
+	// Declared at namespace scope in a bench file to add a group of measurements
+	struct Group {
+	public:
+		Group(char const* name, GroupFunction function);
+	};
+
+	template <typename Function>
+	double Runner::Measure(std::string const& name, Function&& function, size_t bytesPerOperation) {
+		if (!Selected(name)) {
+			return 0.0;
+		}
+
+		// Warm up, then grow the batch until it lasts the minimum time
+		DoNotOptimize(function(uint64_t(0)));
+
+		uint64_t iterations = 1;
+		while (true) {
+			uint64_t allocations = AllocationCount();
+			uint64_t allocatedBytes = AllocatedBytes();
+
+			auto begin = std::chrono::steady_clock::now();
+			for (uint64_t i = 0; i < iterations; ++i) {
+				DoNotOptimize(function(i));
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			double seconds = std::chrono::duration<double>(end - begin).count();
+			if (seconds >= _minimumSeconds || iterations >= (uint64_t(1) << 40)) {
+				Record(name, iterations, seconds, AllocationCount() - allocations, AllocatedBytes() - allocatedBytes, bytesPerOperation);
+				return 1.0e9 * seconds / static_cast<double>(iterations);
+			}
+
+			// Aim a bit past the minimum time, growing at most 10 times per step
+			double scale = seconds > 0.0 ? 1.2 * _minimumSeconds / seconds : 10.0;
+			iterations = static_cast<uint64_t>(static_cast<double>(iterations) * (scale < 10.0 ? scale : 10.0)) + 1;
+		}
+	}
+}
+
+#endif // BENCH_HPP
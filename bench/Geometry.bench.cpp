@@ -0,0 +1,314 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <filesystem>
+#include <vector>
+#include <cmath>
+#include <array>
+#include <random>
+#include <algorithm>
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+
+#include <Resources/Geometry/GeometryLoader.hpp>
+#include <Resources/Geometry/MeshOptimizer.hpp>
+#include <Resources/Geometry/VertexQuantization.hpp>
+#include <Resources/Geometry/MeshContainer.hpp>
+
+#include <Bench.hpp>
+
+// Line by line loader LoadGeometry used before ParseGeometry, kept as a
+// baseline: a string stream per line and a push_back per number
+static bool ReferenceLoadGeometry(std::filesystem::path const& path, std::vector<float>& pointData, std::vector<uint32_t>& indexData, int dimensions) {
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		return false;
+	}
+
+	pointData.clear();
+	indexData.clear();
+
+	enum class Section
+	{
+		None,
+		Points,
+		Indices,
+	};
+
+	Section currentSection = Section::None;
+
+	float value = 0.0;
+	uint32_t index = 0;
+	std::string line = "";
+	while (!file.eof()) {
+		std::getline(file, line);
+
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+
+		if (line == "[points]") {
+			currentSection = Section::Points;
+		}
+
+		else if (line == "[indices]") {
+			currentSection = Section::Indices;
+		}
+
+		else if (line.empty() || line[0] == '#') {
+			// Do nothing, this is a comment
+		}
+
+		else if (currentSection == Section::Points) {
+			std::istringstream iss(line);
+			for (int i = 0; i < dimensions + 3; ++i) {
+				iss >> value;
+				pointData.push_back(value);
+			}
+		}
+
+		else if (currentSection == Section::Indices) {
+			std::istringstream iss(line);
+			for (int i = 0; i < 3; ++i) {
+				iss >> index;
+				indexData.push_back(index);
+			}
+		}
+	}
+	return true;
+}
+
+// Bumpy grid of size x size quads, written once in a temporary file in the
+// format of LoadGeometry (3 coordinates and a color per point) or as an OBJ
+static std::filesystem::path WriteGrid(char const* fileName, int size, bool obj) {
+	std::filesystem::path path = std::filesystem::temp_directory_path() / fileName;
+	std::ofstream file(path);
+
+	file << (obj ? "# Generated by the benchmarks\n" : "[points]\n");
+	for (int i = 0; i <= size; ++i) {
+		for (int j = 0; j <= size; ++j) {
+			float x = static_cast<float>(i);
+			float z = static_cast<float>(j);
+			float y = 4.0f * std::sin(0.1f * x) * std::cos(0.07f * z);
+			if (obj) {
+				file << "v " << x << " " << y << " " << z << "\n";
+			}
+
+			else {
+				file << x << " " << y << " " << z << " 0.5 0.5 0.5\n";
+			}
+		}
+	}
+
+	file << (obj ? "" : "[indices]\n");
+	for (int i = 0; i < size; ++i) {
+		for (int j = 0; j < size; ++j) {
+			int a = i * (size + 1) + j;
+			int b = a + size + 1;
+			if (obj) {
+				file << "f " << a + 1 << " " << b + 1 << " " << b + 2 << "\nf " << a + 1 << " " << b + 2 << " " << a + 2 << "\n";
+			}
+
+			else {
+				file << a << " " << b << " " << b + 1 << "\n" << a << " " << b + 1 << " " << a + 1 << "\n";
+			}
+		}
+	}
+
+	return path;
+}
+
+static void GeometryBenchmarks(Bench::Runner& runner) {
+	// 256 x 256 quads, 66049 points, past 16-bit indices, about 4 MB
+	std::filesystem::path points = WriteGrid("bench_grid.txt", 256, false);
+	double referenceLoad = runner.Measure("LoadGeometry, 131k triangles (reference)", [&](uint64_t) {
+		std::vector<float> pointData {};
+		std::vector<uint32_t> indexData {};
+		ReferenceLoadGeometry(points, pointData, indexData, 3);
+		return indexData.size();
+	}, std::filesystem::file_size(points));
+	double load = runner.Measure("LoadGeometry, 131k triangles", [&](uint64_t) {
+		std::vector<float> pointData {};
+		std::vector<uint32_t> indexData {};
+		LoadGeometry(points, pointData, indexData, 3);
+		return indexData.size();
+	}, std::filesystem::file_size(points));
+	runner.Speedup("LoadGeometry", referenceLoad, load);
+
+	std::filesystem::path pyramid = "resources/pyramid.obj";
+	if (std::filesystem::exists(pyramid)) {
+		runner.Measure("LoadGeometryFromOBJ, pyramid.obj", [&](uint64_t) {
+			std::vector<VertexAttributes> vertexData {};
+			LoadGeometryFromOBJ(pyramid, vertexData);
+			return vertexData.size();
+		}, std::filesystem::file_size(pyramid));
+	}
+
+	else {
+		std::cerr << "Skipping pyramid.obj, the benchmarks must run from the root of the repository" << std::endl;
+	}
+
+	// About 100k triangles, the order of fourareen.obj
+	std::filesystem::path grid = WriteGrid("bench_grid.obj", 224, true);
+	double objLoad = runner.Measure("LoadGeometryFromOBJ, 100k triangles", [&](uint64_t) {
+		std::vector<VertexAttributes> vertexData {};
+		LoadGeometryFromOBJ(grid, vertexData);
+		return vertexData.size();
+	}, std::filesystem::file_size(grid));
+	runner.Measure("LoadMeshFromOBJ, 100k triangles", [&](uint64_t) {
+		IndexedMesh mesh {};
+		LoadMeshFromOBJ(grid, mesh);
+		return mesh.vertices.size();
+	}, std::filesystem::file_size(grid));
+
+	// The same grid cooked, what the application does before its uploads when
+	// it is given a container: mapping it and reading every page of the
+	// vertices and indices. The file was just written, so it is in the page
+	// cache, as it is after the first run.
+	std::filesystem::path cooked = std::filesystem::temp_directory_path() / "bench_grid.gsmesh";
+	std::filesystem::path quantizedCooked = std::filesystem::temp_directory_path() / "bench_grid_quantized.gsmesh";
+	{
+		IndexedMesh mesh {};
+		LoadMeshFromOBJ(grid, mesh);
+		OptimizeMesh(mesh);
+		MeshContainerWriter(mesh).Write(cooked);
+
+		QuantizedMesh quantized = QuantizeMesh(mesh);
+		MeshContainerWriter(quantized).Write(quantizedCooked);
+	}
+
+	auto touch = [](std::filesystem::path const& path) {
+		MeshContainer container(path);
+
+		uint32_t checksum = 0;
+		for (size_t offset = 0; offset < container.GetVertexDataSize(); offset += 4096) {
+			checksum += container.GetVertexData()[offset];
+		}
+
+		for (size_t offset = 0; offset < container.GetIndexDataSize(); offset += 4096) {
+			checksum += container.GetIndexData()[offset];
+		}
+
+		return checksum;
+	};
+
+	double containerLoad = runner.Measure("MeshContainer, 100k triangles", [&](uint64_t) {
+		return touch(cooked);
+	}, std::filesystem::file_size(cooked));
+	runner.Measure("MeshContainer, 100k triangles quantized", [&](uint64_t) {
+		return touch(quantizedCooked);
+	}, std::filesystem::file_size(quantizedCooked));
+	runner.Speedup("Cooked mesh", objLoad, containerLoad);
+
+	std::filesystem::remove(points);
+	std::filesystem::remove(grid);
+	std::filesystem::remove(cooked);
+	std::filesystem::remove(quantizedCooked);
+}
+
+static Bench::Group const geometryGroup("Geometry", GeometryBenchmarks);
+
+// MARK: Mesh memory
+// Bytes of the welded vertices and indices against a vertex per corner, not a timing
+static void MeshMemoryTable(Bench::Runner& runner) {
+	if (!runner.Selected("Mesh memory")) {
+		return;
+	}
+
+	std::cout << std::endl << "# Mesh memory (triangle soup -> vertices + indices)" << std::endl;
+
+	std::filesystem::path grid = WriteGrid("bench_grid.obj", 224, true);
+	for (std::filesystem::path const& path : { std::filesystem::path("resources/cube.obj"), std::filesystem::path("resources/pyramid.obj"), grid }) {
+		IndexedMesh mesh {};
+		if (!LoadMeshFromOBJ(path, mesh)) {
+			continue;
+		}
+
+		MeshMemory memory = GetMeshMemory(mesh);
+		std::string name = path == grid ? "100k triangles grid" : path.filename().string();
+		std::cout << std::left << std::setw(44) << name << std::right
+			<< std::setw(10) << memory.soupBytes << " -> " << memory.vertexBytes << " + " << memory.indexBytes
+			<< " bytes, " << memory.GetSavedBytes() << " saved, "
+			<< mesh.vertices.size() * sizeof(QuantizedVertex) << " quantized vertex bytes" << std::endl;
+	}
+
+	std::filesystem::remove(grid);
+}
+
+static Bench::Group const meshMemoryGroup("Mesh memory", MeshMemoryTable);
+
+// MARK: Mesh optimization
+// Triangles of a mesh in a random order, as exporters without any
+// optimization can give them
+static void ShuffleTriangles(IndexedMesh& mesh) {
+	std::vector<std::array<uint32_t, 3>> triangles(mesh.indices.size() / 3);
+	for (size_t t = 0; t < triangles.size(); ++t) {
+		triangles[t] = { mesh.indices[3 * t], mesh.indices[3 * t + 1], mesh.indices[3 * t + 2] };
+	}
+
+	std::mt19937 random(42);
+	std::shuffle(triangles.begin(), triangles.end(), random);
+	for (size_t t = 0; t < triangles.size(); ++t) {
+		std::copy(triangles[t].begin(), triangles[t].end(), mesh.indices.begin() + 3 * t);
+	}
+}
+
+static void MeshOptimizationBenchmarks(Bench::Runner& runner) {
+	std::filesystem::path path = WriteGrid("bench_grid.obj", 224, true);
+	IndexedMesh grid {};
+	LoadMeshFromOBJ(path, grid);
+	std::filesystem::remove(path);
+	ShuffleTriangles(grid);
+
+	runner.Measure("OptimizeVertexCache, 100k triangles", [&](uint64_t) {
+		std::vector<uint32_t> indices = grid.indices;
+		OptimizeVertexCache(indices, grid.vertices.size());
+		return indices[0];
+	}, grid.indices.size() * sizeof(uint32_t));
+
+	runner.Measure("OptimizeMesh, 100k triangles", [&](uint64_t) {
+		IndexedMesh mesh = grid;
+		OptimizeMesh(mesh);
+		return mesh.indices[0];
+	}, grid.indices.size() * sizeof(uint32_t));
+
+	runner.Measure("QuantizeMesh, 100k triangles", [&](uint64_t) {
+		QuantizedMesh mesh = QuantizeMesh(grid);
+		return mesh.vertices[0].position[0];
+	}, grid.vertices.size() * sizeof(VertexAttributes));
+
+	if (!runner.Selected("ACMR")) {
+		return;
+	}
+
+	// Misses of a FIFO cache of 16 vertices, per triangle and per vertex
+	std::cout << std::endl << "# Vertex cache, 16 entries (ACMR / ATVR)" << std::endl;
+	auto print = [](std::string const& name, IndexedMesh const& mesh) {
+		VertexCacheStatistics statistics = AnalyzeVertexCache(mesh.indices, mesh.vertices.size());
+		std::cout << std::left << std::setw(44) << name << std::right << std::setprecision(3)
+			<< std::setw(10) << statistics.acmr << " / " << statistics.atvr << std::endl;
+	};
+
+	for (char const* name : { "resources/cube.obj", "resources/pyramid.obj" }) {
+		IndexedMesh mesh {};
+		if (!LoadMeshFromOBJ(name, mesh)) {
+			continue;
+		}
+
+		print(std::string(name) + ", file order", mesh);
+		OptimizeMesh(mesh);
+		print(std::string(name) + ", optimized", mesh);
+	}
+
+	IndexedMesh mesh = grid;
+	print("100k triangles shuffled", mesh);
+	OptimizeVertexCache(mesh.indices, mesh.vertices.size());
+	print("100k triangles, vertex cache", mesh);
+	OptimizeOverdraw(mesh.indices, mesh.vertices);
+	print("100k triangles, vertex cache and overdraw", mesh);
+}
+
+static Bench::Group const meshOptimizationGroup("Mesh optimization", MeshOptimizationBenchmarks);
@@ -0,0 +1,297 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <utility>
+#include <span>
+#include <thread>
+#include <algorithm>
+
+#include <Math/Matrix.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Transform3D.hpp>
+#include <Math/DepthPrecision.hpp>
+#include <Math/Culling.hpp>
+#include <Math/BVH.hpp>
+
+#include <Bench.hpp>
+
+static Math::Matrix4x4 const projection = Math::Matrix4x4::Perspective(1.0471975f, 256.0f / 240.0f, 0.1f, 1000.0f);
+
+static unsigned ThreadCount() {
+	return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// Scalar paths Matrix4x4 used before the Simd backend, kept as a baseline
+static Math::Matrix4x4 ReferenceMultiply(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs) {
+	Math::Matrix4x4 result;
+	for (int n = 0; n < 4; ++n) {
+		for (int m = 0; m < 4; ++m) {
+			result(n, m) = Math::Vector4::Dot(lhs.Line(n), rhs.Column(m));
+		}
+	}
+
+	return result;
+}
+
+static Math::Matrix4x4 ReferenceInverse(Math::Matrix4x4 const& m) {
+	Math::Matrix4x4 cofactors = m.CofactorMatrix();
+	Math::Matrix4x4 adjugate(cofactors.Column(0), cofactors.Column(1), cofactors.Column(2), cofactors.Column(3));
+	return adjugate / Math::Matrix4x4::Determinant(m);
+}
+
+// MARK: Matrix4x4
+static void MatrixBenchmarks(Bench::Runner& runner) {
+	std::vector<Math::Matrix4x4> views {};
+	for (int i = 0; i < 64; ++i) {
+		views.push_back(Math::Matrix4x4::RotateX(0.01f * i) * Math::Matrix4x4::RotateY(-0.02f * i));
+	}
+
+	auto viewAt = [&views](uint64_t i) -> Math::Matrix4x4 const& {
+		return views[i & 63];
+	};
+
+	double referenceMultiply = runner.Measure("Multiply (reference)", [&](uint64_t i) {
+		return ReferenceMultiply(projection, viewAt(i));
+	});
+	double simdMultiply = runner.Measure("Multiply", [&](uint64_t i) {
+		return projection * viewAt(i);
+	});
+
+	double referenceInverse = runner.Measure("Inverse (reference)", [&](uint64_t i) {
+		return ReferenceInverse(projection * viewAt(i));
+	});
+	double simdInverse = runner.Measure("Inverse", [&](uint64_t i) {
+		return Math::Matrix4x4::Inverse(projection * viewAt(i));
+	});
+
+	runner.Measure("Transpose", [&](uint64_t i) {
+		return Math::Matrix4x4::Transpose(viewAt(i));
+	});
+
+	runner.Measure("Rotation compose", [&](uint64_t i) {
+		return viewAt(i) * viewAt(i + 1);
+	});
+
+	// Only constant arguments: folded by the compiler when the math is inlinable
+	runner.Measure("Constant model matrix", [&](uint64_t i) {
+		return viewAt(i) * (Math::Matrix4x4::Translate(1.0f, 2.0f, 3.0f) * Math::Matrix4x4::Scale(2.0f));
+	});
+
+	runner.Speedup("Matrix4x4 multiply", referenceMultiply, simdMultiply);
+	runner.Speedup("Matrix4x4 inverse", referenceInverse, simdInverse);
+}
+
+static Bench::Group const matrixGroup("Matrix4x4", MatrixBenchmarks);
+
+// MARK: Vector3
+static void VectorBenchmarks(Bench::Runner& runner) {
+	std::vector<Math::Vector3> vectors {};
+	for (int i = 0; i < 64; ++i) {
+		vectors.emplace_back(std::sin(0.3f * i) + 2.0f, std::cos(0.7f * i) - 0.5f, 0.1f * i);
+	}
+
+	auto vectorAt = [&vectors](uint64_t i) -> Math::Vector3 const& {
+		return vectors[i & 63];
+	};
+
+	runner.Measure("Normalize", [&](uint64_t i) {
+		return Math::Vector3::Normalize(vectorAt(i));
+	});
+	runner.Measure("Cross", [&](uint64_t i) {
+		return Math::Vector3::Cross(vectorAt(i), vectorAt(i + 1));
+	});
+
+	// Orthonormal basis, as in LookAt
+	runner.Measure("Normalize and cross", [&](uint64_t i) {
+		Math::Vector3 forward = Math::Vector3::Normalize(vectorAt(i));
+		Math::Vector3 right = Math::Vector3::Normalize(Math::Vector3::Cross(vectorAt(i + 1), forward));
+		return Math::Vector3::Cross(forward, right);
+	});
+}
+
+static Bench::Group const vectorGroup("Vector3", VectorBenchmarks);
+
+// MARK: Transforms
+static void TransformBenchmarks(Bench::Runner& runner) {
+	// Per-frame camera update of main.cpp
+	runner.Measure("Frame update (Matrix4x4)", [&](uint64_t i) {
+		float angle = 0.001f * static_cast<float>(i & 1023);
+		Math::Matrix4x4 view = Math::Matrix4x4::RotateX(angle) * Math::Matrix4x4::RotateY(-angle);
+		return Math::Matrix4x4::Transpose(Math::Matrix4x4::Inverse(projection * view));
+	});
+
+	// Same camera update, composing the two rotations as quaternions
+	runner.Measure("Frame update (quaternion)", [&](uint64_t i) {
+		float angle = 0.001f * static_cast<float>(i & 1023);
+		Math::Matrix4x4 view = (Math::Quaternion::RotateX(angle) * Math::Quaternion::RotateY(-angle)).ToMatrix4x4();
+		return Math::Matrix4x4::Transpose(Math::Matrix4x4::Inverse(projection * view));
+	});
+
+	// Current main.cpp: rigid view inverse and projection inverted once
+	Math::Matrix4x4 projectionInverse = Math::Matrix4x4::Inverse(projection);
+	runner.Measure("Frame update (Transform3D)", [&](uint64_t i) {
+		float angle = 0.001f * static_cast<float>(i & 1023);
+		Math::Transform3D view = Math::Transform3D::Rotate(Math::Quaternion::RotateX(angle) * Math::Quaternion::RotateY(-angle));
+		return Math::Matrix4x4::Transpose(Math::Transform3D::Inverse(view).ToMatrix4x4() * projectionInverse);
+	});
+
+	std::vector<Math::Transform3D> transforms {};
+	for (int i = 0; i < 64; ++i) {
+		transforms.push_back(Math::Transform3D::Translate(0.1f * i, 2.0f, -1.0f) * Math::Transform3D::RotateX(0.01f * i) * Math::Transform3D::RotateY(-0.02f * i));
+	}
+
+	runner.Measure("Rigid inverse (Matrix4x4)", [&](uint64_t i) {
+		return Math::Matrix4x4::Inverse(transforms[i & 63].ToMatrix4x4());
+	});
+	runner.Measure("Rigid inverse (Transform3D)", [&](uint64_t i) {
+		return Math::Transform3D::Inverse(transforms[i & 63]).ToMatrix3x4();
+	});
+	runner.Measure("Affine compose (Transform3D)", [&](uint64_t i) {
+		return (transforms[i & 63] * transforms[(i + 1) & 63]).ToMatrix3x4();
+	});
+
+	std::vector<Math::Quaternion> orientations {};
+	for (int i = 0; i < 64; ++i) {
+		orientations.push_back(Math::Quaternion::RotateX(0.01f * i) * Math::Quaternion::RotateY(-0.02f * i));
+	}
+
+	runner.Measure("Rotation compose (Quaternion)", [&](uint64_t i) {
+		return orientations[i & 63] * orientations[(i + 1) & 63];
+	});
+	runner.Measure("Quaternion slerp", [&](uint64_t i) {
+		return Math::Quaternion::Slerp(orientations[i & 63], orientations[(i + 17) & 63], 0.3f);
+	});
+	runner.Measure("Quaternion fast slerp", [&](uint64_t i) {
+		return Math::Quaternion::FastSlerp(orientations[i & 63], orientations[(i + 17) & 63], 0.3f);
+	});
+}
+
+static Bench::Group const transformGroup("Transforms", TransformBenchmarks);
+
+// MARK: Culling
+static void CullingBenchmarks(Bench::Runner& runner) {
+	// Boxes scattered on a 200 units cube around a camera seeing about a tenth of them
+	std::vector<Math::AABB> boxes {};
+	for (int i = 0; i < 65536; ++i) {
+		Math::Vector3 min(static_cast<float>((i * 37) % 200 - 100), static_cast<float>((i * 91) % 200 - 100), static_cast<float>((i * 53) % 200 - 100));
+		boxes.push_back(Math::AABB { min, min + Math::Vector3(0.5f + static_cast<float>(i % 7)) });
+	}
+
+	Math::Frustum frustum(projection * Math::Matrix4x4::LookAt(Math::Vector3(0.0f, 0.0f, -50.0f), Math::Vector3(0.0f), Math::Vector3(0.0f, 1.0f, 0.0f)));
+	std::vector<uint8_t> visible(boxes.size());
+	size_t size = boxes.size() * sizeof(Math::AABB);
+
+	double scalarCulling = runner.Measure("65536 boxes (scalar)", [&](uint64_t) {
+		for (size_t i = 0; i < boxes.size(); ++i) {
+			visible[i] = frustum.Intersects(boxes[i]) ? 1 : 0;
+		}
+		return visible.data();
+	}, size);
+	double batchCulling = runner.Measure("65536 boxes (batch)", [&](uint64_t) {
+		Math::CullBoxes(frustum, boxes, visible);
+		return visible.data();
+	}, size);
+	double threadedCulling = runner.Measure("65536 boxes (batch, threads)", [&](uint64_t) {
+		Math::CullBoxes(frustum, boxes, visible, ThreadCount());
+		return visible.data();
+	}, size);
+
+	runner.Speedup("Culling", scalarCulling, batchCulling);
+	runner.Speedup("Culling, " + std::to_string(ThreadCount()) + " threads", scalarCulling, threadedCulling);
+}
+
+static Bench::Group const cullingGroup("Culling", CullingBenchmarks);
+
+// MARK: BVH
+static void BVHBenchmarks(Bench::Runner& runner) {
+	// Bumpy grid of about 100k triangles, the order of fourareen.obj
+	std::vector<Math::Vector3> mesh {};
+	for (int i = 0; i < 224; ++i) {
+		for (int j = 0; j < 224; ++j) {
+			for (auto [di, dj] : { std::pair { 0, 0 }, std::pair { 1, 0 }, std::pair { 1, 1 }, std::pair { 0, 0 }, std::pair { 1, 1 }, std::pair { 0, 1 } }) {
+				float x = static_cast<float>(i + di);
+				float z = static_cast<float>(j + dj);
+				mesh.emplace_back(x, 4.0f * std::sin(0.1f * x) * std::cos(0.07f * z), z);
+			}
+		}
+	}
+
+	size_t size = mesh.size() * sizeof(Math::Vector3);
+	runner.Measure("Build, 100k triangles", [&](uint64_t) {
+		return Math::BVH::Build(mesh).GetBounds();
+	}, size);
+	runner.Measure("Build, 100k triangles (threads)", [&](uint64_t) {
+		return Math::BVH::Build(mesh, ThreadCount()).GetBounds();
+	}, size);
+
+	auto pickingRay = [](uint64_t i) {
+		float x = static_cast<float>((i * 37) % 224);
+		float z = static_cast<float>((i * 91) % 224);
+		return Math::Ray { Math::Vector3(x, 20.0f, z), Math::Vector3(0.3f, -1.0f, 0.2f) };
+	};
+
+	double bruteForceRaycast = runner.Measure("Raycast, every triangle", [&](uint64_t i) {
+		Math::Ray ray = pickingRay(i);
+		float closest = std::numeric_limits<float>::infinity();
+		for (size_t t = 0; t < mesh.size(); t += 3) {
+			float distance = 0.0f;
+			float u = 0.0f;
+			float v = 0.0f;
+			if (Math::IntersectTriangle(ray, &mesh[t], closest, distance, u, v)) {
+				closest = distance;
+			}
+		}
+		return closest;
+	});
+
+	Math::BVH bvh = Math::BVH::Build(mesh);
+	double bvhRaycast = runner.Measure("Raycast", [&](uint64_t i) {
+		Math::RayHit hit {};
+		bvh.Raycast(pickingRay(i), hit);
+		return hit.distance;
+	});
+
+	runner.Speedup("Raycast", bruteForceRaycast, bvhRaycast);
+}
+
+static Bench::Group const bvhGroup("BVH", BVHBenchmarks);
+
+// MARK: Depth precision
+// Relative error on the reconstructed view distance over [0.1, 100000], not a timing
+static void DepthPrecisionTable(Bench::Runner& runner) {
+	if (!runner.Selected("Depth precision")) {
+		return;
+	}
+
+	std::cout << std::endl << "# Depth precision (max / mean relative error)" << std::endl;
+	struct NamedProjection {
+		char const* name;
+		Math::Matrix4x4 matrix;
+	};
+
+	float const near = 0.1f;
+	float const far = 100000.0f;
+	float const infinity = std::numeric_limits<float>::infinity();
+	NamedProjection const projections[] = {
+		{ "Standard", Math::Matrix4x4::Perspective(1.0471975f, 1.0f, near, far) },
+		{ "Reversed-Z", Math::Matrix4x4::Perspective(1.0471975f, 1.0f, near, far, true) },
+		{ "Infinite", Math::Matrix4x4::Perspective(1.0471975f, 1.0f, near, infinity) },
+		{ "Infinite reversed-Z", Math::Matrix4x4::Perspective(1.0471975f, 1.0f, near, infinity, true) },
+	};
+
+	for (NamedProjection const& named : projections) {
+		for (Math::DepthFormat format : { Math::DepthFormat::Depth24Plus, Math::DepthFormat::Depth32Float }) {
+			Math::DepthPrecisionReport report = Math::MeasureDepthPrecision(named.matrix, format, near, far);
+			std::string name = std::string(named.name) + (format == Math::DepthFormat::Depth24Plus ? ", Depth24Plus" : ", Depth32Float");
+			std::cout << std::left << std::setw(44) << name << std::right << std::scientific << std::setprecision(2)
+				<< std::setw(10) << report.maxError << " / " << report.meanError << std::endl;
+		}
+	}
+
+	std::cout << std::fixed;
+}
+
+static Bench::Group const depthGroup("Depth precision", DepthPrecisionTable);
@@ -0,0 +1,311 @@
+#include <iostream>
+#include <filesystem>
+#include <array>
+#include <vector>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <future>
+
+// Decoded images are counted as allocations too
+#define STBI_MALLOC(size) Bench::Allocate(size)
+#define STBI_REALLOC(pointer, size) Bench::Reallocate(pointer, size)
+#define STBI_FREE(pointer) Bench::Free(pointer)
+
+#include <Bench.hpp>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Utils/ThreadPool.hpp>
+
+// MARK: Mipmaps
+// Downsampling loop WriteMipMaps used before MipChain, kept as a baseline:
+// column by column, truncating, and only for even sizes
+static void ReferenceDownsample(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination) {
+	uint32_t levelWidth = width / 2;
+	uint32_t levelHeight = height / 2;
+
+	for (uint32_t i = 0; i < levelWidth; ++i) {
+		for (uint32_t j = 0; j < levelHeight; ++j) {
+			uint8_t* p = &destination[4 * (j * levelWidth + i)];
+
+			uint8_t const* p00 = &source[4 * ((2 * j + 0) * width + (2 * i + 0))];
+			uint8_t const* p01 = &source[4 * ((2 * j + 0) * width + (2 * i + 1))];
+			uint8_t const* p10 = &source[4 * ((2 * j + 1) * width + (2 * i + 0))];
+			uint8_t const* p11 = &source[4 * ((2 * j + 1) * width + (2 * i + 1))];
+
+			p[0] = (p00[0] + p01[0] + p10[0] + p11[0]) / 4;
+			p[1] = (p00[1] + p01[1] + p10[1] + p11[1]) / 4;
+			p[2] = (p00[2] + p01[2] + p10[2] + p11[2]) / 4;
+			p[3] = (p00[3] + p01[3] + p10[3] + p11[3]) / 4;
+		}
+	}
+}
+
+static void MipMapBenchmarks(Bench::Runner& runner) {
+	unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	for (uint32_t size : { 1024u, 4096u, 8192u }) {
+		std::vector<uint8_t> source(4 * static_cast<size_t>(size) * size);
+		for (size_t i = 0; i < source.size(); ++i) {
+			source[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+		}
+
+		std::vector<uint8_t> destination(source.size() / 4);
+		std::string dimensions = std::to_string(size) + "x" + std::to_string(size);
+
+		double referenceDownsample = runner.Measure("Downsample " + dimensions + " (reference)", [&](uint64_t) {
+			ReferenceDownsample(source.data(), size, size, destination.data());
+			return destination[0];
+		}, source.size());
+		double downsample = runner.Measure("Downsample " + dimensions, [&](uint64_t) {
+			DownsampleRGBA8(source.data(), size, size, destination.data());
+			return destination[0];
+		}, source.size());
+		runner.Measure("Downsample " + dimensions + " (threads)", [&](uint64_t) {
+			DownsampleRGBA8(source.data(), size, size, destination.data(), threadCount);
+			return destination[0];
+		}, source.size());
+
+		// Every level, with a buffer per level like WriteMipMaps used to
+		double referenceChain = runner.Measure("Mip chain " + dimensions + " (reference)", [&](uint64_t) {
+			std::vector<uint8_t> previous = source;
+			for (uint32_t width = size; width > 1; width /= 2) {
+				std::vector<uint8_t> level(previous.size() / 4);
+				ReferenceDownsample(previous.data(), width, width, level.data());
+				previous = std::move(level);
+			}
+			return previous[0];
+		}, source.size());
+
+		MipChain chain {};
+		double mipChain = runner.Measure("Mip chain " + dimensions, [&](uint64_t) {
+			chain.Generate(source.data(), size, size);
+			return chain.GetBuffer().back();
+		}, source.size());
+		runner.Measure("Mip chain " + dimensions + " (threads)", [&](uint64_t) {
+			chain.Generate(source.data(), size, size, 0, threadCount);
+			return chain.GetBuffer().back();
+		}, source.size());
+
+		runner.Speedup("Downsample " + dimensions, referenceDownsample, downsample);
+		runner.Speedup("Mip chain " + dimensions, referenceChain, mipChain);
+	}
+}
+
+static Bench::Group const mipMapGroup("Mipmaps", MipMapBenchmarks);
+
+// Chains of a 2048x2048 sRGB image with each filter, the first level being
+// most of the time
+static void MipFilterBenchmarks(Bench::Runner& runner) {
+	uint32_t size = 2048;
+	std::vector<uint8_t> source(4 * static_cast<size_t>(size) * size);
+	for (size_t i = 0; i < source.size(); ++i) {
+		source[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+	}
+
+	struct NamedFilter {
+		char const* name;
+		MipFilter filter;
+		ColorSpace colorSpace;
+	};
+
+	NamedFilter const filters[] = {
+		{ "Box, linear", MipFilter::Box, ColorSpace::Linear },
+		{ "Box, sRGB", MipFilter::Box, ColorSpace::Srgb },
+		{ "Kaiser, sRGB", MipFilter::Kaiser, ColorSpace::Srgb },
+		{ "Lanczos, sRGB", MipFilter::Lanczos, ColorSpace::Srgb },
+	};
+
+	MipChain chain {};
+	for (NamedFilter const& named : filters) {
+		runner.Measure(std::string("Mip chain 2048x2048, ") + named.name, [&](uint64_t) {
+			chain.Generate(source.data(), size, size, named.filter, named.colorSpace);
+			return chain.GetBuffer().back();
+		}, source.size());
+	}
+}
+
+static Bench::Group const mipFilterGroup("Mip filters", MipFilterBenchmarks);
+
+// 6 sRGB faces of 1024x1024, one after the other like a single texture, then
+// spread over the threads, then with the seams
+static void CubemapMipMapBenchmarks(Bench::Runner& runner) {
+	unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	uint32_t size = 1024;
+
+	std::vector<uint8_t> source(4 * static_cast<size_t>(size) * size);
+	for (size_t i = 0; i < source.size(); ++i) {
+		source[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+	}
+
+	std::array<uint8_t const*, 6> faces {};
+	faces.fill(source.data());
+
+	double sequential = runner.Measure("Cubemap 1024x1024, faces one by one", [&](uint64_t) {
+		return GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, false, 0, 1)[5].GetBuffer().back();
+	}, 6 * source.size());
+	double parallel = runner.Measure("Cubemap 1024x1024, faces in parallel", [&](uint64_t) {
+		return GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, false, 0, threadCount)[5].GetBuffer().back();
+	}, 6 * source.size());
+	runner.Measure("Cubemap 1024x1024, seam-aware", [&](uint64_t) {
+		return GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, true, 0, threadCount)[5].GetBuffer().back();
+	}, 6 * source.size());
+
+	runner.Speedup("Cubemap 1024x1024 mip chains", sequential, parallel);
+}
+
+static Bench::Group const cubemapMipMapGroup("Cubemap mipmaps", CubemapMipMapBenchmarks);
+
+// MARK: Block compression
+// A 1024x1024 image with the smooth gradients and the noise of a photo, so
+// that the blocks are neither flat nor random
+static void BlockCompressionBenchmarks(Bench::Runner& runner) {
+	unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	uint32_t size = 1024;
+
+	std::vector<uint8_t> source(4 * static_cast<size_t>(size) * size);
+	for (uint32_t y = 0; y < size; ++y) {
+		for (uint32_t x = 0; x < size; ++x) {
+			uint8_t noise = static_cast<uint8_t>(((y * size + x) * 2654435761u) >> 28);
+			uint8_t* pixel = &source[4 * (static_cast<size_t>(y) * size + x)];
+			pixel[0] = static_cast<uint8_t>(x / 4 + noise);
+			pixel[1] = static_cast<uint8_t>(y / 4 + noise);
+			pixel[2] = static_cast<uint8_t>((x + y) / 8 + noise);
+			pixel[3] = static_cast<uint8_t>(255 - x / 8);
+		}
+	}
+
+	struct NamedFormat {
+		char const* name;
+		BlockFormat format;
+	};
+
+	NamedFormat const formats[] = {
+		{ "BC1", BlockFormat::BC1 },
+		{ "BC3", BlockFormat::BC3 },
+		{ "BC7", BlockFormat::BC7 },
+	};
+
+	for (NamedFormat const& named : formats) {
+		std::vector<uint8_t> blocks(CompressedSize(named.format, size, size));
+		std::string name = std::string(named.name) + " 1024x1024";
+
+		double single = runner.Measure(name, [&](uint64_t) {
+			CompressRGBA8(source.data(), size, size, blocks.data(), named.format);
+			return blocks.back();
+		}, source.size());
+		double threaded = runner.Measure(name + " (threads)", [&](uint64_t) {
+			CompressRGBA8(source.data(), size, size, blocks.data(), named.format, threadCount);
+			return blocks.back();
+		}, source.size());
+
+		runner.Speedup(name, single, threaded);
+	}
+}
+
+static Bench::Group const blockCompressionGroup("Block compression", BlockCompressionBenchmarks);
+
+// MARK: Decoding
+static void DecodeBenchmarks(Bench::Runner& runner) {
+	// Skybox of main.cpp, 4096x4096 JPEG faces
+	std::array<std::filesystem::path, 6> faces {
+		"resources/stars_px.jpg",
+		"resources/stars_nx.jpg",
+		"resources/stars_py.jpg",
+		"resources/stars_ny.jpg",
+		"resources/stars_pz.jpg",
+		"resources/stars_nz.jpg",
+	};
+
+	size_t size = 0;
+	for (auto const& face : faces) {
+		if (!std::filesystem::exists(face)) {
+			std::cerr << "Skipping " << face << ", the benchmarks must run from the root of the repository" << std::endl;
+			return;
+		}
+
+		size += std::filesystem::file_size(face);
+	}
+
+	runner.Measure("Cubemap face", [&](uint64_t) {
+		return Image::Load(faces[0]).Width();
+	}, std::filesystem::file_size(faces[0]));
+
+	double sequential = runner.Measure("Cubemap faces", [&](uint64_t) {
+		return LoadCubemapFaces(faces)[0].Width();
+	}, size);
+
+	// The pool is started once, like the one of main.cpp
+	Utils::ThreadPool threadPool {};
+	double pooled = runner.Measure("Cubemap faces (thread pool)", [&](uint64_t) {
+		return LoadCubemapFaces(faces, threadPool)[0].Width();
+	}, size);
+
+	// What Cubemap does before its uploads
+	double chains = runner.Measure("Cubemap faces and mip chains (thread pool)", [&](uint64_t) {
+		std::array<std::future<MipChain>, 6> chains {};
+		for (size_t layer = 0; layer < 6; ++layer) {
+			chains[layer] = threadPool.Submit([&, layer]() {
+				Image face = Image::Load(faces[layer]);
+				return MipChain(face.Data(), face.Width(), face.Height(), MipFilter::Box, ColorSpace::Srgb);
+			});
+		}
+
+		uint32_t levelCount = 0;
+		for (auto& chain : chains) {
+			levelCount += chain.get().GetLevelCount();
+		}
+
+		return levelCount;
+	}, size);
+
+	// The same faces cooked, what Cubemap does before its uploads when it is
+	// given a container: mapping it and reading every page of every level
+	std::filesystem::path containerPath = std::filesystem::temp_directory_path() / "bench_stars_cube.gstex";
+	{
+		std::array<Image, 6> images = LoadCubemapFaces(faces, threadPool);
+		std::array<uint8_t const*, 6> data {};
+		for (size_t layer = 0; layer < 6; ++layer) {
+			data[layer] = images[layer].Data();
+		}
+
+		std::array<MipChain, 6> cooked = GenerateCubemapMipChains(data, images[0].Width(), MipFilter::Box, ColorSpace::Srgb, false);
+		TextureContainerWriter writer(TextureContainerFormat::RGBA8UnormSrgb, images[0].Width(), images[0].Height(), 6, cooked[0].GetLevelCount(), true);
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			for (uint32_t level = 0; level < cooked[layer].GetLevelCount(); ++level) {
+				writer.SetLevel(layer, level, cooked[layer].GetData(level), cooked[layer].GetSize(level));
+			}
+		}
+
+		writer.Write(containerPath);
+	}
+
+	double container = runner.Measure("Cubemap container", [&](uint64_t) {
+		TextureContainer cubemap(containerPath);
+
+		uint32_t checksum = 0;
+		for (uint32_t layer = 0; layer < cubemap.GetLayerCount(); ++layer) {
+			for (uint32_t level = 0; level < cubemap.GetLevelCount(); ++level) {
+				uint8_t const* levelData = cubemap.GetData(layer, level);
+				for (size_t offset = 0; offset < cubemap.GetSize(level); offset += 4096) {
+					checksum += levelData[offset];
+				}
+			}
+		}
+
+		return checksum;
+	}, size);
+
+	std::filesystem::remove(containerPath);
+
+	runner.Speedup("Cubemap faces", sequential, pooled);
+	runner.Speedup("Cubemap from container", chains, container);
+}
+
+static Bench::Group const decodeGroup("Decoding", DecodeBenchmarks);
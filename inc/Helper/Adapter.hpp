@@ -4,6 +4,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <vector>
+#include <algorithm>
 
 #include <wgpu-native/webgpu.hpp>
 
@@ -40,6 +41,9 @@ public:
 		return _limits;
 	}
 
+	// Whether a device of this adapter can require feature
+	bool HasFeature(wgpu::FeatureName feature) const;
+
 	wgpu::Adapter* operator->();
 
 	void DisplayFeatures() const;
@@ -8,7 +8,7 @@
 struct BufferBindingLayout : public wgpu::BindGroupLayoutEntry {
 public:
 	BufferBindingLayout() = delete;
-	BufferBindingLayout(uint32_t bufferBinding, wgpu::ShaderStage bufferVisibility, wgpu::BufferBindingType bufferType, uint32_t bufferMinBindingSize);
+	BufferBindingLayout(uint32_t bufferBinding, wgpu::ShaderStage bufferVisibility, wgpu::BufferBindingType bufferType, uint32_t bufferMinBindingSize, bool bufferHasDynamicOffset = false);
 
 public:
 	friend std::ostream& operator<<(std::ostream& out, BufferBindingLayout const& bindGroupLayoutEntry);
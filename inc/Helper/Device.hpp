@@ -27,6 +27,10 @@ public:
 	wgpu::Limits const& Limits() const {
 		return _limits;
 	}
+
+	// Whether the device was created with feature, see DeviceDescriptor
+	bool HasFeature(wgpu::FeatureName feature) const;
+
 	void DisplayLimits() const;
 
 	wgpu::Device* operator -> ();
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <wgpu-native/webgpu.hpp>
 
@@ -11,13 +12,25 @@
 #include <Helper/DeviceLostCallbackInfo.hpp>
 #include <Helper/UncapturedErrorCallbackInfo.hpp>
 
+// Requires the optional features used by the application that the adapter
+// supports: TextureCompressionBC for block-compressed textures
 struct DeviceDescriptor : public wgpu::DeviceDescriptor {
 public:
 	DeviceDescriptor(Adapter const& adapter);
 	DeviceDescriptor(Adapter const& adapter, Limits const& limits, DeviceLostCallbackInfo const& deviceLostCallbackInfo, UncapturedErrorCallbackInfo const& uncapturedErrorCallbackInfo);
 
+	// The descriptor points to its members
+	DeviceDescriptor(DeviceDescriptor const& other) = delete;
+	DeviceDescriptor& operator=(DeviceDescriptor const& other) = delete;
+
 public:
 	static int id;
+
+private:
+	std::string _label {};
+	std::string _queueLabel {};
+	wgpu::Limits _limits {};
+	std::vector<wgpu::FeatureName> _requiredFeatures {};
 };
 
 #endif // DEVICEDESCRIPTOR_HPP
@@ -0,0 +1,82 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#include <span>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+#include <Math/Vector.hpp>
+#include <Math/Bounds.hpp>
+
+namespace Math {
+	struct Ray {
+	public:
+		Vector3 origin {};
+		Vector3 direction {}; // Does not need to be normalized
+	};
+
+	struct RayHit {
+	public:
+		uint32_t triangle = 0; // Index of the triangle in the mesh the hierarchy was built from
+		float distance = 0.0f; // Along the ray, in units of its direction
+		float u = 0.0f;        // Barycentric coordinates of the hit point, which is
+		float v = 0.0f;        // (1 - u - v) * p0 + u * p1 + v * p2
+	};
+
+	// Möller-Trumbore test of the ray against both sides of the triangle given by
+	// 3 consecutive positions, for hits between 0 and maxDistance
+	bool IntersectTriangle(Ray const& ray, Vector3 const* triangle, float maxDistance, float& distance, float& u, float& v);
+
+	// Bounding volume hierarchy over the triangles of a mesh, built with the
+	// surface area heuristic. Nodes are stored depth first in a flat array: the
+	// first child of an inner node directly follows it, the second one is at
+	// node.offset, so that half of the descents read the next cache line.
+	class BVH {
+	public:
+		struct Node {
+		public:
+			constexpr bool IsLeaf() const {
+				return count != 0;
+			}
+
+		public:
+			AABB bounds {};
+			uint32_t offset = 0; // First triangle of a leaf, second child of an inner node
+			uint16_t count = 0;  // Triangles of a leaf, 0 for inner nodes
+			uint16_t axis = 0;   // Axis inner nodes are split along
+		};
+
+		BVH() = default;
+
+		// Triangles are given by 3 consecutive positions, like the vertices of
+		// LoadGeometryFromOBJ, or by 3 consecutive indices into positions.
+		// With threadCount > 1, the subtrees of the first levels are built in
+		// parallel; the result does not depend on threadCount.
+		static BVH Build(std::span<Vector3 const> positions, unsigned threadCount = 1);
+		static BVH Build(std::span<Vector3 const> positions, std::span<uint32_t const> indices, unsigned threadCount = 1);
+
+		// Closest triangle hit by the ray between 0 and maxDistance, both sides
+		// of the triangles being considered
+		bool Raycast(Ray const& ray, RayHit& hit, float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+		// Appends the indices of the triangles whose bounds intersect the volume
+		void Query(AABB const& box, std::vector<uint32_t>& triangles) const;
+		void Query(Frustum const& frustum, std::vector<uint32_t>& triangles) const;
+
+		std::span<Node const> GetNodes() const;
+		AABB GetBounds() const;
+		size_t GetTriangleCount() const;
+
+	private:
+		void AppendTriangles(Node const& leaf, std::vector<uint32_t>& triangles) const;
+
+	private:
+		std::vector<Node> _nodes {};
+		std::vector<Vector3> _vertices {};   // 3 per triangle, in the order of the leaves
+		std::vector<uint32_t> _triangles {}; // Index in the source mesh of each triangle
+	};
+}
+
+#endif // BVH_HPP
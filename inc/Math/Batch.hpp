@@ -0,0 +1,53 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <span>
+#include <cstddef>
+#include <cassert>
+
+#include <Math/Vector.hpp>
+#include <Math/Matrix.hpp>
+
+namespace Math {
+	// Structure of arrays view over 3D vectors: x[i], y[i], z[i] form the i-th vector
+	template <typename T>
+	struct BasicVector3SoA {
+	public:
+		size_t size() const {
+			assert("All components must have the same count" && x.size() == y.size() && x.size() == z.size());
+			return x.size();
+		}
+
+	public:
+		std::span<T> x {};
+		std::span<T> y {};
+		std::span<T> z {};
+	};
+
+	using Vector3SoA = BasicVector3SoA<float>;
+	using ConstVector3SoA = BasicVector3SoA<float const>;
+
+	// All the batch functions below use column vectors (result = m * v), like
+	// Matrix4x4 * Vector4. Inputs and outputs must have the same size and may be
+	// the same array. With threadCount > 1 the range is split between threads;
+	// it is only worth it for several thousands of elements.
+
+	// result[i] = (m * Vector4(points[i], 1)).xyz
+	void TransformPoints(Matrix4x4 const& m, std::span<Vector3 const> points, std::span<Vector3> result, unsigned threadCount = 1);
+	void TransformPoints(Matrix4x4 const& m, ConstVector3SoA points, Vector3SoA result, unsigned threadCount = 1);
+
+	// result[i] = (m * Vector4(directions[i], 0)).xyz
+	void TransformDirections(Matrix4x4 const& m, std::span<Vector3 const> directions, std::span<Vector3> result, unsigned threadCount = 1);
+	void TransformDirections(Matrix4x4 const& m, ConstVector3SoA directions, Vector3SoA result, unsigned threadCount = 1);
+
+	// result[i] = m * vectors[i]
+	void TransformVectors(Matrix4x4 const& m, std::span<Vector4 const> vectors, std::span<Vector4> result, unsigned threadCount = 1);
+
+	// result[i] = lhs * rhs[i], e.g. viewProjection * model for each instance
+	void MultiplyMatrices(Matrix4x4 const& lhs, std::span<Matrix4x4 const> rhs, std::span<Matrix4x4> result, unsigned threadCount = 1);
+
+	// result[i] = lhs[i] * rhs[i]
+	void MultiplyMatrices(std::span<Matrix4x4 const> lhs, std::span<Matrix4x4 const> rhs, std::span<Matrix4x4> result, unsigned threadCount = 1);
+}
+
+#endif // BATCH_HPP
@@ -0,0 +1,332 @@
+#ifndef BOUNDS_HPP
+#define BOUNDS_HPP
+
+#include <iostream>
+#include <cmath>
+#include <span>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+
+#include <Math/Vector.hpp>
+#include <Math/Matrix.hpp>
+
+namespace Math {
+	// Axis-aligned bounding box given by its minimum and maximum corners
+	template <typename T>
+	struct BasicAABB {
+	public:
+		friend constexpr bool operator==(BasicAABB const& lhs, BasicAABB const& rhs) {
+			return lhs.min == rhs.min && lhs.max == rhs.max;
+		}
+
+		friend constexpr bool operator!=(BasicAABB const& lhs, BasicAABB const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, BasicAABB const& box) {
+			return out << "{ " << box.min << ", " << box.max << " }";
+		}
+
+		static constexpr BasicAABB FromPoints(std::span<Vector<3, T> const> points);
+		static constexpr BasicAABB Merge(BasicAABB const& lhs, BasicAABB const& rhs);
+
+		// Box enclosing the given box once transformed by an affine matrix
+		static constexpr BasicAABB Transform(Matrix<4, 4, T> const& m, BasicAABB const& box);
+
+		constexpr Vector<3, T> Center() const;
+		constexpr Vector<3, T> Extents() const; // Half of the size on each axis
+		constexpr bool Contains(Vector<3, T> const& point) const;
+		constexpr bool Intersects(BasicAABB const& box) const;
+
+	public:
+		Vector<3, T> min {};
+		Vector<3, T> max {};
+	};
+
+	template <typename T>
+	struct BasicBoundingSphere {
+	public:
+		friend constexpr bool operator==(BasicBoundingSphere const& lhs, BasicBoundingSphere const& rhs) {
+			return lhs.center == rhs.center && lhs.radius == rhs.radius;
+		}
+
+		friend constexpr bool operator!=(BasicBoundingSphere const& lhs, BasicBoundingSphere const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, BasicBoundingSphere const& sphere) {
+			return out << "{ " << sphere.center << ", " << sphere.radius << " }";
+		}
+
+		// Centered on the bounding box of the points, not the smallest sphere
+		static BasicBoundingSphere FromPoints(std::span<Vector<3, T> const> points);
+		static BasicBoundingSphere FromAABB(BasicAABB<T> const& box);
+
+		// Sphere enclosing the given sphere once transformed by an affine matrix,
+		// the radius is scaled by the largest scale of the matrix
+		static BasicBoundingSphere Transform(Matrix<4, 4, T> const& m, BasicBoundingSphere const& sphere);
+
+		constexpr bool Contains(Vector<3, T> const& point) const;
+
+	public:
+		Vector<3, T> center {};
+		T radius {};
+	};
+
+	// Volume seen through a view-projection matrix, as 6 planes (a, b, c, d)
+	// whose normals point inside: a point p is inside a plane if
+	// a * p.x + b * p.y + c * p.z + d >= 0.
+	template <typename T>
+	class BasicFrustum {
+	public:
+		// Near and Far are swapped for a reversed-Z projection, which does not
+		// change the volume. The far plane of an infinite projection is (0, 0, 0, near).
+		enum Plane : size_t {
+			Left,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far
+		};
+
+		constexpr BasicFrustum() = default;
+
+		// Planes of clip space (-w <= x <= w, -w <= y <= w, 0 <= z <= w) brought
+		// back to the space viewProjection applies to, e.g. world space for
+		// projection * view
+		explicit BasicFrustum(Matrix<4, 4, T> const& viewProjection);
+
+		constexpr std::array<Vector<4, T>, 6> const& GetPlanes() const;
+
+		constexpr bool Contains(Vector<3, T> const& point) const;
+		constexpr bool Contains(BasicAABB<T> const& box) const;
+
+		// These tests are conservative: bounds crossing the planes next to a
+		// corner of the frustum may be reported as intersecting while outside
+		constexpr bool Intersects(BasicAABB<T> const& box) const;
+		constexpr bool Intersects(BasicBoundingSphere<T> const& sphere) const;
+
+	private:
+		std::array<Vector<4, T>, 6> _planes {};
+	};
+
+	// MARK: AABB
+	template <typename T>
+	constexpr BasicAABB<T> BasicAABB<T>::FromPoints(std::span<Vector<3, T> const> points) {
+		assert("At least one point is needed to compute the bounds" && !points.empty());
+
+		BasicAABB result { points[0], points[0] };
+		for (Vector<3, T> const& point : points.subspan(1)) {
+			for (size_t i = 0; i < 3; ++i) {
+				result.min[i] = std::min(result.min[i], point[i]);
+				result.max[i] = std::max(result.max[i], point[i]);
+			}
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	constexpr BasicAABB<T> BasicAABB<T>::Merge(BasicAABB const& lhs, BasicAABB const& rhs) {
+		BasicAABB result {};
+		for (size_t i = 0; i < 3; ++i) {
+			result.min[i] = std::min(lhs.min[i], rhs.min[i]);
+			result.max[i] = std::max(lhs.max[i], rhs.max[i]);
+		}
+
+		return result;
+	}
+
+	// Each axis of the result is the translation plus, for each term of the
+	// matrix line, the smallest and largest product with the box (Arvo, 1990)
+	template <typename T>
+	constexpr BasicAABB<T> BasicAABB<T>::Transform(Matrix<4, 4, T> const& m, BasicAABB const& box) {
+		BasicAABB result {};
+		for (int n = 0; n < 3; ++n) {
+			result.min[n] = m(n, 3);
+			result.max[n] = m(n, 3);
+
+			for (int k = 0; k < 3; ++k) {
+				T a = m(n, k) * box.min[k];
+				T b = m(n, k) * box.max[k];
+				result.min[n] += std::min(a, b);
+				result.max[n] += std::max(a, b);
+			}
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicAABB<T>::Center() const {
+		return (min + max) * T(0.5);
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicAABB<T>::Extents() const {
+		return (max - min) * T(0.5);
+	}
+
+	template <typename T>
+	constexpr bool BasicAABB<T>::Contains(Vector<3, T> const& point) const {
+		for (size_t i = 0; i < 3; ++i) {
+			if (point[i] < min[i] || point[i] > max[i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	constexpr bool BasicAABB<T>::Intersects(BasicAABB const& box) const {
+		for (size_t i = 0; i < 3; ++i) {
+			if (box.max[i] < min[i] || box.min[i] > max[i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// MARK: Bounding sphere
+	template <typename T>
+	inline BasicBoundingSphere<T> BasicBoundingSphere<T>::FromPoints(std::span<Vector<3, T> const> points) {
+		BasicBoundingSphere result {};
+		result.center = BasicAABB<T>::FromPoints(points).Center();
+
+		T squaredRadius = T(0);
+		for (Vector<3, T> const& point : points) {
+			Vector<3, T> offset = point - result.center;
+			squaredRadius = std::max(squaredRadius, Vector<3, T>::Dot(offset, offset));
+		}
+
+		result.radius = std::sqrt(squaredRadius);
+		return result;
+	}
+
+	template <typename T>
+	inline BasicBoundingSphere<T> BasicBoundingSphere<T>::FromAABB(BasicAABB<T> const& box) {
+		return BasicBoundingSphere { box.Center(), Vector<3, T>::Magnitude(box.Extents()) };
+	}
+
+	template <typename T>
+	inline BasicBoundingSphere<T> BasicBoundingSphere<T>::Transform(Matrix<4, 4, T> const& m, BasicBoundingSphere const& sphere) {
+		T squaredScale = T(0);
+		for (int k = 0; k < 3; ++k) {
+			squaredScale = std::max(squaredScale, m(0, k) * m(0, k) + m(1, k) * m(1, k) + m(2, k) * m(2, k));
+		}
+
+		Vector<4, T> center = m * Vector<4, T>(sphere.center, T(1));
+		return BasicBoundingSphere { Vector<3, T>(center.x, center.y, center.z), sphere.radius * std::sqrt(squaredScale) };
+	}
+
+	template <typename T>
+	constexpr bool BasicBoundingSphere<T>::Contains(Vector<3, T> const& point) const {
+		Vector<3, T> offset = point - center;
+		return Vector<3, T>::Dot(offset, offset) <= radius * radius;
+	}
+
+	// MARK: Frustum
+	template <typename T>
+	BasicFrustum<T>::BasicFrustum(Matrix<4, 4, T> const& viewProjection) {
+		Vector<4, T> x = viewProjection.Line(0);
+		Vector<4, T> y = viewProjection.Line(1);
+		Vector<4, T> z = viewProjection.Line(2);
+		Vector<4, T> w = viewProjection.Line(3);
+
+		_planes[Left] = w + x;
+		_planes[Right] = w - x;
+		_planes[Bottom] = w + y;
+		_planes[Top] = w - y;
+		_planes[Near] = z;
+		_planes[Far] = w - z;
+
+		// Normalized so that the plane equation gives a distance, which the
+		// sphere test needs. The far plane of an infinite projection has no normal.
+		for (Vector<4, T>& plane : _planes) {
+			T magnitude = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (magnitude > T(0)) {
+				plane /= magnitude;
+			}
+		}
+	}
+
+	template <typename T>
+	constexpr std::array<Vector<4, T>, 6> const& BasicFrustum<T>::GetPlanes() const {
+		return _planes;
+	}
+
+	template <typename T>
+	constexpr bool BasicFrustum<T>::Contains(Vector<3, T> const& point) const {
+		for (Vector<4, T> const& plane : _planes) {
+			if (plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w < T(0)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// The box is inside a plane if its corner furthest against the normal is
+	template <typename T>
+	constexpr bool BasicFrustum<T>::Contains(BasicAABB<T> const& box) const {
+		Vector<3, T> center = box.Center();
+		Vector<3, T> extents = box.Extents();
+
+		for (Vector<4, T> const& plane : _planes) {
+			T distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			T radius = (plane.x < T(0) ? -plane.x : plane.x) * extents.x + (plane.y < T(0) ? -plane.y : plane.y) * extents.y + (plane.z < T(0) ? -plane.z : plane.z) * extents.z;
+			if (distance - radius < T(0)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// The box is outside a plane if its corner furthest along the normal is,
+	// that is if distance(center) + dot(|normal|, extents) < 0. The terms are
+	// summed in the same order as the batch culling in Culling.cpp.
+	template <typename T>
+	constexpr bool BasicFrustum<T>::Intersects(BasicAABB<T> const& box) const {
+		Vector<3, T> center = box.Center();
+		Vector<3, T> extents = box.Extents();
+
+		for (Vector<4, T> const& plane : _planes) {
+			T distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			T radius = (plane.x < T(0) ? -plane.x : plane.x) * extents.x + (plane.y < T(0) ? -plane.y : plane.y) * extents.y + (plane.z < T(0) ? -plane.z : plane.z) * extents.z;
+			if (distance + radius < T(0)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	constexpr bool BasicFrustum<T>::Intersects(BasicBoundingSphere<T> const& sphere) const {
+		for (Vector<4, T> const& plane : _planes) {
+			T distance = plane.x * sphere.center.x + plane.y * sphere.center.y + plane.z * sphere.center.z + plane.w;
+			if (distance + sphere.radius < T(0)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	using AABB = BasicAABB<float>;
+	using AABBd = BasicAABB<double>;
+
+	using BoundingSphere = BasicBoundingSphere<float>;
+	using BoundingSphered = BasicBoundingSphere<double>;
+
+	using Frustum = BasicFrustum<float>;
+	using Frustumd = BasicFrustum<double>;
+}
+
+#endif // BOUNDS_HPP
@@ -0,0 +1,29 @@
+#ifndef CULLING_HPP
+#define CULLING_HPP
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Math/Bounds.hpp>
+
+namespace Math {
+	// Batch versions of Frustum::Intersects, with the same results. The bounds
+	// are tested 8 at a time with the Simd backend; with threadCount > 1 the
+	// array is split between threads, which is worth it from about ten thousand
+	// bounds.
+
+	// visible[i] = frustum.Intersects(boxes[i]) ? 1 : 0
+	void CullBoxes(Frustum const& frustum, std::span<AABB const> boxes, std::span<uint8_t> visible, unsigned threadCount = 1);
+
+	// visible[i] = frustum.Intersects(spheres[i]) ? 1 : 0
+	void CullSpheres(Frustum const& frustum, std::span<BoundingSphere const> spheres, std::span<uint8_t> visible, unsigned threadCount = 1);
+
+	// Replaces the content of visibleIndices with the indices of the bounds
+	// intersecting the frustum, in increasing order. Returns their count.
+	size_t CullBoxes(Frustum const& frustum, std::span<AABB const> boxes, std::vector<uint32_t>& visibleIndices, unsigned threadCount = 1);
+	size_t CullSpheres(Frustum const& frustum, std::span<BoundingSphere const> spheres, std::vector<uint32_t>& visibleIndices, unsigned threadCount = 1);
+}
+
+#endif // CULLING_HPP
@@ -0,0 +1,40 @@
+#ifndef DEPTHPRECISION_HPP
+#define DEPTHPRECISION_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include <Math/Matrix.hpp>
+
+namespace Math {
+	// Storage of the depth buffer, named after wgpu::TextureFormat. Depth24Plus
+	// is assumed to be its worst case, a 24 bits normalized integer.
+	enum class DepthFormat {
+		Depth16Unorm,
+		Depth24Plus,
+		Depth32Float
+	};
+
+	// Value read back from a depth buffer of the given format after writing depth
+	float QuantizeDepth(float depth, DepthFormat format);
+
+	struct DepthPrecisionSample {
+	public:
+		double distance = 0.0;
+		double error = 0.0; // |reconstructed - distance| / distance
+	};
+
+	struct DepthPrecisionReport {
+	public:
+		std::vector<DepthPrecisionSample> samples {};
+		double maxError = 0.0;
+		double meanError = 0.0;
+	};
+
+	// Projects view-space distances spread logarithmically over [near, far] with
+	// float arithmetic like the GPU, stores the depth in the given format, then
+	// reconstructs the distance with the double precision inverse projection.
+	DepthPrecisionReport MeasureDepthPrecision(Matrix4x4 const& projection, DepthFormat format, float near, float far, size_t sampleCount = 256);
+}
+
+#endif // DEPTHPRECISION_HPP
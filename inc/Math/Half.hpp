@@ -0,0 +1,114 @@
+#ifndef HALF_HPP
+#define HALF_HPP
+
+#include <iostream>
+#include <cstdint>
+#include <bit>
+
+namespace Math {
+	// IEEE 754 binary16, used as a storage format only (GPU uploads of Float16x*
+	// vertex attributes, half-float textures). Arithmetic goes through float.
+	struct Half {
+	public:
+		constexpr Half() = default;
+		explicit constexpr Half(float value);
+
+		explicit constexpr operator float() const;
+
+		static constexpr Half FromBits(uint16_t bits);
+
+		friend constexpr bool operator==(Half const& lhs, Half const& rhs) {
+			return static_cast<float>(lhs) == static_cast<float>(rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, Half const& h) {
+			return out << static_cast<float>(h);
+		}
+
+	public:
+		uint16_t bits = 0;
+	};
+
+	// Rounds to nearest even, overflows to infinity and keeps NaN payloads quiet
+	constexpr Half::Half(float value) {
+		uint32_t floatBits = std::bit_cast<uint32_t>(value);
+		uint32_t sign = (floatBits >> 16) & 0x8000u;
+		uint32_t exponent = (floatBits >> 23) & 0xFFu;
+		uint32_t mantissa = floatBits & 0x7FFFFFu;
+
+		if (exponent == 0xFFu) {
+			bits = static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u | (mantissa >> 13) : 0u));
+			return;
+		}
+
+		int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+		if (halfExponent >= 0x1F) {
+			bits = static_cast<uint16_t>(sign | 0x7C00u);
+			return;
+		}
+
+		if (halfExponent <= 0) {
+			if (halfExponent < -10) {
+				bits = static_cast<uint16_t>(sign);
+				return;
+			}
+
+			// Subnormal half: shift the mantissa with its implicit leading one
+			mantissa |= 0x800000u;
+			uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+			uint32_t halfMantissa = mantissa >> shift;
+			uint32_t remainder = mantissa & ((1u << shift) - 1u);
+			uint32_t halfway = 1u << (shift - 1u);
+			if (remainder > halfway || (remainder == halfway && (halfMantissa & 1u) != 0)) {
+				++halfMantissa;
+			}
+
+			bits = static_cast<uint16_t>(sign | halfMantissa);
+			return;
+		}
+
+		// A carry out of the mantissa correctly bumps the exponent
+		uint32_t half = sign | (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+		uint32_t remainder = mantissa & 0x1FFFu;
+		if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0)) {
+			++half;
+		}
+
+		bits = static_cast<uint16_t>(half);
+	}
+
+	constexpr Half::operator float() const {
+		uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+		uint32_t exponent = (bits >> 10) & 0x1Fu;
+		uint32_t mantissa = bits & 0x3FFu;
+
+		if (exponent == 0x1Fu) {
+			return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+		}
+
+		if (exponent == 0) {
+			if (mantissa == 0) {
+				return std::bit_cast<float>(sign);
+			}
+
+			// Subnormal half: renormalize for float
+			uint32_t shift = 0;
+			while ((mantissa & 0x400u) == 0) {
+				mantissa <<= 1;
+				++shift;
+			}
+
+			return std::bit_cast<float>(sign | ((113u - shift) << 23) | ((mantissa & 0x3FFu) << 13));
+		}
+
+		return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+	}
+
+	constexpr Half Half::FromBits(uint16_t bits) {
+		Half h;
+		h.bits = bits;
+		return h;
+	}
+}
+
+#endif // HALF_HPP
@@ -4,15 +4,18 @@
 #include <cmath>
 #include <cstdint>
 
-#include <Math/Matrix3x3.hpp>
-#include <Math/Matrix4x4.hpp>
-#include <Math/Vector2.hpp>
-#include <Math/Vector3.hpp>
-#include <Math/Vector4.hpp>
+#include <Math/Matrix.hpp>
+#include <Math/Vector.hpp>
 
 namespace Math {
-	float Mix(float x, float y, float a);
-	uint32_t CeilToNextMultiple(uint32_t value, uint32_t step);
+	constexpr float Mix(float x, float y, float a) {
+		return x * (1.0f - a) + y * a;
+	}
+
+	constexpr uint32_t CeilToNextMultiple(uint32_t value, uint32_t step) {
+		uint32_t divideAndCeil = value / step + (value % step == 0 ? 0 : 1);
+		return step * divideAndCeil;
+	}
 }
 
 #endif // !MATH_CPP
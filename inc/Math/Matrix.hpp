@@ -0,0 +1,690 @@
+#ifndef MATRIX_HPP
+#define MATRIX_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <concepts>
+#include <limits>
+
+#include <Math/Vector.hpp>
+#include <Math/Simd.hpp>
+
+namespace Math {
+	// Row-major N x M matrix (N lines, M columns) transforming column vectors: v' = m * v.
+	// The 4x4 float specialization of the products goes through Math::Simd.
+	template <size_t N, size_t M, typename T>
+	class Matrix {
+	public:
+		using Scalar = T;
+		static constexpr size_t lines = N;
+		static constexpr size_t columns = M;
+
+		constexpr Matrix() = default;
+		constexpr Matrix(T cc) requires (N == M);
+
+		template <typename... Ts>
+			requires (N == M && N > 1 && sizeof...(Ts) == N && (std::convertible_to<Ts, T> && ...))
+		constexpr Matrix(Ts... diagonal);
+
+		template <typename... Ts>
+			requires (N * M > 1 && sizeof...(Ts) == N * M && (std::convertible_to<Ts, T> && ...))
+		constexpr Matrix(Ts... elements);
+
+		constexpr Matrix(Vector<M, T> const& xy1, Vector<M, T> const& xy2, bool columnMajor = false) requires (N == 2 && M == 2);
+		constexpr Matrix(Vector<M, T> const& xyz1, Vector<M, T> const& xyz2, Vector<M, T> const& xyz3, bool columnMajor = false) requires (N == 3 && M == 3);
+		constexpr Matrix(Vector<M, T> const& xyzw1, Vector<M, T> const& xyzw2, Vector<M, T> const& xyzw3, Vector<M, T> const& xyzw4, bool columnMajor = false) requires (N == 4 && M == 4);
+
+		// Conversion between scalar types, e.g. a double precision model matrix to float for the GPU
+		template <typename U>
+			requires (!std::is_same_v<T, U>)
+		explicit constexpr Matrix(Matrix<N, M, U> const& m);
+
+		constexpr Matrix(Matrix const& m) = default;
+
+		constexpr T& operator[](int index);
+		constexpr T const& operator[](int index) const;
+		constexpr T& operator()(int n, int m);
+		constexpr T const& operator()(int n, int m) const;
+
+		constexpr Matrix& operator=(Matrix const& m) = default;
+
+		friend constexpr bool operator==(Matrix const& lhs, Matrix const& rhs) {
+			for (size_t i = 0; i < N * M; ++i) {
+				if (!(lhs._elements[i] == rhs._elements[i])) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		friend constexpr bool operator!=(Matrix const& lhs, Matrix const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, Matrix const& m) {
+			for (size_t i = 0; i < N * M; i++) {
+				out << std::setprecision(4) << std::fixed << ((i != 0 && i % M == 0) ? "\n" : "") << m._elements[i] << " ";
+			}
+
+			return out;
+		}
+
+		friend constexpr Matrix operator+(Matrix const& lhs, Matrix const& rhs) {
+			Matrix result;
+			for (size_t i = 0; i < N * M; ++i) {
+				result._elements[i] = lhs._elements[i] + rhs._elements[i];
+			}
+
+			return result;
+		}
+
+		friend constexpr Matrix& operator+=(Matrix& lhs, Matrix const& rhs) {
+			lhs = lhs + rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Matrix operator-(Matrix const& m) {
+			Matrix result;
+			for (size_t i = 0; i < N * M; ++i) {
+				result._elements[i] = -m._elements[i];
+			}
+
+			return result;
+		}
+
+		friend constexpr Matrix operator-(Matrix const& lhs, Matrix const& rhs) {
+			return lhs + (-rhs);
+		}
+
+		friend constexpr Matrix& operator-=(Matrix& lhs, Matrix const& rhs) {
+			lhs = lhs - rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Matrix operator*(Matrix const& lhs, T const& rhs) {
+			Matrix result;
+			for (size_t i = 0; i < N * M; ++i) {
+				result._elements[i] = rhs * lhs._elements[i];
+			}
+
+			return result;
+		}
+
+		friend constexpr Matrix operator*(T const& lhs, Matrix const& rhs) {
+			return rhs * lhs;
+		}
+
+		// (N x M) * (M x K)
+		template <size_t K>
+		friend constexpr Matrix<N, K, T> operator*(Matrix const& lhs, Matrix<M, K, T> const& rhs) {
+			Matrix<N, K, T> result;
+			if constexpr (N == 4 && M == 4 && K == 4 && std::is_same_v<T, float>) {
+				if (std::is_constant_evaluated()) {
+					Simd::MultiplyMatrix4<Simd::ScalarFloat4>(&lhs[0], &rhs[0], &result[0]);
+				}
+				else {
+					Simd::MultiplyMatrix4(&lhs[0], &rhs[0], &result[0]);
+				}
+			}
+			else {
+				// Same accumulation order as Vector::Dot(lhs.Line(n), rhs.Column(k))
+				for (size_t n = 0; n < N; ++n) {
+					for (size_t k = 0; k < K; ++k) {
+						T sum = lhs._elements[n * M] * rhs(0, static_cast<int>(k));
+						for (size_t m = 1; m < M; ++m) {
+							sum += lhs._elements[n * M + m] * rhs(static_cast<int>(m), static_cast<int>(k));
+						}
+						result(static_cast<int>(n), static_cast<int>(k)) = sum;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		friend constexpr Vector<N, T> operator*(Matrix const& lhs, Vector<M, T> const& rhs) {
+			Vector<N, T> result;
+			for (size_t n = 0; n < N; ++n) {
+				result[n] = Vector<M, T>::Dot(lhs.Line(static_cast<int>(n)), rhs);
+			}
+
+			return result;
+		}
+
+		friend constexpr Matrix& operator*=(Matrix& lhs, T const& rhs) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Matrix& operator*=(Matrix& lhs, Matrix const& rhs) requires (N == M) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Matrix operator/(Matrix const& lhs, T const& rhs) {
+			T inversedRhs = T(1) / rhs;
+			Matrix result;
+			for (size_t i = 0; i < N * M; ++i) {
+				result._elements[i] = lhs._elements[i] * inversedRhs;
+			}
+
+			return result;
+		}
+
+		friend constexpr Matrix& operator/=(Matrix& lhs, T const& rhs) {
+			lhs = lhs / rhs;
+
+			return lhs;
+		}
+
+		static constexpr T Determinant(Matrix const& m) requires (N == M);
+		static constexpr Matrix Identity() requires (N == M);
+
+		static Matrix RotateX(T angle) requires (N == M && (N == 3 || N == 4));
+		static Matrix RotateY(T angle) requires (N == M && (N == 3 || N == 4));
+		static Matrix RotateZ(T angle) requires (N == M && (N == 3 || N == 4));
+
+		// Homogeneous translation, 2D for 3x3 and 3D for 4x4
+		template <typename... Ts>
+			requires (N == M && N >= 3 && sizeof...(Ts) == N - 1 && (std::convertible_to<Ts, T> && ...))
+		static constexpr Matrix Translate(Ts... t);
+
+		static constexpr Matrix Scale(T s) requires (N == M && N >= 3);
+
+		template <typename... Ts>
+			requires (N == M && N >= 3 && sizeof...(Ts) == N - 1 && (std::convertible_to<Ts, T> && ...))
+		static constexpr Matrix Scale(Ts... s);
+
+		// Left-handed projections to a [0, 1] depth range, or [1, 0] with reversedZ.
+		// far may be std::numeric_limits<T>::infinity() for the perspective ones.
+		static Matrix Perspective(T fov, T ratio, T near, T far, bool reversedZ = false) requires (N == 4 && M == 4);
+		static constexpr Matrix Frustum(T left, T right, T bottom, T top, T near, T far, bool reversedZ = false) requires (N == 4 && M == 4);
+		// ratio is width / height of a view 2 units high, like the one of Perspective
+		static constexpr Matrix Orthographic(T ratio, T near, T far, bool reversedZ = false) requires (N == 4 && M == 4);
+		static constexpr Matrix Orthographic(T width, T height, T near, T far, bool reversedZ = false) requires (N == 4 && M == 4);
+		static constexpr Matrix Orthographic(T left, T right, T bottom, T top, T near, T far, bool reversedZ = false) requires (N == 4 && M == 4);
+
+		// Closed-form inverse of any of the projections above
+		static constexpr Matrix InverseProjection(Matrix const& projection) requires (N == 4 && M == 4);
+
+		static Matrix LookAt(Vector<3, T> const& from, Vector<3, T> const& to, Vector<3, T> const& up) requires (N == 4 && M == 4);
+
+		static constexpr Matrix<M, N, T> Transpose(Matrix const& m);
+		static constexpr Matrix Inverse(Matrix const& m) requires (N == M);
+
+		constexpr Matrix& Transposed() requires (N == M);
+		constexpr Matrix& Inversed() requires (N == M);
+
+		constexpr Vector<M, T> Line(int n) const;
+		constexpr Vector<N, T> Column(int m) const;
+
+		constexpr Matrix<N - 1, M - 1, T> Submatrix(int i, int j) const requires (N == M && N > 1);
+		constexpr T Cofactor(int i, int j) const requires (N == M && N > 1);
+		constexpr Matrix CofactorMatrix() const requires (N == M && N > 1);
+
+	private:
+		// Depth line (0, 0, scale, offset) of the perspective projections
+		static constexpr void PerspectiveDepth(T near, T far, bool reversedZ, T& scale, T& offset) requires (N == 4 && M == 4);
+
+		// 16 bytes alignment lets the SIMD kernels work on whole lines
+		static constexpr size_t alignment = (N * M * sizeof(T)) % 16 == 0 ? 16 : alignof(T);
+
+		alignas(alignment) std::array<T, N * M> _elements {};
+	};
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>::Matrix(T cc) requires (N == M) {
+		for (size_t i = 0; i < N; ++i) {
+			_elements[i * N + i] = cc;
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	template <typename... Ts>
+		requires (N == M && N > 1 && sizeof...(Ts) == N && (std::convertible_to<Ts, T> && ...))
+	constexpr Matrix<N, M, T>::Matrix(Ts... diagonal) {
+		size_t i = 0;
+		((_elements[i * N + i] = static_cast<T>(diagonal), ++i), ...);
+	}
+
+	template <size_t N, size_t M, typename T>
+	template <typename... Ts>
+		requires (N * M > 1 && sizeof...(Ts) == N * M && (std::convertible_to<Ts, T> && ...))
+	constexpr Matrix<N, M, T>::Matrix(Ts... elements)
+		: _elements { static_cast<T>(elements)... } {
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>::Matrix(Vector<M, T> const& xy1, Vector<M, T> const& xy2, bool columnMajor) requires (N == 2 && M == 2) {
+		Vector<M, T> const* lines[] = { &xy1, &xy2 };
+		for (size_t n = 0; n < N; ++n) {
+			for (size_t m = 0; m < M; ++m) {
+				_elements[columnMajor ? m * N + n : n * M + m] = (*lines[n])[m];
+			}
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>::Matrix(Vector<M, T> const& xyz1, Vector<M, T> const& xyz2, Vector<M, T> const& xyz3, bool columnMajor) requires (N == 3 && M == 3) {
+		Vector<M, T> const* lines[] = { &xyz1, &xyz2, &xyz3 };
+		for (size_t n = 0; n < N; ++n) {
+			for (size_t m = 0; m < M; ++m) {
+				_elements[columnMajor ? m * N + n : n * M + m] = (*lines[n])[m];
+			}
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>::Matrix(Vector<M, T> const& xyzw1, Vector<M, T> const& xyzw2, Vector<M, T> const& xyzw3, Vector<M, T> const& xyzw4, bool columnMajor) requires (N == 4 && M == 4) {
+		Vector<M, T> const* lines[] = { &xyzw1, &xyzw2, &xyzw3, &xyzw4 };
+		for (size_t n = 0; n < N; ++n) {
+			for (size_t m = 0; m < M; ++m) {
+				_elements[columnMajor ? m * N + n : n * M + m] = (*lines[n])[m];
+			}
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	template <typename U>
+		requires (!std::is_same_v<T, U>)
+	constexpr Matrix<N, M, T>::Matrix(Matrix<N, M, U> const& m) {
+		for (size_t i = 0; i < N * M; ++i) {
+			_elements[i] = static_cast<T>(m[static_cast<int>(i)]);
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T& Matrix<N, M, T>::operator[](int index) {
+		assert("Index must be in the bounds of the matrix" && index >= 0 && static_cast<size_t>(index) < N * M);
+
+		return _elements[index];
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T const& Matrix<N, M, T>::operator[](int index) const {
+		assert("Index must be in the bounds of the matrix" && index >= 0 && static_cast<size_t>(index) < N * M);
+
+		return _elements[index];
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T& Matrix<N, M, T>::operator()(int n, int m) {
+		assert("Indices must be in the bounds of the matrix" && n >= 0 && static_cast<size_t>(n) < N && m >= 0 && static_cast<size_t>(m) < M);
+
+		return _elements[n * M + m];
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T const& Matrix<N, M, T>::operator()(int n, int m) const {
+		assert("Indices must be in the bounds of the matrix" && n >= 0 && static_cast<size_t>(n) < N && m >= 0 && static_cast<size_t>(m) < M);
+
+		return _elements[n * M + m];
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T Matrix<N, M, T>::Determinant(Matrix const& m) requires (N == M) {
+		if constexpr (N == 1) {
+			return m[0];
+		}
+		else if constexpr (N == 2) {
+			return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+		}
+		else {
+			// Cofactor expansion along the first line
+			T result = m(0, 0) * Matrix<N - 1, N - 1, T>::Determinant(m.Submatrix(0, 0));
+			for (int j = 1; j < static_cast<int>(N); ++j) {
+				T term = m(0, j) * Matrix<N - 1, N - 1, T>::Determinant(m.Submatrix(0, j));
+				result = (j % 2 == 0) ? result + term : result - term;
+			}
+
+			return result;
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Identity() requires (N == M) {
+		return Matrix(T(1));
+	}
+
+	template <size_t N, size_t M, typename T>
+	inline Matrix<N, M, T> Matrix<N, M, T>::RotateX(T angle) requires (N == M && (N == 3 || N == 4)) {
+		T c = std::cos(angle);
+		T s = std::sin(angle);
+
+		Matrix result(T(1));
+		result(1, 1) = c;
+		result(1, 2) = -s;
+		result(2, 1) = s;
+		result(2, 2) = c;
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	inline Matrix<N, M, T> Matrix<N, M, T>::RotateY(T angle) requires (N == M && (N == 3 || N == 4)) {
+		T c = std::cos(angle);
+		T s = std::sin(angle);
+
+		Matrix result(T(1));
+		result(0, 0) = c;
+		result(0, 2) = s;
+		result(2, 0) = -s;
+		result(2, 2) = c;
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	inline Matrix<N, M, T> Matrix<N, M, T>::RotateZ(T angle) requires (N == M && (N == 3 || N == 4)) {
+		T c = std::cos(angle);
+		T s = std::sin(angle);
+
+		Matrix result(T(1));
+		result(0, 0) = c;
+		result(0, 1) = -s;
+		result(1, 0) = s;
+		result(1, 1) = c;
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	template <typename... Ts>
+		requires (N == M && N >= 3 && sizeof...(Ts) == N - 1 && (std::convertible_to<Ts, T> && ...))
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Translate(Ts... t) {
+		Matrix result(T(1));
+		int n = 0;
+		((result(n++, static_cast<int>(N) - 1) = static_cast<T>(t)), ...);
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Scale(T s) requires (N == M && N >= 3) {
+		Matrix result(s);
+		result(N - 1, N - 1) = T(1);
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	template <typename... Ts>
+		requires (N == M && N >= 3 && sizeof...(Ts) == N - 1 && (std::convertible_to<Ts, T> && ...))
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Scale(Ts... s) {
+		return Matrix(static_cast<T>(s)..., T(1));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr void Matrix<N, M, T>::PerspectiveDepth(T near, T far, bool reversedZ, T& scale, T& offset) requires (N == 4 && M == 4) {
+		assert("Near plane must be in front of the camera and before the far plane" && near > T(0) && far > near);
+
+		// depth = scale + offset / z
+		if (far == std::numeric_limits<T>::infinity()) {
+			scale = reversedZ ? T(0) : T(1);
+			offset = reversedZ ? near : -near;
+		}
+		else {
+			T divider = T(1) / (far - near);
+			scale = reversedZ ? -near * divider : far * divider;
+			offset = reversedZ ? far * near * divider : -far * near * divider;
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	inline Matrix<N, M, T> Matrix<N, M, T>::Perspective(T fov, T ratio, T near, T far, bool reversedZ) requires (N == 4 && M == 4) {
+		T focalLength = T(1) / std::tan(fov / T(2));
+		T scale {};
+		T offset {};
+		PerspectiveDepth(near, far, reversedZ, scale, offset);
+
+		return Matrix(
+			focalLength / ratio, T(0), T(0), T(0),
+			T(0), focalLength, T(0), T(0),
+			T(0), T(0), scale, offset,
+			T(0), T(0), T(1), T(0));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Frustum(T left, T right, T bottom, T top, T near, T far, bool reversedZ) requires (N == 4 && M == 4) {
+		T scale {};
+		T offset {};
+		PerspectiveDepth(near, far, reversedZ, scale, offset);
+
+		T width = T(1) / (right - left);
+		T height = T(1) / (top - bottom);
+		return Matrix(
+			T(2) * near * width, T(0), -(right + left) * width, T(0),
+			T(0), T(2) * near * height, -(top + bottom) * height, T(0),
+			T(0), T(0), scale, offset,
+			T(0), T(0), T(1), T(0));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Orthographic(T ratio, T near, T far, bool reversedZ) requires (N == 4 && M == 4) {
+		return Orthographic(-ratio, ratio, -T(1), T(1), near, far, reversedZ);
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Orthographic(T width, T height, T near, T far, bool reversedZ) requires (N == 4 && M == 4) {
+		return Orthographic(-width / T(2), width / T(2), -height / T(2), height / T(2), near, far, reversedZ);
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Orthographic(T left, T right, T bottom, T top, T near, T far, bool reversedZ) requires (N == 4 && M == 4) {
+		assert("Near and far planes must be distinct and finite" && far != near && far != std::numeric_limits<T>::infinity());
+
+		T width = T(1) / (right - left);
+		T height = T(1) / (top - bottom);
+		T depth = T(1) / (far - near);
+		return Matrix(
+			T(2) * width, T(0), T(0), -(right + left) * width,
+			T(0), T(2) * height, T(0), -(top + bottom) * height,
+			T(0), T(0), reversedZ ? -depth : depth, reversedZ ? far * depth : -near * depth,
+			T(0), T(0), T(0), T(1));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::InverseProjection(Matrix const& p) requires (N == 4 && M == 4) {
+		T inversedX = T(1) / p(0, 0);
+		T inversedY = T(1) / p(1, 1);
+
+		// Perspective: (x, y, z, w) = (a x + c z, b y + d z, A z + B, z)
+		if (p(3, 3) == T(0)) {
+			assert("Matrix must be a perspective projection" && p(3, 2) == T(1) && p(2, 3) != T(0));
+
+			T inversedOffset = T(1) / p(2, 3);
+			return Matrix(
+				inversedX, T(0), T(0), -p(0, 2) * inversedX,
+				T(0), inversedY, T(0), -p(1, 2) * inversedY,
+				T(0), T(0), T(0), T(1),
+				T(0), T(0), inversedOffset, -p(2, 2) * inversedOffset);
+		}
+
+		// Orthographic: (x, y, z, w) = (a x + c, b y + d, A z + B, 1)
+		assert("Matrix must be an orthographic projection" && p(3, 3) == T(1) && p(2, 2) != T(0));
+
+		T inversedDepth = T(1) / p(2, 2);
+		return Matrix(
+			inversedX, T(0), T(0), -p(0, 3) * inversedX,
+			T(0), inversedY, T(0), -p(1, 3) * inversedY,
+			T(0), T(0), inversedDepth, -p(2, 3) * inversedDepth,
+			T(0), T(0), T(0), T(1));
+	}
+
+	template <size_t N, size_t M, typename T>
+	inline Matrix<N, M, T> Matrix<N, M, T>::LookAt(Vector<3, T> const& from, Vector<3, T> const& to, Vector<3, T> const& upDirection) requires (N == 4 && M == 4) {
+		using Vector3 = Vector<3, T>;
+
+		Vector3 forward = Vector3::Normalize(to - from);
+		Vector3 right = Vector3::Normalize(Vector3::Cross(upDirection, forward));
+		Vector3 up = Vector3::Cross(forward, right);
+
+		Vector3 translation(
+			-Vector3::Dot(right, from),
+			-Vector3::Dot(up, from),
+			-Vector3::Dot(forward, from));
+
+		return Matrix(
+			right.x, right.y, right.z, translation.x,
+			up.x, up.y, up.z, translation.y,
+			forward.x, forward.y, forward.z, translation.z,
+			T(0), T(0), T(0), T(1));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<M, N, T> Matrix<N, M, T>::Transpose(Matrix const& m) {
+		Matrix<M, N, T> result;
+		if constexpr (N == 4 && M == 4 && std::is_same_v<T, float>) {
+			if (std::is_constant_evaluated()) {
+				Simd::TransposeMatrix4<Simd::ScalarFloat4>(&m[0], &result[0]);
+			}
+			else {
+				Simd::TransposeMatrix4(&m[0], &result[0]);
+			}
+		}
+		else {
+			for (int n = 0; n < static_cast<int>(N); ++n) {
+				for (int j = 0; j < static_cast<int>(M); ++j) {
+					result(j, n) = m(n, j);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::Inverse(Matrix const& m) requires (N == M) {
+		if constexpr (N == 4 && std::is_same_v<T, float>) {
+			Matrix result;
+			float det = 0.0f;
+			if (std::is_constant_evaluated()) {
+				det = Simd::InverseMatrix4<Simd::ScalarFloat4>(&m[0], &result[0]);
+			}
+			else {
+				det = Simd::InverseMatrix4(&m[0], &result[0]);
+			}
+			assert("Matrix is not invertible" && det != 0.0f);
+			(void) det;
+
+			return result;
+		}
+		else if constexpr (N == 1) {
+			assert("Matrix is not invertible" && m[0] != T(0));
+
+			return Matrix(T(1) / m[0]);
+		}
+		else if constexpr (N == 2) {
+			T det = Determinant(m);
+			assert("Matrix is not invertible" && det != T(0));
+
+			return Matrix(
+				m(1, 1) / det, -m(0, 1) / det,
+				-m(1, 0) / det, m(0, 0) / det);
+		}
+		else {
+			T det = Determinant(m);
+			assert("Matrix is not invertible" && det != T(0));
+
+			return Transpose(m.CofactorMatrix()) / det;
+		}
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>& Matrix<N, M, T>::Transposed() requires (N == M) {
+		*this = Transpose(*this);
+
+		return *this;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T>& Matrix<N, M, T>::Inversed() requires (N == M) {
+		_elements = Inverse(*this)._elements;
+
+		return *this;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Vector<M, T> Matrix<N, M, T>::Line(int n) const {
+		assert("Indices must be in the bounds of the matrix" && n >= 0 && static_cast<size_t>(n) < N);
+
+		Vector<M, T> line;
+		for (size_t m = 0; m < M; ++m) {
+			line[m] = _elements[n * M + m];
+		}
+
+		return line;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Vector<N, T> Matrix<N, M, T>::Column(int m) const {
+		assert("Indices must be in the bounds of the matrix" && m >= 0 && static_cast<size_t>(m) < M);
+
+		Vector<N, T> column;
+		for (size_t n = 0; n < N; ++n) {
+			column[n] = _elements[n * M + m];
+		}
+
+		return column;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N - 1, M - 1, T> Matrix<N, M, T>::Submatrix(int i, int j) const requires (N == M && N > 1) {
+		assert("Indices must be in the bounds of the matrix" && i >= 0 && static_cast<size_t>(i) < N && j >= 0 && static_cast<size_t>(j) < M);
+
+		Matrix<N - 1, M - 1, T> sub;
+		int index = 0;
+
+		for (int row = 0; row < static_cast<int>(N); ++row) {
+			if (row == i)
+				continue;
+			for (int col = 0; col < static_cast<int>(M); ++col) {
+				if (col == j)
+					continue;
+				sub[index++] = (*this)(row, col);
+			}
+		}
+
+		return sub;
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr T Matrix<N, M, T>::Cofactor(int i, int j) const requires (N == M && N > 1) {
+		assert("Indices must be in the bounds of the matrix" && i >= 0 && static_cast<size_t>(i) < N && j >= 0 && static_cast<size_t>(j) < M);
+
+		return ((i + j) % 2 == 0 ? T(1) : T(-1)) * Matrix<N - 1, M - 1, T>::Determinant(Submatrix(i, j));
+	}
+
+	template <size_t N, size_t M, typename T>
+	constexpr Matrix<N, M, T> Matrix<N, M, T>::CofactorMatrix() const requires (N == M && N > 1) {
+		Matrix cofactor;
+
+		for (int i = 0; i < static_cast<int>(N); ++i) {
+			for (int j = 0; j < static_cast<int>(M); ++j) {
+				cofactor(i, j) = Cofactor(i, j);
+			}
+		}
+
+		return cofactor;
+	}
+
+	using Matrix2x2 = Matrix<2, 2, float>;
+	using Matrix3x3 = Matrix<3, 3, float>;
+	using Matrix4x4 = Matrix<4, 4, float>;
+
+	using Matrix2x2d = Matrix<2, 2, double>;
+	using Matrix3x3d = Matrix<3, 3, double>;
+	using Matrix4x4d = Matrix<4, 4, double>;
+}
+
+#endif // MATRIX_HPP
@@ -0,0 +1,37 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace Math {
+	// Calls function(begin, end) on chunks of [0, count) spread over threadCount
+	// threads, the calling thread taking the first chunk. Chunk boundaries are
+	// multiples of blockSize so that only the last chunk has a partial block.
+	template <size_t blockSize = 4, typename Function>
+	void ParallelFor(size_t count, unsigned threadCount, Function&& function) {
+		size_t chunkCount = std::clamp<size_t>(threadCount, 1, std::max<size_t>((count + blockSize - 1) / blockSize, 1));
+		if (chunkCount <= 1) {
+			function(size_t(0), count);
+			return;
+		}
+
+		size_t chunkSize = ((count + chunkCount - 1) / chunkCount + blockSize - 1) / blockSize * blockSize;
+
+		std::vector<std::thread> workers {};
+		workers.reserve(chunkCount - 1);
+		for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+			workers.emplace_back(function, begin, std::min(begin + chunkSize, count));
+		}
+
+		function(size_t(0), std::min(chunkSize, count));
+
+		for (auto& worker : workers) {
+			worker.join();
+		}
+	}
+}
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,464 @@
+#ifndef QUATERNION_HPP
+#define QUATERNION_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cassert>
+#include <type_traits>
+
+#include <Math/Vector.hpp>
+#include <Math/Matrix.hpp>
+#include <Math/Simd.hpp>
+
+namespace Math {
+	// Rotation quaternion x i + y j + z k + w. Composition follows the matrices:
+	// (a * b).Rotate(v) == a.Rotate(b.Rotate(v)), and ToMatrix4x4() of a product is
+	// the product of the matrices.
+	template <typename T>
+	struct BasicQuaternion {
+	public:
+		constexpr BasicQuaternion() = default;
+		constexpr BasicQuaternion(T x, T y, T z, T w);
+		constexpr BasicQuaternion(Vector<3, T> const& xyz, T w);
+
+		template <typename U>
+			requires (!std::is_same_v<T, U>)
+		explicit constexpr BasicQuaternion(BasicQuaternion<U> const& q);
+
+		friend constexpr bool operator==(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+			return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w;
+		}
+
+		friend constexpr bool operator!=(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, BasicQuaternion const& q) {
+			return out << std::setprecision(4) << std::fixed << "[" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << "]";
+		}
+
+		friend constexpr BasicQuaternion operator+(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+			return BasicQuaternion(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
+		}
+
+		friend constexpr BasicQuaternion operator-(BasicQuaternion const& q) {
+			return BasicQuaternion(-q.x, -q.y, -q.z, -q.w);
+		}
+
+		friend constexpr BasicQuaternion operator-(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+			return lhs + (-rhs);
+		}
+
+		friend constexpr BasicQuaternion operator*(BasicQuaternion const& lhs, T const& rhs) {
+			return BasicQuaternion(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs);
+		}
+
+		friend constexpr BasicQuaternion operator*(T const& lhs, BasicQuaternion const& rhs) {
+			return rhs * lhs;
+		}
+
+		friend constexpr BasicQuaternion operator*(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+			if constexpr (std::is_same_v<T, float>) {
+				if (!std::is_constant_evaluated()) {
+					float a[4] = { lhs.x, lhs.y, lhs.z, lhs.w };
+					float b[4] = { rhs.x, rhs.y, rhs.z, rhs.w };
+					float result[4];
+					Simd::MultiplyQuaternion(a, b, result);
+
+					return BasicQuaternion(result[0], result[1], result[2], result[3]);
+				}
+			}
+
+			// Same order of the terms as the Simd kernel
+			return BasicQuaternion(
+				lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+				lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+				lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,
+				lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z);
+		}
+
+		friend constexpr BasicQuaternion& operator*=(BasicQuaternion& lhs, BasicQuaternion const& rhs) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Vector<3, T> operator*(BasicQuaternion const& lhs, Vector<3, T> const& rhs) {
+			return lhs.Rotate(rhs);
+		}
+
+		static constexpr BasicQuaternion Identity();
+
+		// The axis must be normalized
+		static BasicQuaternion AxisAngle(Vector<3, T> const& axis, T angle);
+		static BasicQuaternion RotateX(T angle);
+		static BasicQuaternion RotateY(T angle);
+		static BasicQuaternion RotateZ(T angle);
+
+		// The matrix must be a pure rotation
+		static BasicQuaternion FromMatrix(Matrix<3, 3, T> const& m);
+
+		static constexpr T Dot(BasicQuaternion const& lhs, BasicQuaternion const& rhs);
+		static T Magnitude(BasicQuaternion const& q);
+		static BasicQuaternion Normalize(BasicQuaternion const& q);
+		static constexpr BasicQuaternion Conjugate(BasicQuaternion const& q);
+		static constexpr BasicQuaternion Inverse(BasicQuaternion const& q);
+
+		// Interpolations along the shortest arc between two unit quaternions.
+		// Nlerp does not have a constant angular velocity, FastSlerp corrects t
+		// with a polynomial fit so that it does within 1e-3 rad, Slerp is exact.
+		static BasicQuaternion Nlerp(BasicQuaternion const& from, BasicQuaternion const& to, T t);
+		static BasicQuaternion FastSlerp(BasicQuaternion const& from, BasicQuaternion const& to, T t);
+		static BasicQuaternion Slerp(BasicQuaternion const& from, BasicQuaternion const& to, T t);
+
+		[[nodiscard]] BasicQuaternion& Normalized();
+
+		// Only valid for unit quaternions
+		constexpr Vector<3, T> Rotate(Vector<3, T> const& v) const;
+		constexpr Matrix<3, 3, T> ToMatrix3x3() const;
+		constexpr Matrix<4, 4, T> ToMatrix4x4() const;
+
+	public:
+		T x = T(0);
+		T y = T(0);
+		T z = T(0);
+		T w = T(1);
+	};
+
+	template <typename T>
+	constexpr BasicQuaternion<T>::BasicQuaternion(T x, T y, T z, T w)
+		: x(x), y(y), z(z), w(w) {
+	}
+
+	template <typename T>
+	constexpr BasicQuaternion<T>::BasicQuaternion(Vector<3, T> const& xyz, T w)
+		: x(xyz.x), y(xyz.y), z(xyz.z), w(w) {
+	}
+
+	template <typename T>
+	template <typename U>
+		requires (!std::is_same_v<T, U>)
+	constexpr BasicQuaternion<T>::BasicQuaternion(BasicQuaternion<U> const& q)
+		: x(static_cast<T>(q.x)), y(static_cast<T>(q.y)), z(static_cast<T>(q.z)), w(static_cast<T>(q.w)) {
+	}
+
+	template <typename T>
+	constexpr BasicQuaternion<T> BasicQuaternion<T>::Identity() {
+		return BasicQuaternion(T(0), T(0), T(0), T(1));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::AxisAngle(Vector<3, T> const& axis, T angle) {
+		T s = std::sin(angle / T(2));
+		T c = std::cos(angle / T(2));
+
+		return BasicQuaternion(axis * s, c);
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::RotateX(T angle) {
+		return BasicQuaternion(std::sin(angle / T(2)), T(0), T(0), std::cos(angle / T(2)));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::RotateY(T angle) {
+		return BasicQuaternion(T(0), std::sin(angle / T(2)), T(0), std::cos(angle / T(2)));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::RotateZ(T angle) {
+		return BasicQuaternion(T(0), T(0), std::sin(angle / T(2)), std::cos(angle / T(2)));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::FromMatrix(Matrix<3, 3, T> const& m) {
+		// Shepperd's method: extract the largest component first for stability
+		T trace = m(0, 0) + m(1, 1) + m(2, 2);
+		if (trace > T(0)) {
+			T s = T(2) * std::sqrt(T(1) + trace);
+			return BasicQuaternion((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, s / T(4));
+		}
+
+		if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+			T s = T(2) * std::sqrt(T(1) + m(0, 0) - m(1, 1) - m(2, 2));
+			return BasicQuaternion(s / T(4), (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+		}
+
+		if (m(1, 1) > m(2, 2)) {
+			T s = T(2) * std::sqrt(T(1) + m(1, 1) - m(0, 0) - m(2, 2));
+			return BasicQuaternion((m(0, 1) + m(1, 0)) / s, s / T(4), (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+		}
+
+		T s = T(2) * std::sqrt(T(1) + m(2, 2) - m(0, 0) - m(1, 1));
+		return BasicQuaternion((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, s / T(4), (m(1, 0) - m(0, 1)) / s);
+	}
+
+	template <typename T>
+	constexpr T BasicQuaternion<T>::Dot(BasicQuaternion const& lhs, BasicQuaternion const& rhs) {
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+	}
+
+	template <typename T>
+	inline T BasicQuaternion<T>::Magnitude(BasicQuaternion const& q) {
+		return std::sqrt(Dot(q, q));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::Normalize(BasicQuaternion const& q) {
+		T inversedMagnitude = T(1) / Magnitude(q);
+
+		return q * inversedMagnitude;
+	}
+
+	template <typename T>
+	constexpr BasicQuaternion<T> BasicQuaternion<T>::Conjugate(BasicQuaternion const& q) {
+		return BasicQuaternion(-q.x, -q.y, -q.z, q.w);
+	}
+
+	template <typename T>
+	constexpr BasicQuaternion<T> BasicQuaternion<T>::Inverse(BasicQuaternion const& q) {
+		T squaredMagnitude = Dot(q, q);
+		assert("Quaternion is not invertible" && squaredMagnitude != T(0));
+
+		return Conjugate(q) * (T(1) / squaredMagnitude);
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::Nlerp(BasicQuaternion const& from, BasicQuaternion const& to, T t) {
+		// q and -q are the same rotation, flip to go through the shortest arc
+		T sign = Dot(from, to) < T(0) ? T(-1) : T(1);
+
+		return Normalize(from * (T(1) - t) + to * (sign * t));
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::FastSlerp(BasicQuaternion const& from, BasicQuaternion const& to, T t) {
+		// Kapoulkine's fit of the slerp parameter as a function of cos(angle)
+		T d = std::abs(Dot(from, to));
+		T a = T(1.0904) + d * (T(-3.2452) + d * (T(3.55645) - d * T(1.43519)));
+		T b = T(0.848013) + d * (T(-1.06021) + d * T(0.215638));
+		T k = a * (t - T(0.5)) * (t - T(0.5)) + b;
+		T correctedT = t + t * (t - T(0.5)) * (t - T(1)) * k;
+
+		return Nlerp(from, to, correctedT);
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T> BasicQuaternion<T>::Slerp(BasicQuaternion const& from, BasicQuaternion const& to, T t) {
+		T cosAngle = Dot(from, to);
+		T sign = T(1);
+		if (cosAngle < T(0)) {
+			cosAngle = -cosAngle;
+			sign = T(-1);
+		}
+
+		// sin(angle) vanishes for close orientations, where nlerp is exact enough
+		if (cosAngle > T(0.9995)) {
+			return Nlerp(from, to, t);
+		}
+
+		T angle = std::acos(cosAngle);
+		T inversedSin = T(1) / std::sin(angle);
+		T fromWeight = std::sin((T(1) - t) * angle) * inversedSin;
+		T toWeight = std::sin(t * angle) * inversedSin * sign;
+
+		return from * fromWeight + to * toWeight;
+	}
+
+	template <typename T>
+	inline BasicQuaternion<T>& BasicQuaternion<T>::Normalized() {
+		*this = Normalize(*this);
+
+		return *this;
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicQuaternion<T>::Rotate(Vector<3, T> const& v) const {
+		// v + 2w (u x v) + 2 u x (u x v), cheaper than q v q*
+		Vector<3, T> u(x, y, z);
+		Vector<3, T> t = Vector<3, T>::Cross(u, v) * T(2);
+
+		return v + t * w + Vector<3, T>::Cross(u, t);
+	}
+
+	template <typename T>
+	constexpr Matrix<3, 3, T> BasicQuaternion<T>::ToMatrix3x3() const {
+		T xx = x * x, yy = y * y, zz = z * z;
+		T xy = x * y, xz = x * z, yz = y * z;
+		T wx = w * x, wy = w * y, wz = w * z;
+
+		return Matrix<3, 3, T>(
+			T(1) - T(2) * (yy + zz), T(2) * (xy - wz), T(2) * (xz + wy),
+			T(2) * (xy + wz), T(1) - T(2) * (xx + zz), T(2) * (yz - wx),
+			T(2) * (xz - wy), T(2) * (yz + wx), T(1) - T(2) * (xx + yy));
+	}
+
+	template <typename T>
+	constexpr Matrix<4, 4, T> BasicQuaternion<T>::ToMatrix4x4() const {
+		Matrix<3, 3, T> r = ToMatrix3x3();
+
+		return Matrix<4, 4, T>(
+			r(0, 0), r(0, 1), r(0, 2), T(0),
+			r(1, 0), r(1, 1), r(1, 2), T(0),
+			r(2, 0), r(2, 1), r(2, 2), T(0),
+			T(0), T(0), T(0), T(1));
+	}
+
+	// Rigid transform (rotation then translation) as real + dual * epsilon.
+	// Unlike a matrix, blending dual quaternions keeps the result rigid, which
+	// makes them the usual choice for skinning and for interpolating poses.
+	template <typename T>
+	struct BasicDualQuaternion {
+	public:
+		constexpr BasicDualQuaternion() = default;
+		constexpr BasicDualQuaternion(BasicQuaternion<T> const& real, BasicQuaternion<T> const& dual);
+
+		friend constexpr bool operator==(BasicDualQuaternion const& lhs, BasicDualQuaternion const& rhs) {
+			return lhs.real == rhs.real && lhs.dual == rhs.dual;
+		}
+
+		friend constexpr bool operator!=(BasicDualQuaternion const& lhs, BasicDualQuaternion const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, BasicDualQuaternion const& q) {
+			return out << q.real << " + " << q.dual << " e";
+		}
+
+		friend constexpr BasicDualQuaternion operator*(BasicDualQuaternion const& lhs, BasicDualQuaternion const& rhs) {
+			return BasicDualQuaternion(
+				lhs.real * rhs.real,
+				lhs.real * rhs.dual + lhs.dual * rhs.real);
+		}
+
+		friend constexpr BasicDualQuaternion& operator*=(BasicDualQuaternion& lhs, BasicDualQuaternion const& rhs) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		static constexpr BasicDualQuaternion Identity();
+		static constexpr BasicDualQuaternion FromRotation(BasicQuaternion<T> const& rotation);
+		static constexpr BasicDualQuaternion FromTranslation(Vector<3, T> const& translation);
+		static constexpr BasicDualQuaternion FromRotationTranslation(BasicQuaternion<T> const& rotation, Vector<3, T> const& translation);
+
+		static BasicDualQuaternion Normalize(BasicDualQuaternion const& q);
+		static constexpr BasicDualQuaternion Inverse(BasicDualQuaternion const& q);
+
+		// Dual quaternion linear blending along the shortest arc
+		static BasicDualQuaternion Nlerp(BasicDualQuaternion const& from, BasicDualQuaternion const& to, T t);
+
+		[[nodiscard]] BasicDualQuaternion& Normalized();
+
+		// Only valid for unit dual quaternions
+		constexpr BasicQuaternion<T> Rotation() const;
+		constexpr Vector<3, T> Translation() const;
+		constexpr Vector<3, T> TransformPoint(Vector<3, T> const& p) const;
+		constexpr Vector<3, T> TransformDirection(Vector<3, T> const& d) const;
+		constexpr Matrix<4, 4, T> ToMatrix4x4() const;
+
+	public:
+		BasicQuaternion<T> real {};
+		BasicQuaternion<T> dual { T(0), T(0), T(0), T(0) };
+	};
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T>::BasicDualQuaternion(BasicQuaternion<T> const& real, BasicQuaternion<T> const& dual)
+		: real(real), dual(dual) {
+	}
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T> BasicDualQuaternion<T>::Identity() {
+		return BasicDualQuaternion();
+	}
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T> BasicDualQuaternion<T>::FromRotation(BasicQuaternion<T> const& rotation) {
+		return BasicDualQuaternion(rotation, BasicQuaternion<T>(T(0), T(0), T(0), T(0)));
+	}
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T> BasicDualQuaternion<T>::FromTranslation(Vector<3, T> const& translation) {
+		return BasicDualQuaternion(BasicQuaternion<T>::Identity(), BasicQuaternion<T>(translation * T(0.5), T(0)));
+	}
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T> BasicDualQuaternion<T>::FromRotationTranslation(BasicQuaternion<T> const& rotation, Vector<3, T> const& translation) {
+		return BasicDualQuaternion(rotation, BasicQuaternion<T>(translation * T(0.5), T(0)) * rotation);
+	}
+
+	template <typename T>
+	inline BasicDualQuaternion<T> BasicDualQuaternion<T>::Normalize(BasicDualQuaternion const& q) {
+		T inversedMagnitude = T(1) / BasicQuaternion<T>::Magnitude(q.real);
+		BasicQuaternion<T> real = q.real * inversedMagnitude;
+		BasicQuaternion<T> dual = q.dual * inversedMagnitude;
+
+		// Remove the part of dual along real so that real . dual = 0 holds
+		return BasicDualQuaternion(real, dual - real * BasicQuaternion<T>::Dot(real, dual));
+	}
+
+	template <typename T>
+	constexpr BasicDualQuaternion<T> BasicDualQuaternion<T>::Inverse(BasicDualQuaternion const& q) {
+		BasicQuaternion<T> real = BasicQuaternion<T>::Inverse(q.real);
+
+		return BasicDualQuaternion(real, -(real * q.dual * real));
+	}
+
+	template <typename T>
+	inline BasicDualQuaternion<T> BasicDualQuaternion<T>::Nlerp(BasicDualQuaternion const& from, BasicDualQuaternion const& to, T t) {
+		T sign = BasicQuaternion<T>::Dot(from.real, to.real) < T(0) ? T(-1) : T(1);
+
+		return Normalize(BasicDualQuaternion(
+			from.real * (T(1) - t) + to.real * (sign * t),
+			from.dual * (T(1) - t) + to.dual * (sign * t)));
+	}
+
+	template <typename T>
+	inline BasicDualQuaternion<T>& BasicDualQuaternion<T>::Normalized() {
+		*this = Normalize(*this);
+
+		return *this;
+	}
+
+	template <typename T>
+	constexpr BasicQuaternion<T> BasicDualQuaternion<T>::Rotation() const {
+		return real;
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicDualQuaternion<T>::Translation() const {
+		BasicQuaternion<T> t = dual * BasicQuaternion<T>::Conjugate(real);
+
+		return Vector<3, T>(t.x, t.y, t.z) * T(2);
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicDualQuaternion<T>::TransformPoint(Vector<3, T> const& p) const {
+		return real.Rotate(p) + Translation();
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicDualQuaternion<T>::TransformDirection(Vector<3, T> const& d) const {
+		return real.Rotate(d);
+	}
+
+	template <typename T>
+	constexpr Matrix<4, 4, T> BasicDualQuaternion<T>::ToMatrix4x4() const {
+		Matrix<4, 4, T> result = real.ToMatrix4x4();
+		Vector<3, T> translation = Translation();
+		result(0, 3) = translation.x;
+		result(1, 3) = translation.y;
+		result(2, 3) = translation.z;
+
+		return result;
+	}
+
+	using Quaternion = BasicQuaternion<float>;
+	using Quaterniond = BasicQuaternion<double>;
+
+	using DualQuaternion = BasicDualQuaternion<float>;
+	using DualQuaterniond = BasicDualQuaternion<double>;
+}
+
+#endif // QUATERNION_HPP
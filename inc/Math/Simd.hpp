@@ -0,0 +1,386 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+// Compile-time selection of the 4-wide float backend used by the math kernels.
+// Define MATH_SIMD_SCALAR (xmake f --scalar_math=y) to force the portable path.
+#if !defined(MATH_SIMD_SCALAR)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MATH_SIMD_NEON 1
+#else
+#define MATH_SIMD_SCALAR 1
+#endif
+#endif
+
+#if defined(MATH_SIMD_SSE)
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#elif defined(MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+// The kernels at the bottom are templates over the register type F. They are
+// instantiated with the native Float4 at runtime and with ScalarFloat4 when
+// evaluated at compile time, which gives the same results on every backend.
+// Load, Set and Splat take F explicitly; every other operation is deduced.
+namespace Math::Simd {
+	struct ScalarFloat4 {
+		float v[4];
+	};
+
+	template <typename F>
+	F Load(float const* p);
+
+	template <typename F>
+	F Set(float x, float y, float z, float w);
+
+	template <typename F>
+	F Splat(float c);
+
+	template <>
+	constexpr ScalarFloat4 Load<ScalarFloat4>(float const* p) {
+		return ScalarFloat4 { { p[0], p[1], p[2], p[3] } };
+	}
+
+	constexpr void Store(float* p, ScalarFloat4 a) {
+		p[0] = a.v[0];
+		p[1] = a.v[1];
+		p[2] = a.v[2];
+		p[3] = a.v[3];
+	}
+
+	template <>
+	constexpr ScalarFloat4 Set<ScalarFloat4>(float x, float y, float z, float w) {
+		return ScalarFloat4 { { x, y, z, w } };
+	}
+
+	template <>
+	constexpr ScalarFloat4 Splat<ScalarFloat4>(float c) {
+		return ScalarFloat4 { { c, c, c, c } };
+	}
+
+	constexpr ScalarFloat4 Add(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+	}
+
+	constexpr ScalarFloat4 Sub(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+	}
+
+	constexpr ScalarFloat4 Mul(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+	}
+
+	constexpr ScalarFloat4 Div(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3] } };
+	}
+
+	// Same operand order as _mm_min_ps and _mm_max_ps, b is returned for NaN
+	constexpr ScalarFloat4 Min(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1], a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3] } };
+	}
+
+	constexpr ScalarFloat4 Max(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1], a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3] } };
+	}
+
+	// Same semantics as _mm_shuffle_ps: { a[i0], a[i1], b[i2], b[i3] }
+	template <int i0, int i1, int i2, int i3>
+	constexpr ScalarFloat4 Shuffle(ScalarFloat4 a, ScalarFloat4 b) {
+		return ScalarFloat4 { { a.v[i0], a.v[i1], b.v[i2], b.v[i3] } };
+	}
+
+#if defined(MATH_SIMD_SSE)
+	using Float4 = __m128;
+
+	template <>
+	inline Float4 Load<Float4>(float const* p) {
+		return _mm_loadu_ps(p);
+	}
+
+	inline void Store(float* p, Float4 v) {
+		_mm_storeu_ps(p, v);
+	}
+
+	template <>
+	inline Float4 Set<Float4>(float x, float y, float z, float w) {
+		return _mm_setr_ps(x, y, z, w);
+	}
+
+	template <>
+	inline Float4 Splat<Float4>(float c) {
+		return _mm_set1_ps(c);
+	}
+
+	inline Float4 Add(Float4 a, Float4 b) {
+		return _mm_add_ps(a, b);
+	}
+
+	inline Float4 Sub(Float4 a, Float4 b) {
+		return _mm_sub_ps(a, b);
+	}
+
+	inline Float4 Mul(Float4 a, Float4 b) {
+		return _mm_mul_ps(a, b);
+	}
+
+	inline Float4 Div(Float4 a, Float4 b) {
+		return _mm_div_ps(a, b);
+	}
+
+	inline Float4 Min(Float4 a, Float4 b) {
+		return _mm_min_ps(a, b);
+	}
+
+	inline Float4 Max(Float4 a, Float4 b) {
+		return _mm_max_ps(a, b);
+	}
+
+	template <int i0, int i1, int i2, int i3>
+	inline Float4 Shuffle(Float4 a, Float4 b) {
+		return _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0));
+	}
+
+#elif defined(MATH_SIMD_NEON)
+	using Float4 = float32x4_t;
+
+	template <>
+	inline Float4 Load<Float4>(float const* p) {
+		return vld1q_f32(p);
+	}
+
+	inline void Store(float* p, Float4 v) {
+		vst1q_f32(p, v);
+	}
+
+	template <>
+	inline Float4 Set<Float4>(float x, float y, float z, float w) {
+		float const values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+	}
+
+	template <>
+	inline Float4 Splat<Float4>(float c) {
+		return vdupq_n_f32(c);
+	}
+
+	inline Float4 Add(Float4 a, Float4 b) {
+		return vaddq_f32(a, b);
+	}
+
+	inline Float4 Sub(Float4 a, Float4 b) {
+		return vsubq_f32(a, b);
+	}
+
+	// Kernels never use vmlaq_f32: multiply and add stay separate so the
+	// results are the same on every backend
+	inline Float4 Mul(Float4 a, Float4 b) {
+		return vmulq_f32(a, b);
+	}
+
+	inline Float4 Div(Float4 a, Float4 b) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+		return vdivq_f32(a, b);
+#else
+		float lhs[4];
+		float rhs[4];
+		vst1q_f32(lhs, a);
+		vst1q_f32(rhs, b);
+		return Set<Float4>(lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2], lhs[3] / rhs[3]);
+#endif
+	}
+
+	// Unlike SSE, NaN lanes propagate
+	inline Float4 Min(Float4 a, Float4 b) {
+		return vminq_f32(a, b);
+	}
+
+	inline Float4 Max(Float4 a, Float4 b) {
+		return vmaxq_f32(a, b);
+	}
+
+	template <int i0, int i1, int i2, int i3>
+	inline Float4 Shuffle(Float4 a, Float4 b) {
+		Float4 r = vmovq_n_f32(vgetq_lane_f32(a, i0));
+		r = vsetq_lane_f32(vgetq_lane_f32(a, i1), r, 1);
+		r = vsetq_lane_f32(vgetq_lane_f32(b, i2), r, 2);
+		r = vsetq_lane_f32(vgetq_lane_f32(b, i3), r, 3);
+		return r;
+	}
+
+#else
+	using Float4 = ScalarFloat4;
+#endif
+
+	template <int i, typename F>
+	constexpr F SplatLane(F a) {
+		return Shuffle<i, i, i, i>(a, a);
+	}
+
+	template <typename F>
+	constexpr void Transpose(F& r0, F& r1, F& r2, F& r3) {
+		F t0 = Shuffle<0, 1, 0, 1>(r0, r1); // r00 r01 r10 r11
+		F t1 = Shuffle<2, 3, 2, 3>(r0, r1); // r02 r03 r12 r13
+		F t2 = Shuffle<0, 1, 0, 1>(r2, r3); // r20 r21 r30 r31
+		F t3 = Shuffle<2, 3, 2, 3>(r2, r3); // r22 r23 r32 r33
+
+		r0 = Shuffle<0, 2, 0, 2>(t0, t2);
+		r1 = Shuffle<1, 3, 1, 3>(t0, t2);
+		r2 = Shuffle<0, 2, 0, 2>(t1, t3);
+		r3 = Shuffle<1, 3, 1, 3>(t1, t3);
+	}
+
+	// Row-major 4x4 product. Each line of the result is a linear combination of
+	// the lines of rhs, accumulated in the same order as a scalar dot product.
+	template <typename F = Float4>
+	constexpr void MultiplyMatrix4(float const* lhs, float const* rhs, float* result) {
+		F b0 = Load<F>(rhs + 0);
+		F b1 = Load<F>(rhs + 4);
+		F b2 = Load<F>(rhs + 8);
+		F b3 = Load<F>(rhs + 12);
+
+		for (int n = 0; n < 4; ++n) {
+			float const* a = lhs + n * 4;
+			F line = Mul(Splat<F>(a[0]), b0);
+			line = Add(line, Mul(Splat<F>(a[1]), b1));
+			line = Add(line, Mul(Splat<F>(a[2]), b2));
+			line = Add(line, Mul(Splat<F>(a[3]), b3));
+			Store(result + n * 4, line);
+		}
+	}
+
+	template <typename F = Float4>
+	constexpr void TransposeMatrix4(float const* m, float* result) {
+		F r0 = Load<F>(m + 0);
+		F r1 = Load<F>(m + 4);
+		F r2 = Load<F>(m + 8);
+		F r3 = Load<F>(m + 12);
+		Transpose(r0, r1, r2, r3);
+
+		Store(result + 0, r0);
+		Store(result + 4, r1);
+		Store(result + 8, r2);
+		Store(result + 12, r3);
+	}
+
+	// 2x2 matrices stored in a single register as (xx, xy, yx, yy)
+
+	// A * B
+	template <typename F>
+	constexpr F Matrix2Mul(F a, F b) {
+		return Add(
+			Mul(a, Shuffle<0, 3, 0, 3>(b, b)),
+			Mul(Shuffle<1, 0, 3, 2>(a, a), Shuffle<2, 1, 2, 1>(b, b)));
+	}
+
+	// adj(A) * B
+	template <typename F>
+	constexpr F Matrix2AdjMul(F a, F b) {
+		return Sub(
+			Mul(Shuffle<3, 3, 0, 0>(a, a), b),
+			Mul(Shuffle<1, 1, 2, 2>(a, a), Shuffle<2, 3, 0, 1>(b, b)));
+	}
+
+	// A * adj(B)
+	template <typename F>
+	constexpr F Matrix2MulAdj(F a, F b) {
+		return Sub(
+			Mul(a, Shuffle<3, 0, 3, 0>(b, b)),
+			Mul(Shuffle<1, 0, 3, 2>(a, a), Shuffle<2, 1, 2, 1>(b, b)));
+	}
+
+	// Block-wise inverse: M = | A B |, each block being a 2x2 matrix.
+	//                         | C D |
+	// The adjugates of the blocks give the inverse with Cramer's rule without
+	// going through the 16 cofactors of the matrix. Returns the determinant.
+	template <typename F = Float4>
+	constexpr float InverseMatrix4(float const* m, float* result) {
+		F r0 = Load<F>(m + 0);
+		F r1 = Load<F>(m + 4);
+		F r2 = Load<F>(m + 8);
+		F r3 = Load<F>(m + 12);
+
+		F a = Shuffle<0, 1, 0, 1>(r0, r1);
+		F b = Shuffle<2, 3, 2, 3>(r0, r1);
+		F c = Shuffle<0, 1, 0, 1>(r2, r3);
+		F d = Shuffle<2, 3, 2, 3>(r2, r3);
+
+		// (|A|, |B|, |C|, |D|)
+		F subDeterminants = Sub(
+			Mul(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+			Mul(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+		F detA = SplatLane<0>(subDeterminants);
+		F detB = SplatLane<1>(subDeterminants);
+		F detC = SplatLane<2>(subDeterminants);
+		F detD = SplatLane<3>(subDeterminants);
+
+		F adjDC = Matrix2AdjMul(d, c);
+		F adjAB = Matrix2AdjMul(a, b);
+
+		// Adjugates of the blocks of the inverse
+		F x = Sub(Mul(detD, a), Matrix2Mul(b, adjDC));
+		F w = Sub(Mul(detA, d), Matrix2Mul(c, adjAB));
+		F y = Sub(Mul(detB, c), Matrix2MulAdj(d, adjAB));
+		F z = Sub(Mul(detC, b), Matrix2MulAdj(a, adjDC));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		F trace = Mul(adjAB, Shuffle<0, 2, 1, 3>(adjDC, adjDC));
+		trace = Add(trace, Shuffle<2, 3, 0, 1>(trace, trace));
+		trace = Add(trace, Shuffle<1, 0, 3, 2>(trace, trace));
+
+		F det = Sub(Add(Mul(detA, detD), Mul(detB, detC)), trace);
+
+		F inversedDet = Div(Set<F>(1.0f, -1.0f, -1.0f, 1.0f), det);
+		x = Mul(x, inversedDet);
+		y = Mul(y, inversedDet);
+		z = Mul(z, inversedDet);
+		w = Mul(w, inversedDet);
+
+		// Undo the adjugate swizzle while writing the blocks back as lines
+		Store(result + 0, Shuffle<3, 1, 3, 1>(x, y));
+		Store(result + 4, Shuffle<2, 0, 2, 0>(x, y));
+		Store(result + 8, Shuffle<3, 1, 3, 1>(z, w));
+		Store(result + 12, Shuffle<2, 0, 2, 0>(z, w));
+
+		float determinant[4] {};
+		Store(determinant, det);
+		return determinant[0];
+	}
+
+	// Product of affine transforms given as the 3 first lines of a row-major
+	// 4x4 matrix, the last line being implicitly (0, 0, 0, 1)
+	template <typename F = Float4>
+	constexpr void MultiplyAffine(float const* lhs, float const* rhs, float* result) {
+		F b0 = Load<F>(rhs + 0);
+		F b1 = Load<F>(rhs + 4);
+		F b2 = Load<F>(rhs + 8);
+
+		for (int n = 0; n < 3; ++n) {
+			float const* a = lhs + n * 4;
+			F line = Mul(Splat<F>(a[0]), b0);
+			line = Add(line, Mul(Splat<F>(a[1]), b1));
+			line = Add(line, Mul(Splat<F>(a[2]), b2));
+			line = Add(line, Set<F>(0.0f, 0.0f, 0.0f, a[3]));
+			Store(result + n * 4, line);
+		}
+	}
+
+	// Hamilton product of quaternions stored as (x, y, z, w). The terms are
+	// accumulated in the order lhs.w, lhs.x, lhs.y, lhs.z on every lane, which
+	// matches the scalar formula term by term.
+	template <typename F = Float4>
+	constexpr void MultiplyQuaternion(float const* lhs, float const* rhs, float* result) {
+		F a = Load<F>(lhs);
+		F b = Load<F>(rhs);
+
+		F r = Mul(SplatLane<3>(a), b);
+		r = Add(r, Mul(Mul(SplatLane<0>(a), Shuffle<3, 2, 1, 0>(b, b)), Set<F>(1.0f, -1.0f, 1.0f, -1.0f)));
+		r = Add(r, Mul(Mul(SplatLane<1>(a), Shuffle<2, 3, 0, 1>(b, b)), Set<F>(1.0f, 1.0f, -1.0f, -1.0f)));
+		r = Add(r, Mul(Mul(SplatLane<2>(a), Shuffle<1, 0, 3, 2>(b, b)), Set<F>(-1.0f, 1.0f, 1.0f, -1.0f)));
+
+		Store(result, r);
+	}
+}
+
+#endif // SIMD_HPP
@@ -0,0 +1,280 @@
+#ifndef TRANSFORM3D_HPP
+#define TRANSFORM3D_HPP
+
+#include <iostream>
+#include <cmath>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include <Math/Vector.hpp>
+#include <Math/Matrix.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Simd.hpp>
+
+namespace Math {
+	// Affine transform stored as the 3 first lines of a row-major 4x4 matrix,
+	// the last line being implicitly (0, 0, 0, 1). It keeps track of how it was
+	// built so that the inverse only costs a transpose for rigid transforms.
+	template <typename T>
+	class BasicTransform3D {
+	public:
+		enum class Kind : uint8_t {
+			Rigid,        // Rotation and translation
+			UniformScale, // Rotation, uniform scale and translation
+			General       // Any invertible affine transform
+		};
+
+		constexpr BasicTransform3D() = default;
+		explicit constexpr BasicTransform3D(Matrix<3, 4, T> const& m, Kind kind = Kind::General);
+		explicit constexpr BasicTransform3D(Matrix<4, 4, T> const& m, Kind kind = Kind::General);
+		explicit constexpr BasicTransform3D(BasicDualQuaternion<T> const& q);
+
+		friend constexpr bool operator==(BasicTransform3D const& lhs, BasicTransform3D const& rhs) {
+			return lhs._lines == rhs._lines;
+		}
+
+		friend constexpr bool operator!=(BasicTransform3D const& lhs, BasicTransform3D const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, BasicTransform3D const& t) {
+			return out << t._lines;
+		}
+
+		// Applies rhs first, then lhs
+		friend constexpr BasicTransform3D operator*(BasicTransform3D const& lhs, BasicTransform3D const& rhs) {
+			BasicTransform3D result;
+			result._kind = std::max(lhs._kind, rhs._kind);
+
+			if constexpr (std::is_same_v<T, float>) {
+				if (std::is_constant_evaluated()) {
+					Simd::MultiplyAffine<Simd::ScalarFloat4>(&lhs._lines[0], &rhs._lines[0], &result._lines[0]);
+				}
+				else {
+					Simd::MultiplyAffine(&lhs._lines[0], &rhs._lines[0], &result._lines[0]);
+				}
+			}
+			else {
+				for (int n = 0; n < 3; ++n) {
+					for (int m = 0; m < 4; ++m) {
+						T sum = lhs._lines(n, 0) * rhs._lines(0, m) + lhs._lines(n, 1) * rhs._lines(1, m) + lhs._lines(n, 2) * rhs._lines(2, m);
+						result._lines(n, m) = m == 3 ? sum + lhs._lines(n, 3) : sum;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		friend constexpr BasicTransform3D& operator*=(BasicTransform3D& lhs, BasicTransform3D const& rhs) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		static constexpr BasicTransform3D Identity();
+
+		static BasicTransform3D RotateX(T angle);
+		static BasicTransform3D RotateY(T angle);
+		static BasicTransform3D RotateZ(T angle);
+		static constexpr BasicTransform3D Rotate(BasicQuaternion<T> const& q);
+
+		static constexpr BasicTransform3D Translate(T tx, T ty, T tz);
+		static constexpr BasicTransform3D Translate(Vector<3, T> const& t);
+
+		static constexpr BasicTransform3D Scale(T s);
+		static constexpr BasicTransform3D Scale(T sx, T sy, T sz);
+
+		static BasicTransform3D LookAt(Vector<3, T> const& from, Vector<3, T> const& to, Vector<3, T> const& up);
+
+		static constexpr BasicTransform3D Inverse(BasicTransform3D const& t);
+
+		constexpr BasicTransform3D& Inversed();
+
+		constexpr Kind GetKind() const;
+		constexpr Matrix<3, 3, T> Linear() const;
+		constexpr Vector<3, T> Translation() const;
+
+		constexpr Vector<3, T> TransformPoint(Vector<3, T> const& p) const;
+		constexpr Vector<3, T> TransformDirection(Vector<3, T> const& d) const;
+
+		constexpr Matrix<3, 4, T> const& ToMatrix3x4() const;
+		constexpr Matrix<4, 4, T> ToMatrix4x4() const;
+
+	private:
+		Matrix<3, 4, T> _lines {
+			T(1), T(0), T(0), T(0),
+			T(0), T(1), T(0), T(0),
+			T(0), T(0), T(1), T(0) };
+		Kind _kind = Kind::Rigid;
+	};
+
+	template <typename T>
+	constexpr BasicTransform3D<T>::BasicTransform3D(Matrix<3, 4, T> const& m, Kind kind)
+		: _lines(m), _kind(kind) {
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T>::BasicTransform3D(Matrix<4, 4, T> const& m, Kind kind)
+		: _kind(kind) {
+		assert("Matrix must be affine" && m(3, 0) == T(0) && m(3, 1) == T(0) && m(3, 2) == T(0) && m(3, 3) == T(1));
+
+		for (int i = 0; i < 12; ++i) {
+			_lines[i] = m[i];
+		}
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T>::BasicTransform3D(BasicDualQuaternion<T> const& q)
+		: BasicTransform3D(q.ToMatrix4x4(), Kind::Rigid) {
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Identity() {
+		return BasicTransform3D();
+	}
+
+	template <typename T>
+	inline BasicTransform3D<T> BasicTransform3D<T>::RotateX(T angle) {
+		return BasicTransform3D(Matrix<4, 4, T>::RotateX(angle), Kind::Rigid);
+	}
+
+	template <typename T>
+	inline BasicTransform3D<T> BasicTransform3D<T>::RotateY(T angle) {
+		return BasicTransform3D(Matrix<4, 4, T>::RotateY(angle), Kind::Rigid);
+	}
+
+	template <typename T>
+	inline BasicTransform3D<T> BasicTransform3D<T>::RotateZ(T angle) {
+		return BasicTransform3D(Matrix<4, 4, T>::RotateZ(angle), Kind::Rigid);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Rotate(BasicQuaternion<T> const& q) {
+		return BasicTransform3D(q.ToMatrix4x4(), Kind::Rigid);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Translate(T tx, T ty, T tz) {
+		return BasicTransform3D(Matrix<4, 4, T>::Translate(tx, ty, tz), Kind::Rigid);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Translate(Vector<3, T> const& t) {
+		return Translate(t.x, t.y, t.z);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Scale(T s) {
+		assert("Scale must not be zero" && s != T(0));
+
+		return BasicTransform3D(Matrix<4, 4, T>::Scale(s), Kind::UniformScale);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Scale(T sx, T sy, T sz) {
+		assert("Scale must not be zero" && sx != T(0) && sy != T(0) && sz != T(0));
+
+		Kind kind = (sx == sy && sy == sz) ? Kind::UniformScale : Kind::General;
+		return BasicTransform3D(Matrix<4, 4, T>::Scale(sx, sy, sz), kind);
+	}
+
+	template <typename T>
+	inline BasicTransform3D<T> BasicTransform3D<T>::LookAt(Vector<3, T> const& from, Vector<3, T> const& to, Vector<3, T> const& up) {
+		return BasicTransform3D(Matrix<4, 4, T>::LookAt(from, to, up), Kind::Rigid);
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T> BasicTransform3D<T>::Inverse(BasicTransform3D const& t) {
+		// The linear part L is inverted first, then the translation is -L^-1 * t
+		Matrix<3, 3, T> inversedLinear;
+		switch (t._kind) {
+			case Kind::Rigid: {
+				inversedLinear = Matrix<3, 3, T>::Transpose(t.Linear());
+				break;
+			}
+
+			case Kind::UniformScale: {
+				// L = sR, so L^-1 = L^T / s^2 with s^2 the squared length of any line
+				T squaredScale = t._lines(0, 0) * t._lines(0, 0) + t._lines(0, 1) * t._lines(0, 1) + t._lines(0, 2) * t._lines(0, 2);
+				inversedLinear = Matrix<3, 3, T>::Transpose(t.Linear()) / squaredScale;
+				break;
+			}
+
+			case Kind::General: {
+				inversedLinear = Matrix<3, 3, T>::Inverse(t.Linear());
+				break;
+			}
+		}
+
+		Vector<3, T> translation = -(inversedLinear * t.Translation());
+
+		BasicTransform3D result;
+		result._kind = t._kind;
+		for (int n = 0; n < 3; ++n) {
+			result._lines(n, 0) = inversedLinear(n, 0);
+			result._lines(n, 1) = inversedLinear(n, 1);
+			result._lines(n, 2) = inversedLinear(n, 2);
+			result._lines(n, 3) = translation[n];
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	constexpr BasicTransform3D<T>& BasicTransform3D<T>::Inversed() {
+		*this = Inverse(*this);
+
+		return *this;
+	}
+
+	template <typename T>
+	constexpr typename BasicTransform3D<T>::Kind BasicTransform3D<T>::GetKind() const {
+		return _kind;
+	}
+
+	template <typename T>
+	constexpr Matrix<3, 3, T> BasicTransform3D<T>::Linear() const {
+		return Matrix<3, 3, T>(
+			_lines(0, 0), _lines(0, 1), _lines(0, 2),
+			_lines(1, 0), _lines(1, 1), _lines(1, 2),
+			_lines(2, 0), _lines(2, 1), _lines(2, 2));
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicTransform3D<T>::Translation() const {
+		return _lines.Column(3);
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicTransform3D<T>::TransformPoint(Vector<3, T> const& p) const {
+		return _lines * Vector<4, T>(p, T(1));
+	}
+
+	template <typename T>
+	constexpr Vector<3, T> BasicTransform3D<T>::TransformDirection(Vector<3, T> const& d) const {
+		return _lines * Vector<4, T>(d, T(0));
+	}
+
+	template <typename T>
+	constexpr Matrix<3, 4, T> const& BasicTransform3D<T>::ToMatrix3x4() const {
+		return _lines;
+	}
+
+	template <typename T>
+	constexpr Matrix<4, 4, T> BasicTransform3D<T>::ToMatrix4x4() const {
+		Matrix<4, 4, T> result(T(1));
+		for (int i = 0; i < 12; ++i) {
+			result[i] = _lines[i];
+		}
+
+		return result;
+	}
+
+	using Transform3D = BasicTransform3D<float>;
+	using Transform3Dd = BasicTransform3D<double>;
+}
+
+#endif // TRANSFORM3D_HPP
@@ -0,0 +1,326 @@
+#ifndef VECTOR_HPP
+#define VECTOR_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <concepts>
+
+#include <Math/Half.hpp>
+
+namespace Math {
+	template <size_t N, typename T>
+	struct Vector;
+
+	// Components are named x, y, z and w up to 4 dimensions, so that the
+	// aliases keep the layout and the member access of the former classes
+	template <size_t N, typename T>
+	struct VectorStorage {
+	public:
+		constexpr T& At(size_t i) {
+			return elements[i];
+		}
+
+		constexpr T const& At(size_t i) const {
+			return elements[i];
+		}
+
+	public:
+		std::array<T, N> elements {};
+	};
+
+	template <typename T>
+	struct VectorStorage<2, T> {
+	public:
+		constexpr T& At(size_t i) {
+			return i == 0 ? x : y;
+		}
+
+		constexpr T const& At(size_t i) const {
+			return i == 0 ? x : y;
+		}
+
+	public:
+		T x {};
+		T y {};
+	};
+
+	template <typename T>
+	struct VectorStorage<3, T> {
+	public:
+		constexpr T& At(size_t i) {
+			return i == 0 ? x : (i == 1 ? y : z);
+		}
+
+		constexpr T const& At(size_t i) const {
+			return i == 0 ? x : (i == 1 ? y : z);
+		}
+
+	public:
+		T x {};
+		T y {};
+		T z {};
+	};
+
+	template <typename T>
+	struct VectorStorage<4, T> {
+	public:
+		constexpr T& At(size_t i) {
+			return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w));
+		}
+
+		constexpr T const& At(size_t i) const {
+			return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w));
+		}
+
+	public:
+		T x {};
+		T y {};
+		T z {};
+		T w {};
+	};
+
+	// Number of components a constructor argument contributes
+	template <typename T>
+	struct ComponentCount : std::integral_constant<size_t, 1> {};
+
+	template <size_t N, typename T>
+	struct ComponentCount<Vector<N, T>> : std::integral_constant<size_t, N> {};
+
+	template <size_t N, typename T>
+	struct Vector : public VectorStorage<N, T> {
+	public:
+		using Scalar = T;
+		static constexpr size_t size = N;
+
+		constexpr Vector() = default;
+		constexpr Vector(T c);
+
+		// Any mix of scalars and smaller vectors adding up to N components,
+		// e.g. Vector4(x, y, z, w), Vector4(xyz, w) or Vector4(xy, zw)
+		template <typename... Parts>
+			requires (sizeof...(Parts) >= 2 && (ComponentCount<Parts>::value + ...) == N)
+		constexpr Vector(Parts const&... parts);
+
+		// Conversion between scalar types, e.g. Vector3d to Vector3 or Vector4 to Vector4h
+		template <typename U>
+			requires (!std::is_same_v<T, U>)
+		explicit constexpr Vector(Vector<N, U> const& v);
+
+		constexpr Vector(Vector const& v) = default;
+		constexpr Vector(Vector&& v) = default;
+
+		constexpr Vector& operator = (Vector const& v) = default;
+		constexpr Vector& operator = (Vector&& v) = default;
+
+		constexpr T& operator [] (size_t index);
+		constexpr T const& operator [] (size_t index) const;
+
+		friend constexpr bool operator == (Vector const& lhs, Vector const& rhs) {
+			for (size_t i = 0; i < N; ++i) {
+				if (!(lhs[i] == rhs[i])) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		friend constexpr bool operator != (Vector const& lhs, Vector const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		friend std::ostream& operator << (std::ostream& out, Vector const& v) {
+			out << std::setprecision(4) << std::fixed << "[";
+			for (size_t i = 0; i < N; ++i) {
+				out << (i != 0 ? ", " : "") << v[i];
+			}
+
+			return out << "]";
+		}
+
+		friend constexpr Vector operator + (Vector const& lhs, Vector const& rhs) {
+			Vector result;
+			for (size_t i = 0; i < N; ++i) {
+				result[i] = lhs[i] + rhs[i];
+			}
+
+			return result;
+		}
+
+		friend constexpr Vector& operator += (Vector& lhs, Vector const& rhs) {
+			lhs = lhs + rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Vector operator - (Vector const& v) {
+			Vector result;
+			for (size_t i = 0; i < N; ++i) {
+				result[i] = -v[i];
+			}
+
+			return result;
+		}
+
+		friend constexpr Vector operator - (Vector const& lhs, Vector const& rhs) {
+			return lhs + (-rhs);
+		}
+
+		friend constexpr Vector& operator -= (Vector& lhs, Vector const& rhs) {
+			lhs = lhs - rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Vector operator * (Vector const& lhs, T const& rhs) {
+			Vector result;
+			for (size_t i = 0; i < N; ++i) {
+				result[i] = lhs[i] * rhs;
+			}
+
+			return result;
+		}
+
+		friend constexpr Vector operator * (T const& lhs, Vector const& rhs) {
+			return rhs * lhs;
+		}
+
+		friend constexpr Vector& operator *= (Vector& lhs, T const& rhs) {
+			lhs = lhs * rhs;
+
+			return lhs;
+		}
+
+		friend constexpr Vector operator / (Vector const& lhs, T const& rhs) {
+			T inversedRhs = T(1) / rhs;
+
+			return lhs * inversedRhs;
+		}
+
+		friend constexpr Vector& operator /= (Vector& lhs, T const& rhs) {
+			T inversedRhs = T(1) / rhs;
+			lhs = lhs * inversedRhs;
+
+			return lhs;
+		}
+
+		static constexpr T Dot(Vector const& lhs, Vector const& rhs);
+		static constexpr Vector Cross(Vector const& lhs, Vector const& rhs) requires (N == 3);
+		static T Magnitude(Vector const& v);
+		static Vector Normalize(Vector const& v);
+
+		[[nodiscard]] Vector& Normalized();
+
+	private:
+		template <typename Part>
+		constexpr void Append(size_t& index, Part const& part);
+	};
+
+	template <size_t N, typename T>
+	constexpr Vector<N, T>::Vector(T c) {
+		for (size_t i = 0; i < N; ++i) {
+			(*this)[i] = c;
+		}
+	}
+
+	template <size_t N, typename T>
+	template <typename... Parts>
+		requires (sizeof...(Parts) >= 2 && (ComponentCount<Parts>::value + ...) == N)
+	constexpr Vector<N, T>::Vector(Parts const&... parts) {
+		size_t index = 0;
+		(Append(index, parts), ...);
+	}
+
+	template <size_t N, typename T>
+	template <typename U>
+		requires (!std::is_same_v<T, U>)
+	constexpr Vector<N, T>::Vector(Vector<N, U> const& v) {
+		for (size_t i = 0; i < N; ++i) {
+			(*this)[i] = static_cast<T>(v[i]);
+		}
+	}
+
+	template <size_t N, typename T>
+	template <typename Part>
+	constexpr void Vector<N, T>::Append(size_t& index, Part const& part) {
+		if constexpr (ComponentCount<Part>::value > 1 || requires { part[0]; }) {
+			for (size_t i = 0; i < ComponentCount<Part>::value; ++i) {
+				(*this)[index++] = static_cast<T>(part[i]);
+			}
+		}
+		else {
+			(*this)[index++] = static_cast<T>(part);
+		}
+	}
+
+	template <size_t N, typename T>
+	constexpr T& Vector<N, T>::operator [] (size_t index) {
+		assert("Index must be in the bounds of the vector" && index < N);
+
+		return this->At(index);
+	}
+
+	template <size_t N, typename T>
+	constexpr T const& Vector<N, T>::operator [] (size_t index) const {
+		assert("Index must be in the bounds of the vector" && index < N);
+
+		return this->At(index);
+	}
+
+	template <size_t N, typename T>
+	constexpr T Vector<N, T>::Dot(Vector const& lhs, Vector const& rhs) {
+		T result = lhs[0] * rhs[0];
+		for (size_t i = 1; i < N; ++i) {
+			result += lhs[i] * rhs[i];
+		}
+
+		return result;
+	}
+
+	template <size_t N, typename T>
+	constexpr Vector<N, T> Vector<N, T>::Cross(Vector const& lhs, Vector const& rhs) requires (N == 3) {
+		return Vector(
+			lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.z * rhs.x - lhs.x * rhs.z,
+			lhs.x * rhs.y - lhs.y * rhs.x);
+	}
+
+	template <size_t N, typename T>
+	inline T Vector<N, T>::Magnitude(Vector const& v) {
+		return std::sqrt(Dot(v, v));
+	}
+
+	template <size_t N, typename T>
+	inline Vector<N, T> Vector<N, T>::Normalize(Vector const& v) {
+		T inversedMagnitude = T(1) / Magnitude(v);
+
+		return v * inversedMagnitude;
+	}
+
+	template <size_t N, typename T>
+	inline Vector<N, T>& Vector<N, T>::Normalized() {
+		T inversedMagnitude = T(1) / Magnitude(*this);
+		*this *= inversedMagnitude;
+
+		return *this;
+	}
+
+	using Vector2 = Vector<2, float>;
+	using Vector3 = Vector<3, float>;
+	using Vector4 = Vector<4, float>;
+
+	using Vector2d = Vector<2, double>;
+	using Vector3d = Vector<3, double>;
+	using Vector4d = Vector<4, double>;
+
+	using Vector2h = Vector<2, Half>;
+	using Vector3h = Vector<3, Half>;
+	using Vector4h = Vector<4, Half>;
+}
+
+#endif // VECTOR_HPP
@@ -0,0 +1,124 @@
+#ifndef STAGINGBELT_HPP
+#define STAGINGBELT_HPP
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Buffer/StagingRing.hpp>
+#include <Helper/Device.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/Buffer.hpp>
+#include <Helper/BufferDescriptor.hpp>
+#include <Helper/CommandEncoder.hpp>
+#include <Helper/Extent3D.hpp>
+#include <Helper/TexelCopyTextureInfo.hpp>
+#include <Helper/TexelCopyBufferLayout.hpp>
+#include <Resources/Texture/CookedTexture.hpp>
+
+// Uploads written into mapped MapWrite | CopySrc chunks instead of going
+// through the staging of queue->writeBuffer and queue->writeTexture one by
+// one. A frame of writes becomes copies recorded by Finish, the contiguous
+// buffer writes being merged into a single copy, then the chunks are mapped
+// again once the GPU has run the submission:
+//
+//     belt.WriteBuffer(uniformBuffer, 0, &uniforms, sizeof(uniforms));
+//     belt.Finish(commandEncoder); // Before the passes reading the buffers
+//     queue->submit(commandBuffer.Handle());
+//     belt.Recall(queue);
+//
+// The chunks come back when the callbacks of the queue run, from
+// queue->submit or a poll of the device, on the thread that submits. Recall
+// first polls the device without waiting, so that the chunks of the
+// submissions already done come back even if nothing else polls it. The
+// temporary chunks of the writes larger than a chunk are destroyed instead.
+class StagingBelt {
+public:
+	// chunkCount chunks of chunkSize bytes mapped at once, more being added
+	// when the GPU still reads every one of them
+	StagingBelt(Device& device, size_t chunkSize = 1 << 20, uint32_t chunkCount = 3);
+	StagingBelt(StagingBelt const&) = delete;
+	StagingBelt& operator=(StagingBelt const&) = delete;
+
+	// size and offset must be multiples of 4, like for copyBufferToBuffer
+	void WriteBuffer(Buffer& buffer, uint64_t offset, void const* data, size_t size);
+
+	// Like queue->writeTexture: the rows, of 4x4 blocks for the
+	// block-compressed formats, are padded to 256 bytes in the chunk. Throws
+	// std::invalid_argument when writeSize has several layers and
+	// layout.rowsPerImage is WGPU_COPY_STRIDE_UNDEFINED.
+	void WriteTexture(TexelCopyTextureInfo const& destination, void const* data, size_t size, TexelCopyBufferLayout const& layout, Extent3D const& writeSize);
+
+	// Records the copies of the writes since the last call in encoder, then
+	// unmaps their chunks
+	void Finish(CommandEncoder& encoder);
+
+	// Once the encoder given to Finish is submitted: its chunks are mapped
+	// again when the GPU is done with the submission
+	void Recall(Queue& queue);
+
+	// Copies recorded by the last Finish
+	uint32_t GetCopyCount() const {
+		return _copyCount;
+	}
+
+	// Chunks whose submission is not done yet
+	uint32_t GetInFlightCount() const;
+	size_t GetCapacity() const;
+	StagingStatistics const& GetStatistics() const;
+
+private:
+	struct Chunk {
+	public:
+		std::unique_ptr<Buffer> buffer {};
+		uint8_t* mapped = nullptr; // While it is not in flight
+	};
+
+	// What the callbacks of the queue and buffers reach, which they only do
+	// while the belt exists
+	struct State {
+	public:
+		StagingRing ring;
+		std::vector<Chunk> chunks {};
+	};
+
+	struct BufferCopy {
+	public:
+		uint32_t chunk = 0;
+		size_t sourceOffset = 0;
+		Buffer* destination = nullptr; // Must outlive the next Finish
+		uint64_t destinationOffset = 0;
+		size_t size = 0;
+	};
+
+	struct TextureCopy {
+	public:
+		uint32_t chunk = 0;
+		wgpu::TexelCopyBufferLayout layout {};
+		wgpu::TexelCopyTextureInfo destination {};
+		wgpu::Extent3D size {};
+	};
+
+	// Buffers of the chunks added by the ring, or of the released chunks it
+	// used again, mapped
+	void CreateChunks();
+
+	// Space in a mapped chunk
+	StagingAllocation Allocate(size_t size, size_t alignment);
+
+	Device& _device;
+	std::shared_ptr<State> _state;
+
+	std::vector<BufferCopy> _bufferCopies {};
+	std::vector<TextureCopy> _textureCopies {};
+	std::vector<uint32_t> _finished {}; // Closed by Finish, waiting for Recall
+	uint32_t _copyCount = 0;
+};
+
+#endif // STAGINGBELT_HPP
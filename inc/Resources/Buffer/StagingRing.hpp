@@ -0,0 +1,91 @@
+#ifndef STAGINGRING_HPP
+#define STAGINGRING_HPP
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+
+struct StagingAllocation {
+public:
+	uint32_t chunk = 0;
+	size_t offset = 0; // In the chunk
+};
+
+struct StagingStatistics {
+public:
+	size_t stagedBytes = 0; // Between the last two Close, alignment included
+	size_t totalStagedBytes = 0;
+	uint64_t stalls = 0;      // Allocations for which every chunk was in flight, so a new one was added
+	uint64_t oversized = 0;   // Allocations larger than a chunk, given a temporary chunk of their own
+	uint64_t wraparounds = 0; // Times the ring went back to its first chunk
+	uint64_t closes = 0;
+};
+
+// Chunks of staging memory used in turn: each one is written by the CPU while
+// it is mapped, closed and unmapped before its copies are submitted, and
+// recycled once the GPU is done with them. Only the bookkeeping, StagingBelt
+// owns the buffers.
+class StagingRing {
+public:
+	enum class ChunkState {
+		Free,     // Mapped and empty
+		Open,     // Mapped and written since the last Close
+		InFlight, // Unmapped, until Recycle
+		Released, // Temporary and recycled, without any memory
+	};
+
+	// Throws if chunkSize or chunkCount is 0
+	StagingRing(size_t chunkSize, uint32_t chunkCount);
+
+	// Space for size bytes at a multiple of alignment, a power of two: in the
+	// chunk written last if it has room, otherwise in the next free chunk of
+	// the ring. When there is none, a chunk is added, which is a stall. Sizes
+	// larger than the chunks get a temporary chunk of their own instead, in
+	// the place of a released one if there is any. Throws if size is 0.
+	StagingAllocation Allocate(size_t size, size_t alignment);
+
+	// The open chunks, which become in flight until they are recycled
+	std::vector<uint32_t> Close();
+
+	// An in-flight chunk, empty and mapped again, or released if it is
+	// temporary so that the ring never keeps more than its chunks
+	void Recycle(uint32_t chunk);
+
+	uint32_t GetChunkCount() const;
+	size_t GetChunkSize(uint32_t chunk) const; // 0 once released
+	ChunkState GetChunkState(uint32_t chunk) const;
+	bool IsTemporary(uint32_t chunk) const;
+
+	// Bytes of every chunk, the temporary ones until they are released
+	size_t GetCapacity() const;
+
+	StagingStatistics const& GetStatistics() const {
+		return _statistics;
+	}
+
+private:
+	struct Chunk {
+	public:
+		size_t size = 0;
+		size_t used = 0;
+		ChunkState state = ChunkState::Free;
+		bool temporary = false;
+	};
+
+	// A temporary chunk of size bytes, open
+	uint32_t AddTemporary(size_t size);
+
+	// Offset of size bytes at alignment in chunk, or SIZE_MAX if they do not fit
+	static size_t Fit(Chunk const& chunk, size_t size, size_t alignment);
+
+	size_t _chunkSize = 0;
+	std::vector<Chunk> _chunks {};
+	uint32_t _current = 0; // Written last
+	bool _started = false;
+	size_t _openBytes = 0; // Since the last Close
+	StagingStatistics _statistics {};
+};
+
+#endif // STAGINGRING_HPP
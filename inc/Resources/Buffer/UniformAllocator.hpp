@@ -0,0 +1,57 @@
+#ifndef UNIFORMALLOCATOR_HPP
+#define UNIFORMALLOCATOR_HPP
+
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+// Slices of a frame of uniforms packed in a CPU buffer, each one at a multiple
+// of the offset alignment of dynamic bindings, so that the whole frame goes up
+// in a single write
+class UniformAllocator {
+public:
+	// alignment is minUniformBufferOffsetAlignment, a power of two of at least
+	// 4. Throws otherwise, or if capacity is 0. The capacity is rounded up to the
+	// alignment.
+	UniformAllocator(size_t capacity, uint32_t alignment);
+
+	// Offset of a zeroed slice of size bytes. Throws when the slices do not fit
+	// in the capacity anymore.
+	uint32_t Allocate(size_t size);
+
+	// Copies value in a new slice and returns its offset
+	template <typename T>
+	uint32_t Push(T const& value) {
+		static_assert(std::is_trivially_copyable_v<T>, "Uniforms are copied byte by byte");
+
+		uint32_t offset = Allocate(sizeof(T));
+		std::memcpy(&_data[offset], &value, sizeof(T));
+		return offset;
+	}
+
+	uint8_t* GetData(uint32_t offset);
+	uint8_t const* GetData() const;
+
+	// Bytes to upload, up to the end of the last slice, a multiple of 4
+	size_t GetUsedBytes() const;
+	uint32_t GetCount() const;
+
+	size_t GetCapacity() const;
+	uint32_t GetAlignment() const;
+
+	// Forgets the slices, at the start of a frame
+	void Reset();
+
+private:
+	std::vector<uint8_t> _data {};
+	uint32_t _alignment = 0;
+	size_t _next = 0; // Offset of the next slice
+	size_t _used = 0;
+	uint32_t _count = 0;
+};
+
+#endif // UNIFORMALLOCATOR_HPP
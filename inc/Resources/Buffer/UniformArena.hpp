@@ -0,0 +1,78 @@
+#ifndef UNIFORMARENA_HPP
+#define UNIFORMARENA_HPP
+
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Buffer/UniformAllocator.hpp>
+#include <Resources/Buffer/StagingBelt.hpp>
+#include <Helper/Device.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/Buffer.hpp>
+#include <Helper/BufferDescriptor.hpp>
+#include <Helper/BufferBinding.hpp>
+#include <Helper/BufferBindingLayout.hpp>
+
+// Uniforms of many objects in a single buffer, bound once with a dynamic
+// offset per draw instead of a buffer and a bind group per object:
+//
+//     arena.Reset();
+//     uint32_t offset = arena.Push(objectUniforms);
+//     arena.Upload(stagingBelt);
+//     renderPassEncoder->setBindGroup(0, bindGroup.Handle(), 1, &offset);
+//
+// The buffer is written once per frame, before the passes of the frame in the
+// queue, so the previous frame still reads its own uniforms.
+class UniformArena {
+public:
+	// A buffer of capacity bytes, whose slices are at the
+	// minUniformBufferOffsetAlignment of device, each binding bindingSize bytes
+	UniformArena(Device& device, size_t capacity, uint32_t bindingSize);
+
+	// Layout entry and bind group entry of the slices, with a dynamic offset
+	BufferBindingLayout LayoutEntry(uint32_t binding, wgpu::ShaderStage visibility) const;
+	BufferBinding BindGroupEntry(uint32_t binding);
+
+	// Copies uniforms in a new slice and returns its dynamic offset. Throws if
+	// T is larger than the binding or the arena is full.
+	template <typename T>
+	uint32_t Push(T const& uniforms) {
+		if (sizeof(T) > _bindingSize) {
+			throw std::runtime_error("Uniforms of " + std::to_string(sizeof(T)) + " bytes in bindings of " + std::to_string(_bindingSize));
+		}
+
+		static_assert(std::is_trivially_copyable_v<T>, "Uniforms are copied byte by byte");
+
+		// Whole bindings, so that the last one still fits in the buffer
+		uint32_t offset = _allocator.Allocate(_bindingSize);
+		std::memcpy(_allocator.GetData(offset), &uniforms, sizeof(T));
+		return offset;
+	}
+
+	// Every slice pushed since the last Reset, in a single write
+	void Upload(StagingBelt& stagingBelt);
+	void Upload(Queue& queue);
+
+	void Reset();
+
+	uint32_t GetCount() const;
+	uint32_t GetAlignment() const;
+	size_t GetCapacity() const;
+
+	Buffer& GetBuffer() {
+		return _buffer;
+	}
+
+private:
+	UniformAllocator _allocator;
+	uint32_t _bindingSize = 0;
+	Buffer _buffer;
+};
+
+#endif // UNIFORMARENA_HPP
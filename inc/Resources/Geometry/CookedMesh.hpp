@@ -0,0 +1,37 @@
+#ifndef COOKEDMESH_HPP
+#define COOKEDMESH_HPP
+
+#include <vector>
+#include <stdexcept>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Geometry/MeshContainer.hpp>
+#include <Helper/Device.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/Buffer.hpp>
+#include <Helper/BufferDescriptor.hpp>
+#include <Helper/VertexAttribute.hpp>
+#include <Helper/VertexBufferLayout.hpp>
+
+wgpu::VertexFormat GetVertexFormat(MeshAttributeFormat format);
+
+// Uint16 or Uint32, as the indices of container
+wgpu::IndexFormat GetIndexFormat(MeshContainer const& container);
+
+// Vertex fetch of the vertices of container, at the locations it gives
+std::vector<VertexAttribute> GetVertexAttributes(MeshContainer const& container);
+
+// Layout of the vertex buffer of container, pointing to attributes, which
+// must outlive it
+VertexBufferLayout GetVertexBufferLayout(MeshContainer const& container, std::vector<VertexAttribute> const& attributes);
+
+// Descriptors of buffers large enough for the vertices and indices of container
+BufferDescriptor GetVertexBufferDescriptor(MeshContainer const& container);
+BufferDescriptor GetIndexBufferDescriptor(MeshContainer const& container);
+
+// Vertices and indices of container written straight from the mapping of the
+// file to buffers of the descriptors above
+void WriteMeshContainer(Queue& queue, Buffer& vertexBuffer, Buffer& indexBuffer, MeshContainer const& container);
+
+#endif // COOKEDMESH_HPP
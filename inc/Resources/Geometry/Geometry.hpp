@@ -4,10 +4,9 @@
 #include <filesystem>
 #include <fstream>
 #include <vector>
+#include <thread>
 #include <cstring>
 
-#include <tiny_obj_loader.h>
-
 #include <stb_image.h>
 
 #include <Helper/Device.hpp>
@@ -17,19 +16,23 @@
 #include <Helper/Texture.hpp>
 #include <Helper/TextureView.hpp>
 #include <Helper/VertexAttribute.hpp>
+#include <Helper/VertexBufferLayout.hpp>
 
-#include <Math/Vector2.hpp>
-#include <Math/Vector3.hpp>
-
-struct VertexAttributes {
-	Math::Vector3 position {};
-};
+#include <Resources/Geometry/GeometryLoader.hpp>
+#include <Resources/Geometry/VertexQuantization.hpp>
+#include <Resources/Texture/MipMaps.hpp>
 
 void WriteMipMaps(wgpu::Device device, wgpu::Texture texture, wgpu::Extent3D textureSize, uint32_t mipLevelCount, unsigned char* const data);
 
 wgpu::Texture LoadTexture(std::filesystem::path const& path, wgpu::Device device, wgpu::TextureView* pTextureView = nullptr);
 
-bool LoadGeometry(std::filesystem::path const& path, std::vector<float>& pointData, std::vector<uint16_t>& indexData, int dimensions);
-bool LoadGeometryFromOBJ(std::filesystem::path const& path, std::vector<VertexAttributes>& vertexData);
+// Vertex fetch of QuantizedVertex: the position at location 0, the normal at
+// 1 and the texture coordinates at 2. The shader multiplies the position by
+// the dequantization matrix of the mesh and decodes the octahedral normal.
+std::vector<VertexAttribute> GetQuantizedVertexAttributes();
+
+// Layout of a buffer of QuantizedVertex, pointing to attributes, which must
+// outlive it
+VertexBufferLayout GetQuantizedVertexBufferLayout(std::vector<VertexAttribute> const& attributes);
 
 #endif // GEOMETRY_HPP
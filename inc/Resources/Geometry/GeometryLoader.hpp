@@ -0,0 +1,29 @@
+#ifndef GEOMETRY_LOADER_HPP
+#define GEOMETRY_LOADER_HPP
+
+#include <filesystem>
+#include <vector>
+#include <cstdint>
+
+#include <Math/Vector.hpp>
+#include <Math/BVH.hpp>
+
+#include <Resources/Geometry/Mesh.hpp>
+
+// Loading of geometry on the CPU only, without any GPU object, so that it can
+// be used and measured outside of the application
+
+// Points and triangles of a [points]/[indices] file, read from a mapping of
+// the file by ParseGeometry. Returns false if the file cannot be read or parsed.
+bool LoadGeometry(std::filesystem::path const& path, std::vector<float>& pointData, std::vector<uint32_t>& indexData, int dimensions);
+// Appends a vertex per corner of each triangle of every shape to vertexData
+bool LoadGeometryFromOBJ(std::filesystem::path const& path, std::vector<VertexAttributes>& vertexData);
+
+// Unique vertices of every shape, welded by position, normal and texture
+// coordinates, and a part of the indices per shape
+bool LoadMeshFromOBJ(std::filesystem::path const& path, IndexedMesh& mesh);
+
+// Hierarchy over the triangles of the vertices given by LoadGeometryFromOBJ, for picking and collisions
+Math::BVH BuildBVH(std::vector<VertexAttributes> const& vertexData, unsigned threadCount = 1);
+
+#endif // GEOMETRY_LOADER_HPP
@@ -0,0 +1,19 @@
+#ifndef GEOMETRY_PARSER_HPP
+#define GEOMETRY_PARSER_HPP
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+// Parser of the [points]/[indices] format of LoadGeometry, on text already in
+// memory (usually a mapped file). Each point is dimensions + 3 floats (the
+// position and a color), each triangle 3 indices, one per line, '#' starting
+// a comment line.
+//
+// The lines of each section are counted first so that both vectors are
+// allocated once, then the numbers are read in place with std::from_chars.
+// Returns false, with both vectors empty, if a line does not hold the
+// expected numbers. Blanks around the lines are ignored.
+bool ParseGeometry(std::string_view text, std::vector<float>& pointData, std::vector<uint32_t>& indexData, int dimensions);
+
+#endif // GEOMETRY_PARSER_HPP
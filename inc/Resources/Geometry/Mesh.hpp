@@ -0,0 +1,94 @@
+#ifndef MESH_HPP
+#define MESH_HPP
+
+#include <string>
+#include <span>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+#include <Math/Vector.hpp>
+#include <Math/Bounds.hpp>
+
+struct VertexAttributes {
+public:
+	Math::Vector3 position {};
+	Math::Vector3 normal {};
+	Math::Vector2 uv {};
+};
+
+// Indices of a shape of the source file, drawn with its own material
+struct MeshPart {
+public:
+	std::string name {};
+	uint32_t firstIndex = 0;
+	uint32_t indexCount = 0;
+};
+
+// Unique vertices and the triangles indexing them, instead of a vertex per
+// corner of each triangle
+struct IndexedMesh {
+public:
+	std::vector<VertexAttributes> vertices {};
+	std::vector<uint32_t> indices {};
+	std::vector<MeshPart> parts {};
+};
+
+// Bytes of the mesh on the GPU, against the same triangles as a soup of
+// vertices without indices
+struct MeshMemory {
+public:
+	size_t soupBytes = 0;
+	size_t vertexBytes = 0;
+	size_t indexBytes = 0;
+
+	size_t GetSavedBytes() const {
+		return soupBytes > vertexBytes + indexBytes ? soupBytes - (vertexBytes + indexBytes) : 0;
+	}
+};
+
+// Appends the corners of triangles to a mesh, a vertex equal to one already
+// added (bit for bit, 0 and -0 being the same) giving back its index
+class VertexWelder {
+public:
+	explicit VertexWelder(IndexedMesh& mesh, size_t expectedVertexCount = 0);
+
+	// Index of vertex in the mesh, also appended to its indices
+	uint32_t Add(VertexAttributes const& vertex);
+
+private:
+	struct Hash {
+	public:
+		size_t operator()(VertexAttributes const& vertex) const;
+	};
+
+	struct Equal {
+	public:
+		bool operator()(VertexAttributes const& lhs, VertexAttributes const& rhs) const;
+	};
+
+	IndexedMesh& _mesh;
+	std::unordered_map<VertexAttributes, uint32_t, Hash, Equal> _indices {};
+};
+
+// A single part indexing the unique vertices of a triangle soup
+IndexedMesh WeldVertices(std::vector<VertexAttributes> const& corners);
+
+// Whether every index fits in 16 bits, halving the index buffer
+bool HasShortIndices(IndexedMesh const& mesh);
+
+// 2 or 4 bytes, 2 up to 65536 vertices
+uint32_t GetIndexSize(IndexedMesh const& mesh);
+uint32_t GetIndexSize(size_t vertexCount);
+
+// Indices in GetIndexSize bytes each, ready for the index buffer
+std::vector<uint8_t> PackIndices(IndexedMesh const& mesh);
+std::vector<uint8_t> PackIndices(std::span<uint32_t const> indices, uint32_t indexSize);
+
+MeshMemory GetMeshMemory(IndexedMesh const& mesh);
+
+// Box around the positions of the vertices, empty at the origin without any
+Math::AABB GetBounds(IndexedMesh const& mesh);
+
+#endif // MESH_HPP
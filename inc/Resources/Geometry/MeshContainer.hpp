@@ -0,0 +1,159 @@
+#ifndef MESHCONTAINER_HPP
+#define MESHCONTAINER_HPP
+
+#include <filesystem>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Math/Bounds.hpp>
+#include <Math/Matrix.hpp>
+#include <Utils/MappedFile.hpp>
+#include <Resources/Geometry/Mesh.hpp>
+#include <Resources/Geometry/MeshOptimizer.hpp>
+#include <Resources/Geometry/VertexQuantization.hpp>
+
+// Mesh cooked offline, its vertex and index buffers ready to be uploaded as
+// they are. A header, then the attributes of the vertices, then the sections
+// at the offsets of the header: vertices, indices, parts and the optional
+// meshlets. Every value is little-endian.
+enum class MeshAttributeFormat : uint32_t {
+	Float32x2 = 1,
+	Float32x3 = 2,
+	Snorm16x2 = 3,
+	Snorm16x4 = 4,
+	Float16x2 = 5,
+};
+
+struct MeshContainerAttribute {
+public:
+	uint32_t location = 0;
+	MeshAttributeFormat format = MeshAttributeFormat::Float32x3;
+	uint32_t offset = 0; // In bytes, in a vertex
+	uint32_t reserved = 0;
+};
+
+struct MeshContainerPart {
+public:
+	uint32_t firstIndex = 0;
+	uint32_t indexCount = 0;
+};
+
+struct MeshContainerMeshlet {
+public:
+	uint32_t vertexOffset = 0;
+	uint32_t vertexCount = 0;
+	uint32_t triangleOffset = 0;
+	uint32_t triangleCount = 0;
+	std::array<float, 3> boundsMin {};
+	std::array<float, 3> boundsMax {};
+};
+
+struct MeshContainerHeader {
+public:
+	static constexpr std::array<char, 8> magic { 'G', 'S', 'M', 'S', 'H', '\r', '\n', '\x1a' };
+	static constexpr uint32_t currentVersion = 1;
+	static constexpr uint32_t quantizedFlag = 1; // Positions in the bounds, see QuantizedVertex
+
+	std::array<char, 8> identifier = magic;
+	uint32_t version = currentVersion;
+	uint32_t flags = 0;
+	uint32_t vertexStride = 0;
+	uint32_t attributeCount = 0;
+	uint32_t vertexCount = 0;
+	uint32_t indexSize = 0; // 2 or 4
+	uint32_t indexCount = 0;
+	uint32_t partCount = 0;
+	uint32_t meshletCount = 0;
+	uint32_t meshletVertexCount = 0;
+	uint32_t meshletTriangleCount = 0;
+	uint32_t reserved = 0;
+	std::array<float, 3> boundsMin {};
+	std::array<float, 3> boundsMax {};
+	uint64_t vertexOffset = 0; // In bytes, from the start of the file
+	uint64_t indexOffset = 0;
+	uint64_t partOffset = 0;
+	uint64_t meshletOffset = 0;
+	uint64_t meshletVertexOffset = 0;
+	uint64_t meshletTriangleOffset = 0;
+};
+
+static_assert(sizeof(MeshContainerHeader) == 128, "The header of mesh containers must not have padding.");
+static_assert(sizeof(MeshContainerAttribute) == 16, "The attributes of mesh containers must not have padding.");
+static_assert(sizeof(MeshContainerPart) == 8, "The parts of mesh containers must not have padding.");
+static_assert(sizeof(MeshContainerMeshlet) == 40, "The meshlets of mesh containers must not have padding.");
+
+// In bytes, of an attribute of this format
+uint32_t GetAttributeSize(MeshAttributeFormat format);
+
+// MARK: Reading
+// Container mapped in memory: the vertices and indices are read from the
+// file only when they are uploaded, without any copy. The indices are not
+// checked against the vertex count, which the robust buffer access of the
+// GPU takes care of.
+class MeshContainer {
+public:
+	MeshContainer() = default;
+
+	// Throws if the file cannot be mapped or is not a valid container
+	explicit MeshContainer(std::filesystem::path const& path);
+
+	std::vector<MeshContainerAttribute> const& GetAttributes() const;
+	uint32_t GetVertexStride() const;
+	uint32_t GetVertexCount() const;
+	uint32_t GetIndexSize() const;
+	uint32_t GetIndexCount() const;
+	bool IsQuantized() const;
+
+	// Identity for the full precision positions
+	Math::Matrix4x4 GetDequantization() const;
+	Math::AABB GetBounds() const;
+
+	// Sizes are multiples of 4 bytes, as writeBuffer needs, the padding being
+	// zeroes
+	uint8_t const* GetVertexData() const;
+	size_t GetVertexDataSize() const;
+	uint8_t const* GetIndexData() const;
+	size_t GetIndexDataSize() const;
+
+	std::vector<MeshContainerPart> const& GetParts() const;
+
+	uint32_t GetMeshletCount() const;
+	MeshContainerMeshlet GetMeshlet(uint32_t meshlet) const;
+	uint32_t GetMeshletVertex(uint32_t index) const;
+	uint8_t const* GetMeshletTriangles() const; // 3 bytes per triangle
+
+private:
+	Utils::MappedFile _file {};
+	MeshContainerHeader _header {};
+	std::vector<MeshContainerAttribute> _attributes {};
+	std::vector<MeshContainerPart> _parts {};
+};
+
+// MARK: Writing
+// The data of the mesh is not copied and must stay valid until Write
+class MeshContainerWriter {
+public:
+	// Throws if a part is out of the indices
+	explicit MeshContainerWriter(IndexedMesh const& mesh);
+	explicit MeshContainerWriter(QuantizedMesh const& mesh);
+
+	// Meshlets of the same indices, copied
+	void SetMeshlets(Meshlets const& meshlets);
+
+	// Throws if the file cannot be written
+	void Write(std::filesystem::path const& path) const;
+
+private:
+	MeshContainerHeader _header {};
+	std::vector<MeshContainerAttribute> _attributes {};
+	uint8_t const* _vertices = nullptr;
+	std::vector<uint8_t> _indices {};
+	std::vector<MeshContainerPart> _parts {};
+	std::vector<MeshContainerMeshlet> _meshlets {};
+	std::vector<uint32_t> _meshletVertices {};
+	std::vector<uint8_t> _meshletTriangles {};
+};
+
+#endif // MESHCONTAINER_HPP
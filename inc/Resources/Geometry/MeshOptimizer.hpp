@@ -0,0 +1,71 @@
+#ifndef MESH_OPTIMIZER_HPP
+#define MESH_OPTIMIZER_HPP
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Math/Bounds.hpp>
+
+#include <Resources/Geometry/Mesh.hpp>
+
+// Reordering of the triangles and vertices of a mesh for the GPU, applied
+// after import with OptimizeMesh. Indices are triangle lists, and every
+// function throws if one is out of range.
+
+// Misses of a FIFO post-transform cache of cacheSize vertices over the
+// triangles, the usual measure of a triangle order
+struct VertexCacheStatistics {
+public:
+	uint32_t misses = 0;
+	float acmr = 0.0f; // Misses per triangle, 3 at worst and about 0.5 at best on large regular meshes
+	float atvr = 0.0f; // Misses per vertex used, 1 at best
+};
+
+VertexCacheStatistics AnalyzeVertexCache(std::span<uint32_t const> indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+// Triangles in the order of Tipsify (Sander et al. 2007): fans around a
+// vertex, the next one being the oldest one still in the cache once its
+// triangles are emitted
+void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+// Clusters of triangles given by OptimizeVertexCache, cut where their cache
+// misses stay within threshold of the whole order, sorted so that the ones
+// facing out of the mesh are drawn first and occlude the others
+void OptimizeOverdraw(std::span<uint32_t> indices, std::vector<VertexAttributes> const& vertices, uint32_t cacheSize = 16, float threshold = 1.05f);
+
+// Vertices in the order of their first use by the indices, unused ones
+// removed, so that the vertex fetch reads the buffer forward
+void OptimizeVertexFetch(IndexedMesh& mesh);
+
+// All of the above, the triangles of each part staying in their part
+void OptimizeMesh(IndexedMesh& mesh, uint32_t cacheSize = 16);
+
+// MARK: Meshlets
+// Small clusters of triangles, culled as a whole against the frustum
+struct Meshlet {
+public:
+	uint32_t vertexOffset = 0;   // In the vertices of the meshlets
+	uint32_t vertexCount = 0;
+	uint32_t triangleOffset = 0; // In the triangles of the meshlets
+	uint32_t triangleCount = 0;
+	Math::AABB bounds {};
+};
+
+// Triangles of the meshlets as 3 indices of a byte each into the vertices of
+// their meshlet, which are indices of the vertices of the mesh
+struct Meshlets {
+public:
+	std::vector<Meshlet> meshlets {};
+	std::vector<uint32_t> vertices {};
+	std::vector<uint8_t> triangles {};
+};
+
+// The triangles in their order, a new meshlet starting when maxVertices or
+// maxTriangles would be exceeded, which should come after OptimizeMesh so
+// that neighbor triangles are together. Throws if maxVertices is not in
+// [3, 256] or maxTriangles is 0.
+Meshlets BuildMeshlets(IndexedMesh const& mesh, uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+
+#endif // MESH_OPTIMIZER_HPP
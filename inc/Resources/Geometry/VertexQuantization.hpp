@@ -0,0 +1,57 @@
+#ifndef VERTEX_QUANTIZATION_HPP
+#define VERTEX_QUANTIZATION_HPP
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include <Math/Vector.hpp>
+#include <Math/Matrix.hpp>
+#include <Math/Bounds.hpp>
+
+#include <Resources/Geometry/Mesh.hpp>
+
+// VertexAttributes in 16 bytes instead of 32, read by the vertex fetch as:
+// - position: Snorm16x4, in the bounds of the mesh, w being 1
+// - normal: Snorm16x2, octahedral encoding of the unit normal
+// - uv: Float16x2
+struct QuantizedVertex {
+public:
+	std::array<int16_t, 4> position {};
+	std::array<int16_t, 2> normal {};
+	Math::Vector2h uv {};
+};
+
+static_assert(sizeof(QuantizedVertex) == 16, "QuantizedVertex must be tightly packed");
+
+// Vertices of an IndexedMesh quantized in its bounds. The dequantization
+// matrix takes the [-1, 1] positions of the vertex fetch back to the space
+// of the mesh, and is applied before the model matrix.
+struct QuantizedMesh {
+public:
+	std::vector<QuantizedVertex> vertices {};
+	std::vector<uint32_t> indices {};
+	std::vector<MeshPart> parts {};
+	Math::AABB bounds {};
+	Math::Matrix4x4 dequantization = Math::Matrix4x4::Identity();
+};
+
+QuantizedMesh QuantizeMesh(IndexedMesh const& mesh);
+
+// Positions in [-1, 1] to the box
+Math::Matrix4x4 GetDequantizationMatrix(Math::AABB const& bounds);
+
+QuantizedVertex QuantizeVertex(VertexAttributes const& vertex, Math::AABB const& bounds);
+VertexAttributes DequantizeVertex(QuantizedVertex const& vertex, Math::AABB const& bounds);
+
+// Unit vector on the octahedron |x| + |y| + |z| = 1, its lower half folded
+// on the upper one, in [-1, 1]^2. A null vector gives (0, 0), decoded as +Z.
+Math::Vector2 EncodeOctahedral(Math::Vector3 const& normal);
+Math::Vector3 DecodeOctahedral(Math::Vector2 const& encoded);
+
+// Snorm16 as read by the vertex fetch: value * 32767 rounded, -32768 reading
+// as -1 too
+int16_t EncodeSnorm16(float value);
+float DecodeSnorm16(int16_t value);
+
+#endif // VERTEX_QUANTIZATION_HPP
@@ -0,0 +1,68 @@
+#ifndef BLOCKCOMPRESSION_HPP
+#define BLOCKCOMPRESSION_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Resources/Texture/MipMaps.hpp>
+
+// Formats of 4x4 blocks sampled directly by the GPU. Whether the colors are
+// sRGB only changes the format of the texture, the blocks are the same.
+enum class BlockFormat {
+	BC1, // 8 bytes: 2 colors in 5:6:5 and 2 between them, opaque
+	BC3, // 16 bytes: the colors of BC1, then 2 alphas and 6 between them
+	BC7, // 16 bytes: 2 RGBA colors in 7 bits plus a shared bit, and 14 between them
+};
+
+// Bytes of a block, 8 or 16
+size_t BlockBytes(BlockFormat format);
+
+// Blocks along a dimension, the last one being partial when size is not a
+// multiple of 4
+constexpr uint32_t BlockCount(uint32_t size) {
+	return (size + 3) / 4;
+}
+
+// Bytes of an image of width x height once compressed
+size_t CompressedSize(BlockFormat format, uint32_t width, uint32_t height);
+
+// Blocks of an RGBA8 image, row by row, in CompressedSize(format, width,
+// height) bytes. The partial blocks along the right and bottom borders repeat
+// the last column and row. BC1 and BC3 are the fast path: endpoints along the
+// principal axis of the block, refined once by least squares. BC7 only uses
+// mode 6, a single pair of RGBA endpoints with 16 levels between them,
+// refined twice and with every combination of the shared bits tried. Rows of
+// blocks are spread over threadCount threads for large images; the result
+// does not depend on threadCount.
+void CompressRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, BlockFormat format, unsigned threadCount = 1);
+
+// RGBA8 image of width x height from its blocks, for tests and for the GPUs
+// without block compression. BC7 blocks of another mode than 6 are decoded
+// as transparent black.
+void DecompressRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, BlockFormat format, unsigned threadCount = 1);
+
+// Every level of a mip chain compressed in a single allocation, ready to be
+// uploaded level by level. The offsets of the levels are in compressed bytes.
+class BlockCompressedChain {
+public:
+	BlockCompressedChain() = default;
+	BlockCompressedChain(MipChain const& chain, BlockFormat format, unsigned threadCount = 1);
+
+	BlockFormat GetFormat() const;
+	uint32_t GetLevelCount() const;
+	MipChain::Level const& GetLevel(uint32_t level) const;
+	uint8_t const* GetData(uint32_t level) const;
+	size_t GetSize(uint32_t level) const; // In bytes
+
+	// Bytes of a row of blocks of a level, and rows of blocks of a level
+	uint32_t GetRowSize(uint32_t level) const;
+	uint32_t GetRowCount(uint32_t level) const;
+
+private:
+	BlockFormat _format = BlockFormat::BC1;
+	std::vector<MipChain::Level> _levels {};
+	std::vector<uint8_t> _data {};
+};
+
+#endif // BLOCKCOMPRESSION_HPP
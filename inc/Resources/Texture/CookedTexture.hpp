@@ -0,0 +1,43 @@
+#ifndef COOKEDTEXTURE_HPP
+#define COOKEDTEXTURE_HPP
+
+#include <vector>
+#include <optional>
+#include <stdexcept>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/Texture.hpp>
+#include <Helper/Origin3D.hpp>
+#include <Helper/Extent3D.hpp>
+#include <Helper/TexelCopyTextureInfo.hpp>
+#include <Helper/TexelCopyBufferLayout.hpp>
+
+// Format of the textures made from a container of this format. Without
+// blockCompression, the block-compressed formats give RGBA8 textures, and
+// WriteTextureContainer decompresses the levels.
+wgpu::TextureFormat GetTextureFormat(TextureContainerFormat format, bool blockCompression);
+
+// Blocks of a texture format, if it is block-compressed
+std::optional<BlockFormat> GetBlockFormat(wgpu::TextureFormat format);
+
+// Color space in which the texture is sampled
+ColorSpace GetColorSpace(wgpu::TextureFormat format);
+
+// Whether the RGBA8 pixels of an Image can be uploaded as they are to a
+// texture of this format
+bool IsRGBA8(wgpu::TextureFormat format);
+
+// Every level of every layer of container, written to the same level and
+// layer of texture straight from the mapping of the file, or decompressed
+// level by level when texture is not block-compressed
+void WriteTextureContainer(Queue& queue, Texture& texture, TextureContainer const& container);
+
+// Every level of chain written to layer of texture, which has its format
+void WriteBlockCompressedChain(Queue& queue, Texture& texture, BlockCompressedChain const& chain, uint32_t layer = 0);
+
+#endif // COOKEDTEXTURE_HPP
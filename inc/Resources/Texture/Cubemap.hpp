@@ -5,10 +5,21 @@
 #include <filesystem>
 #include <stdexcept>
 #include <array>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <optional>
 
 #include <wgpu-native/webgpu.hpp>
 
 #include <Resources/Texture/Texture2D.hpp>
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Resources/Texture/CookedTexture.hpp>
+#include <Utils/ThreadPool.hpp>
 #include <Helper/Device.hpp>
 #include <Helper/Queue.hpp>
 #include <Helper/TextureDescriptor.hpp>
@@ -18,9 +29,40 @@
 #include <Helper/Origin3D.hpp>
 #include <Helper/Extent3D.hpp>
 
+// Mip levels of the faces of a cubemap
+struct CubemapMipMaps {
+public:
+	uint32_t levelCount = 0; // 0 for every level down to 1x1, 1 for none
+	MipFilter filter = MipFilter::Box;
+	bool seamAware = true; // See GenerateCubemapMipChains
+};
+
+// Wall-clock durations of the creation of a cubemap, in seconds
+struct CubemapTimings {
+public:
+	double decoding = 0.0; // Waiting for the faces to be decoded and filtered
+	double seams = 0.0;
+	double compression = 0.0; // Waiting for the faces to be compressed, after the decoding and seams
+	double uploads = 0.0;
+	double total = 0.0;
+};
+
 class Cubemap {
 public:
-	Cubemap(std::array<std::filesystem::path, 6> const& texturePaths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+	// The faces must be square. The size and level count of textureDescriptor
+	// and the level count of textureViewDescriptor are set from the faces.
+	// Each face is decoded and filtered by a task of threadPool, and uploaded
+	// from this thread once it and the faces before it are done, unless the
+	// seams need all of them. With a block-compressed format, each face is
+	// then compressed by another task, and the size must be a multiple of 4.
+	Cubemap(std::array<std::filesystem::path, 6> const& texturePaths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool, CubemapMipMaps const& mipMaps = {});
+
+	// Every level of a cooked cubemap, with its seams already fixed. The
+	// format, size and level count of textureDescriptor, and the format and
+	// level count of the view, are set from the container, block-compressed
+	// containers being decompressed when the device cannot sample them. Only
+	// the uploads and the total are timed.
+	Cubemap(TextureContainer const& container, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
 
 public:
 	Texture2D* operator[](size_t index);
@@ -34,10 +76,15 @@ public:
 		return _textureView;
 	}
 
+	CubemapTimings const& Timings() const {
+		return _timings;
+	}
+
 private:
 	std::array<Texture2D, 6> _textures {};
 	Texture _texture {};
 	TextureView _textureView {};
+	CubemapTimings _timings {};
 };
 
 #endif // CUBEMAP_HPP
@@ -0,0 +1,59 @@
+#ifndef IMAGE_HPP
+#define IMAGE_HPP
+
+#include <filesystem>
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include <Utils/ThreadPool.hpp>
+
+// RGBA8 pixels decoded on the CPU, whatever the channels of the file
+class Image {
+public:
+	Image() = default;
+
+	// Throws if the file cannot be read or decoded
+	static Image Load(std::filesystem::path const& path);
+
+	uint32_t Width() const {
+		return _width;
+	}
+
+	uint32_t Height() const {
+		return _height;
+	}
+
+	uint8_t const* Data() const {
+		return _data.get();
+	}
+
+	size_t Size() const {
+		return 4 * static_cast<size_t>(_width) * _height;
+	}
+
+private:
+	struct Deleter {
+		void operator()(uint8_t* data) const;
+	};
+
+	std::unique_ptr<uint8_t, Deleter> _data {};
+	uint32_t _width = 0;
+	uint32_t _height = 0;
+};
+
+// The 6 faces of a cubemap, in the order of its layers. Throws if a face
+// cannot be loaded or if the faces do not all have the same size.
+std::array<Image, 6> LoadCubemapFaces(std::array<std::filesystem::path, 6> const& paths);
+
+// Same, the faces being decoded at the same time by the threads of threadPool
+std::array<Image, 6> LoadCubemapFaces(std::array<std::filesystem::path, 6> const& paths, Utils::ThreadPool& threadPool);
+
+// Images decoded at the same time by the threads of threadPool, in the order
+// of paths. Throws the error of the first image that failed, once they are
+// all done.
+std::vector<Image> LoadImages(std::vector<std::filesystem::path> const& paths, Utils::ThreadPool& threadPool);
+
+#endif // IMAGE_HPP
@@ -0,0 +1,95 @@
+#ifndef MIPMAPS_HPP
+#define MIPMAPS_HPP
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Size of the level below: half of the size rounded down, and at least 1
+constexpr uint32_t NextMipSize(uint32_t size) {
+	return size > 1 ? size / 2 : 1;
+}
+
+// Levels down to 1x1, 0 for an empty image
+uint32_t MipLevelCount(uint32_t width, uint32_t height);
+
+enum class MipFilter {
+	Box,     // Average of each 2x2 block, the fastest
+	Kaiser,  // Kaiser-windowed sinc over 3 pixels of the level, sharper
+	Lanczos, // Lanczos-windowed sinc over 3 pixels of the level, the sharpest, may ring
+};
+
+// Encoding of the red, green and blue channels; alpha is always linear
+enum class ColorSpace {
+	Linear, // RGBA8Unorm
+	Srgb,   // RGBA8UnormSrgb: filtered after conversion to linear, then encoded back
+};
+
+// sRGB transfer functions, exact to the rounding of the 8 bit value
+float SrgbToLinear(uint8_t value);
+uint8_t LinearToSrgb(float value);
+
+// Next mip level of an RGBA8 image, NextMipSize(width) x NextMipSize(height).
+// Each pixel is the rounded average of a 2x2 block of the source. Along an odd
+// dimension, the last pixels also average the last column or row of the
+// source, so that every source pixel is used. Rows are spread over threadCount
+// threads for large images; the result does not depend on threadCount.
+void DownsampleRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, unsigned threadCount = 1);
+
+// Same, with another filter or sRGB colors. The Kaiser and Lanczos kernels
+// are centered on each destination pixel and read past the borders by
+// repeating the last pixels. With the box filter, the blocks are the same as
+// above and the average is done in linear space.
+void DownsampleRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, MipFilter filter, ColorSpace colorSpace, unsigned threadCount = 1);
+
+// Mip levels of an RGBA8 image in a single allocation, level 0 being a copy
+// of the image, ready to be uploaded level by level. Each level is filtered
+// from the one above it; the box filter on linear colors is the default.
+class MipChain {
+public:
+	struct Level {
+	public:
+		uint32_t width = 0;
+		uint32_t height = 0;
+		size_t offset = 0; // In bytes, from the start of the chain
+	};
+
+	MipChain() = default;
+
+	// With levelCount = 0, every level down to 1x1. Throws if levelCount is
+	// larger than MipLevelCount(width, height).
+	MipChain(uint8_t const* data, uint32_t width, uint32_t height, uint32_t levelCount = 0, unsigned threadCount = 1);
+	MipChain(uint8_t const* data, uint32_t width, uint32_t height, MipFilter filter, ColorSpace colorSpace, uint32_t levelCount = 0, unsigned threadCount = 1);
+
+	// Same as the constructors, reusing the memory of the chain when it is large enough
+	void Generate(uint8_t const* data, uint32_t width, uint32_t height, uint32_t levelCount = 0, unsigned threadCount = 1);
+	void Generate(uint8_t const* data, uint32_t width, uint32_t height, MipFilter filter, ColorSpace colorSpace, uint32_t levelCount = 0, unsigned threadCount = 1);
+
+	uint32_t GetLevelCount() const;
+	Level const& GetLevel(uint32_t level) const;
+	uint8_t const* GetData(uint32_t level) const;
+	uint8_t* GetData(uint32_t level);
+	size_t GetSize(uint32_t level) const; // In bytes
+
+	// Every level, one after the other
+	std::vector<uint8_t> const& GetBuffer() const;
+
+private:
+	std::vector<Level> _levels {};
+	std::vector<uint8_t> _data {};
+};
+
+// Mip chains of the 6 square faces of a cubemap, in the order of its layers
+// (+X, -X, +Y, -Y, +Z, -Z), the faces being spread over threadCount threads.
+// The filters do not read across the faces, so with seamAware, the texels
+// along the edges of every level but the first are replaced by the average of
+// the texels they touch on the neighbouring faces, and the corners by the
+// average of the 3 faces. Throws like MipChain::Generate.
+std::array<MipChain, 6> GenerateCubemapMipChains(std::array<uint8_t const*, 6> const& faces, uint32_t size, MipFilter filter, ColorSpace colorSpace, bool seamAware, uint32_t levelCount = 0, unsigned threadCount = 6);
+
+// The seam-aware step of GenerateCubemapMipChains, for chains generated
+// separately. Throws if the faces are not square and of the same size.
+void FixCubemapSeams(std::array<MipChain, 6>& chains, ColorSpace colorSpace);
+
+#endif // MIPMAPS_HPP
@@ -0,0 +1,59 @@
+#ifndef MIPRESIDENCY_HPP
+#define MIPRESIDENCY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Levels of a mip chain uploaded one by one from the smallest, down to
+// baseLevel, the largest level allocated on the GPU. Level levelCount - 1 is
+// the 1x1 one.
+class MipResidency {
+public:
+	MipResidency() = default;
+
+	// Throws if baseLevel is not a level of the chain
+	MipResidency(uint32_t levelCount, uint32_t baseLevel);
+
+	uint32_t GetLevelCount() const;
+	uint32_t GetBaseLevel() const;
+
+	// Largest level uploaded, levelCount when none is
+	uint32_t GetResidentLevel() const;
+
+	bool IsEmpty() const;
+	bool IsComplete() const;
+
+	// Level to upload next, when the residency is not complete
+	uint32_t GetNextLevel() const;
+	void MarkNextLevelUploaded();
+
+	// The levels that can be sampled, relative to the texture, which starts at baseLevel
+	uint32_t GetViewBaseLevel() const;
+	uint32_t GetViewLevelCount() const;
+
+private:
+	uint32_t _levelCount = 0;
+	uint32_t _baseLevel = 0;
+	uint32_t _residentLevel = 0;
+};
+
+// Bytes that may be uploaded during a frame. Unless the budget is 0, the first
+// upload of a frame is always accepted, so that a level larger than the budget
+// still goes up.
+class UploadBudget {
+public:
+	explicit UploadBudget(size_t bytes);
+
+	// Consumes bytes if they fit or if nothing was consumed yet
+	bool TryConsume(size_t bytes);
+
+	size_t GetUsed() const;
+	size_t GetRemaining() const;
+
+private:
+	size_t _bytes = 0;
+	size_t _used = 0;
+	bool _started = false;
+};
+
+#endif // MIPRESIDENCY_HPP
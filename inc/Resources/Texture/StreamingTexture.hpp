@@ -0,0 +1,166 @@
+#ifndef STREAMINGTEXTURE_HPP
+#define STREAMINGTEXTURE_HPP
+
+#include <iostream>
+#include <filesystem>
+#include <stdexcept>
+#include <array>
+#include <vector>
+#include <memory>
+#include <future>
+#include <chrono>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/MipResidency.hpp>
+#include <Resources/Texture/CookedTexture.hpp>
+#include <Utils/ThreadPool.hpp>
+#include <Helper/Device.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/TextureDescriptor.hpp>
+#include <Helper/TextureViewDescriptor.hpp>
+#include <Helper/Texture.hpp>
+#include <Helper/TextureView.hpp>
+#include <Helper/Origin3D.hpp>
+#include <Helper/Extent3D.hpp>
+#include <Helper/TexelCopyTextureInfo.hpp>
+#include <Helper/TexelCopyBufferLayout.hpp>
+
+struct StreamingTextureOptions {
+public:
+	MipFilter filter = MipFilter::Box;
+	uint32_t wantedLevel = 0; // See StreamingTexture::SetWantedLevel
+	std::array<uint8_t, 4> placeholder { 128, 128, 128, 255 }; // RGBA8 color shown until the image is decoded
+};
+
+// 2D texture whose mip levels are uploaded little by little by a
+// TextureStreamer, from the smallest one. Until the image is decoded, View()
+// is a 1x1 texture of the placeholder color. The mip chain stays in memory so
+// that the wanted level can change.
+class StreamingTexture {
+public:
+	StreamingTexture(StreamingTexture const&) = delete;
+	StreamingTexture& operator=(StreamingTexture const&) = delete;
+
+	TextureView const& View() const {
+		return _current.view;
+	}
+
+	// Changes every time View() is another view, after which the bind groups
+	// that use it must be created again
+	uint64_t GetViewVersion() const {
+		return _viewVersion;
+	}
+
+	bool IsDecoded() const {
+		return _decoded;
+	}
+
+	// The image could not be decoded, the placeholder stays in View()
+	bool HasFailed() const {
+		return _failed;
+	}
+
+	// Every wanted level can be sampled
+	bool IsComplete() const;
+
+	// 0 until the image is decoded
+	uint32_t GetLevelCount() const;
+
+	// Largest level of the image that can be sampled, GetLevelCount() while
+	// the placeholder is shown
+	uint32_t GetResidentLevel() const;
+
+	// Largest level to keep on the GPU, 0 for the full resolution: distant
+	// objects can keep only their small levels. The texture is allocated again
+	// when it changes, the current one staying in View() until the new one has
+	// as many levels. Clamped to the levels of the image.
+	void SetWantedLevel(uint32_t level);
+	uint32_t GetWantedLevel() const {
+		return _wantedLevel;
+	}
+
+	// Bytes of the textures allocated on the GPU for this one
+	size_t GetAllocatedBytes() const;
+
+private:
+	friend class TextureStreamer;
+
+	struct Allocation {
+	public:
+		Texture texture {};
+		TextureView view {};
+		MipResidency residency {};
+		size_t bytes = 0;
+	};
+
+	StreamingTexture(Device& device, Queue& queue, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, StreamingTextureOptions const& options);
+
+	// Allocation of the texture from level, without any level uploaded
+	Allocation Allocate(uint32_t level);
+
+	void UploadNextLevel(Allocation& allocation);
+	void UpdateView(Allocation& allocation);
+
+	Device& _device;
+	Queue& _queue;
+	TextureDescriptor _textureDescriptor;
+	TextureViewDescriptor _textureViewDescriptor;
+	uint32_t _wantedLevel = 0;
+
+	std::future<MipChain> _decode {};
+	MipChain _chain {};
+	bool _decoded = false;
+	bool _failed = false;
+
+	Allocation _current {};
+	std::unique_ptr<Allocation> _next {}; // Being uploaded, after a change of the wanted level
+	uint64_t _viewVersion = 0;
+};
+
+struct TextureStreamerStatistics {
+public:
+	size_t uploadedBytes = 0;  // During the last update
+	uint32_t uploadedLevels = 0;
+	uint32_t decodedTextures = 0;
+	uint32_t pendingTextures = 0; // Not decoded yet
+	uint32_t failedTextures = 0;  // During the last update
+	uint32_t incompleteTextures = 0;
+	size_t allocatedBytes = 0; // Of every streamed texture
+	double updateSeconds = 0.0;
+};
+
+// Decodes textures in the background and uploads their levels under a byte
+// budget per frame, the smallest levels of every texture first
+class TextureStreamer {
+public:
+	TextureStreamer(Device& device, Queue& queue, Utils::ThreadPool& threadPool);
+
+	// Returns at once, with the placeholder in View(). The image is decoded and
+	// its mip chain generated by a task of the pool; its size and level count
+	// are set from the image. The first level goes up at the next update.
+	// Throws if the format of textureDescriptor is not RGBA8.
+	std::shared_ptr<StreamingTexture> Load(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, StreamingTextureOptions const& options = {});
+
+	// Once per frame: takes the decoded images, then uploads levels until
+	// byteBudget bytes are written. Textures only referenced by the streamer
+	// are released. The images that fail to decode are logged and their
+	// textures keep the placeholder, without stopping the uploads of the others.
+	void Update(size_t byteBudget);
+
+	TextureStreamerStatistics const& GetStatistics() const {
+		return _statistics;
+	}
+
+private:
+	Device& _device;
+	Queue& _queue;
+	Utils::ThreadPool& _threadPool;
+
+	std::vector<std::shared_ptr<StreamingTexture>> _textures {};
+	TextureStreamerStatistics _statistics {};
+};
+
+#endif // STREAMINGTEXTURE_HPP
@@ -6,10 +6,17 @@
 #include <fstream>
 #include <filesystem>
 #include <vector>
+#include <optional>
+#include <algorithm>
+#include <thread>
 #include <stdexcept>
+#include <cstddef>
 
-#include <stb_image.h>
-
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/CookedTexture.hpp>
+#include <Utils/ThreadPool.hpp>
 #include <Helper/Device.hpp>
 #include <Helper/Queue.hpp>
 #include <Helper/TextureDescriptor.hpp>
@@ -25,6 +32,18 @@ class Texture2D {
 public:
 	Texture2D() = default;
 	Texture2D(std::filesystem::path const& path, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
+	// The size of textureDescriptor is set to the one of image. Its format
+	// must be RGBA8, or block-compressed: image is then compressed first, and
+	// its size must be a multiple of 4.
+	Texture2D(Image const& image, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
+	// Every level of a cooked texture. The format, size and level count of
+	// textureDescriptor, and the format and level count of the view, are set
+	// from the container, block-compressed containers being decompressed when
+	// the device cannot sample them.
+	Texture2D(TextureContainer const& container, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
 	Texture2D(Texture2D const& texture2D) = delete;
 	Texture2D(Texture2D&& other);
 	~Texture2D() = default;
@@ -46,9 +65,22 @@ public:
 		return _textureView;
 	}
 
+	// Bytes written to the levels of the texture, the other levels being left
+	// empty
+	size_t GetUploadedBytes() const {
+		return _uploadedBytes;
+	}
+
 private:
 	Texture _texture;
 	TextureView _textureView;
+	size_t _uploadedBytes = 0;
 };
 
+// Textures of paths, in the same order, all with the format and usage of
+// textureDescriptor. The images are decoded at the same time by the threads
+// of threadPool, and each one is uploaded as soon as it and the ones before
+// it are decoded. A texture that fails is logged and left empty.
+std::vector<Texture2D> LoadTextures(std::vector<std::filesystem::path> const& paths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool);
+
 #endif // TEXTURE2D_HPP
@@ -0,0 +1,95 @@
+#ifndef TEXTURECACHE_HPP
+#define TEXTURECACHE_HPP
+
+#include <iostream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <future>
+#include <unordered_map>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+#include <wgpu-native/webgpu.hpp>
+
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Resources/Texture/CookedTexture.hpp>
+#include <Resources/Texture/Texture2D.hpp>
+#include <Utils/LruCache.hpp>
+#include <Utils/ThreadPool.hpp>
+#include <Helper/Device.hpp>
+#include <Helper/Queue.hpp>
+#include <Helper/TextureDescriptor.hpp>
+#include <Helper/TextureViewDescriptor.hpp>
+
+// What makes two loads the same texture: the file, whatever the path used to
+// reach it, and the settings that change what is uploaded
+struct TextureCacheKey {
+public:
+	std::string path {}; // Canonical
+	uint32_t format = 0; // wgpu::TextureFormat
+	uint32_t mipLevelCount = 1;
+	uint32_t viewBaseMipLevel = 0;
+	uint32_t viewMipLevelCount = 0;
+
+	bool operator==(TextureCacheKey const& other) const = default;
+};
+
+struct TextureCacheKeyHash {
+public:
+	size_t operator()(TextureCacheKey const& key) const;
+};
+
+// Textures shared by everything that loads the same file with the same
+// settings, each one decoded and uploaded once. The textures nothing else
+// references are released from the least recently used once the cache is
+// over its byte budget. Must be used from a single thread, like the queue.
+class TextureCache {
+public:
+	TextureCache(Device& device, Queue& queue, size_t byteBudget);
+	TextureCache(TextureCache const&) = delete;
+	TextureCache& operator=(TextureCache const&) = delete;
+
+	// The texture of path, with the format, usage and level count of
+	// textureDescriptor, uploaded if it is not cached yet. Cooked .gstex
+	// containers keep their own format and levels. Throws like Texture2D.
+	std::shared_ptr<Texture2D> Load(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
+	// The textures of paths, in the same order. The images that are not cached
+	// are decoded at the same time by the threads of threadPool, and a file
+	// given several times is loaded once. A texture that fails is logged and
+	// left null, without stopping the uploads of the others.
+	std::vector<std::shared_ptr<Texture2D>> Load(std::vector<std::filesystem::path> const& paths, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool);
+
+	// Trims the cache at once when the budget is lower than the bytes used
+	void SetByteBudget(size_t byteBudget);
+	size_t GetByteBudget() const;
+
+	// Bytes of the textures in the cache, as uploaded by Texture2D
+	size_t GetUsedBytes() const;
+	size_t GetCount() const;
+	Utils::LruCacheStatistics const& GetStatistics() const;
+
+	// Releases the textures nothing else references, whatever the budget
+	void ReleaseUnused();
+
+private:
+	static TextureCacheKey MakeKey(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
+	// The texture of a file not cached yet, image being its decoded pixels
+	// unless it is a container
+	std::shared_ptr<Texture2D> Upload(TextureCacheKey const& key, std::filesystem::path const& path, Image const* image, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor);
+
+	Device& _device;
+	Queue& _queue;
+	Utils::LruCache<TextureCacheKey, Texture2D, TextureCacheKeyHash> _cache;
+};
+
+#endif // TEXTURECACHE_HPP
@@ -0,0 +1,116 @@
+#ifndef TEXTURECONTAINER_HPP
+#define TEXTURECONTAINER_HPP
+
+#include <filesystem>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Utils/MappedFile.hpp>
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+
+// Texture cooked offline: every level of every layer, ready to be uploaded
+// as it is. The layout follows KTX2: a header, then the offset of each level,
+// then the levels from the smallest one, the layers of a level following
+// each other. Every value is little-endian.
+enum class TextureContainerFormat : uint32_t {
+	RGBA8Unorm = 1,
+	RGBA8UnormSrgb = 2,
+	BC1RGBAUnorm = 3,
+	BC1RGBAUnormSrgb = 4,
+	BC3RGBAUnorm = 5,
+	BC3RGBAUnormSrgb = 6,
+	BC7RGBAUnorm = 7,
+	BC7RGBAUnormSrgb = 8,
+};
+
+struct TextureContainerHeader {
+public:
+	static constexpr std::array<char, 8> magic { 'G', 'S', 'T', 'E', 'X', '\r', '\n', '\x1a' };
+	static constexpr uint32_t currentVersion = 1;
+	static constexpr uint32_t cubemapFlag = 1;
+
+	std::array<char, 8> identifier = magic;
+	uint32_t version = currentVersion;
+	TextureContainerFormat format = TextureContainerFormat::RGBA8Unorm;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t layerCount = 0;
+	uint32_t levelCount = 0;
+	uint32_t flags = 0;
+	uint32_t reserved = 0;
+};
+
+struct TextureContainerLevel {
+public:
+	uint64_t offset = 0;    // In bytes, from the start of the file
+	uint64_t layerSize = 0; // In bytes, of each layer
+};
+
+static_assert(sizeof(TextureContainerHeader) == 40, "The header of texture containers must not have padding.");
+static_assert(sizeof(TextureContainerLevel) == 16, "The levels of texture containers must not have padding.");
+
+// Bytes of a row of a level, and rows of a level, as given to writeTexture.
+// The rows of the block-compressed formats are rows of 4x4 blocks.
+uint32_t TextureContainerRowSize(TextureContainerFormat format, uint32_t width);
+uint32_t TextureContainerRowCount(TextureContainerFormat format, uint32_t height);
+
+// Whether the levels are made of 4x4 blocks, in which case the size of the
+// first level is a multiple of 4, and which blocks. GetBlockFormat throws for
+// the other formats.
+bool IsBlockCompressed(TextureContainerFormat format);
+BlockFormat GetBlockFormat(TextureContainerFormat format);
+
+// Color space and blocks of the formats, and the opposite
+ColorSpace GetColorSpace(TextureContainerFormat format);
+TextureContainerFormat GetContainerFormat(ColorSpace colorSpace);
+TextureContainerFormat GetContainerFormat(BlockFormat blockFormat, ColorSpace colorSpace);
+
+// MARK: Reading
+// Container mapped in memory: the data of the levels is read from the file
+// only when it is used, without any copy
+class TextureContainer {
+public:
+	TextureContainer() = default;
+
+	// Throws if the file cannot be mapped or is not a valid container
+	explicit TextureContainer(std::filesystem::path const& path);
+
+	TextureContainerFormat GetFormat() const;
+	uint32_t GetWidth(uint32_t level = 0) const;
+	uint32_t GetHeight(uint32_t level = 0) const;
+	uint32_t GetLayerCount() const;
+	uint32_t GetLevelCount() const;
+	bool IsCubemap() const;
+
+	uint8_t const* GetData(uint32_t layer, uint32_t level) const;
+	size_t GetSize(uint32_t level) const; // In bytes, of one layer
+
+private:
+	Utils::MappedFile _file {};
+	TextureContainerHeader _header {};
+	std::vector<TextureContainerLevel> _levels {};
+};
+
+// MARK: Writing
+// Levels are given one by one, then written together. The data is not copied
+// and must stay valid until Write.
+class TextureContainerWriter {
+public:
+	// Throws if the size, layer count or level count are not possible
+	TextureContainerWriter(TextureContainerFormat format, uint32_t width, uint32_t height, uint32_t layerCount, uint32_t levelCount, bool cubemap = false);
+
+	// Throws if size is not the size of the level
+	void SetLevel(uint32_t layer, uint32_t level, uint8_t const* data, size_t size);
+
+	// Throws if a level is missing or the file cannot be written
+	void Write(std::filesystem::path const& path) const;
+
+private:
+	TextureContainerHeader _header {};
+	std::vector<uint8_t const*> _data {}; // Level by level, then layer by layer
+};
+
+#endif // TEXTURECONTAINER_HPP
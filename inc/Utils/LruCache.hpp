@@ -0,0 +1,141 @@
+#ifndef LRUCACHE_HPP
+#define LRUCACHE_HPP
+
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils {
+	struct LruCacheStatistics {
+	public:
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+	};
+
+	// Shared values of a known size in bytes, the least recently used first
+	// to go once the total is over the budget. A value still referenced
+	// outside of the cache is never evicted, as it would not free anything,
+	// so the total may stay over the budget until its handles are released.
+	template <typename Key, typename Value, typename Hash = std::hash<Key>>
+	class LruCache {
+	public:
+		explicit LruCache(size_t byteBudget) : _byteBudget(byteBudget) {}
+		LruCache(LruCache const&) = delete;
+		LruCache& operator=(LruCache const&) = delete;
+
+		// The value of key, which becomes the most recently used, or nullptr
+		std::shared_ptr<Value> Find(Key const& key) {
+			auto found = _index.find(key);
+			if (found == _index.end()) {
+				++_statistics.misses;
+				return nullptr;
+			}
+
+			++_statistics.hits;
+			_entries.splice(_entries.begin(), _entries, found->second);
+			return found->second->value;
+		}
+
+		// Replaces the value of key if there is one, then trims the cache. The
+		// returned handle keeps value from being evicted.
+		std::shared_ptr<Value> Insert(Key const& key, std::shared_ptr<Value> value, size_t bytes) {
+			Erase(key);
+
+			_entries.push_front({ key, std::move(value), bytes });
+			_index.emplace(key, _entries.begin());
+			_usedBytes += bytes;
+
+			std::shared_ptr<Value> handle = _entries.front().value;
+			Trim();
+			return handle;
+		}
+
+		bool Erase(Key const& key) {
+			auto found = _index.find(key);
+			if (found == _index.end()) {
+				return false;
+			}
+
+			_usedBytes -= found->second->bytes;
+			_entries.erase(found->second);
+			_index.erase(found);
+			return true;
+		}
+
+		// Evicts the unreferenced values from the least recently used while
+		// the total is over byteBudget, and returns how many were
+		size_t Trim(size_t byteBudget) {
+			size_t evicted = 0;
+			auto entry = _entries.end();
+			while (_usedBytes > byteBudget && entry != _entries.begin()) {
+				--entry;
+				if (entry->value.use_count() > 1) {
+					continue;
+				}
+
+				_usedBytes -= entry->bytes;
+				_index.erase(entry->key);
+				entry = _entries.erase(entry);
+				++evicted;
+			}
+
+			_statistics.evictions += evicted;
+			return evicted;
+		}
+
+		size_t Trim() {
+			return Trim(_byteBudget);
+		}
+
+		// Releases the handles of the cache, the values referenced elsewhere
+		// staying alive until they are released too
+		void Clear() {
+			_entries.clear();
+			_index.clear();
+			_usedBytes = 0;
+		}
+
+		void SetByteBudget(size_t byteBudget) {
+			_byteBudget = byteBudget;
+			Trim();
+		}
+
+		size_t GetByteBudget() const {
+			return _byteBudget;
+		}
+
+		// Of every value in the cache, referenced elsewhere or not
+		size_t GetUsedBytes() const {
+			return _usedBytes;
+		}
+
+		size_t GetCount() const {
+			return _entries.size();
+		}
+
+		LruCacheStatistics const& GetStatistics() const {
+			return _statistics;
+		}
+
+	private:
+		struct Entry {
+		public:
+			Key key;
+			std::shared_ptr<Value> value;
+			size_t bytes = 0;
+		};
+
+		std::list<Entry> _entries {}; // The most recently used first
+		std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> _index {};
+		size_t _byteBudget = 0;
+		size_t _usedBytes = 0;
+		LruCacheStatistics _statistics {};
+	};
+}
+
+#endif // LRUCACHE_HPP
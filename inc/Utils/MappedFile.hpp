@@ -0,0 +1,40 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <filesystem>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils {
+	// Read-only mapping of a whole file, the pages being read by the system
+	// when they are first accessed
+	class MappedFile {
+	public:
+		MappedFile() = default;
+
+		// Throws if the file cannot be opened or mapped
+		explicit MappedFile(std::filesystem::path const& path);
+		MappedFile(MappedFile const&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		~MappedFile();
+
+		MappedFile& operator=(MappedFile const&) = delete;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		uint8_t const* Data() const {
+			return _data;
+		}
+
+		size_t Size() const {
+			return _size;
+		}
+
+	private:
+		void Unmap();
+
+		uint8_t const* _data = nullptr;
+		size_t _size = 0;
+	};
+}
+
+#endif // MAPPEDFILE_HPP
@@ -0,0 +1,60 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <type_traits>
+#include <cstddef>
+
+namespace Utils {
+	// Threads started once, running the submitted tasks in the order they came
+	class ThreadPool {
+	public:
+		// At least one thread, whatever threadCount is
+		explicit ThreadPool(unsigned threadCount = std::thread::hardware_concurrency());
+		ThreadPool(ThreadPool const&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+
+		// Runs the tasks still queued, then joins the threads
+		~ThreadPool();
+
+		ThreadPool& operator=(ThreadPool const&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		// The future gives the result of function, or rethrows what it threw
+		template <typename Function>
+		std::future<std::invoke_result_t<std::decay_t<Function>>> Submit(Function&& function) {
+			using Result = std::invoke_result_t<std::decay_t<Function>>;
+
+			// std::function must be copyable, which a packaged_task is not
+			auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+			std::future<Result> future = task->get_future();
+			Push([task]() { (*task)(); });
+
+			return future;
+		}
+
+		unsigned GetThreadCount() const;
+
+		// Tasks submitted and not started yet
+		size_t GetQueuedCount() const;
+
+	private:
+		void Push(std::function<void()> task);
+		void Run();
+
+		std::vector<std::thread> _threads {};
+		std::deque<std::function<void()>> _tasks {};
+		mutable std::mutex _mutex {};
+		std::condition_variable _condition {};
+		bool _stopping = false;
+	};
+}
+
+#endif // THREADPOOL_HPP
@@ -28,5 +28,6 @@ struct VertexOutput {
 
 @fragment fn fs(out: VertexOutput) -> @location(0) vec4f {
     let t = uniforms.viewDirectionProjectionInverse * out.pos;
-    return vec4f(pow((textureSample(skyboxTexture, skyboxSampler, normalize(t.xyz / t.w) * vec3f(1, 1, 1))).rgb, vec3f(2.2)), 1.0);
+    // The cubemap is sRGB, so the sample is already linear
+    return vec4f(textureSample(skyboxTexture, skyboxSampler, normalize(t.xyz / t.w) * vec3f(1, 1, 1)).rgb, 1.0);
 }
\ No newline at end of file
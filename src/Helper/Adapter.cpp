@@ -47,6 +47,11 @@ wgpu::Adapter* Adapter::operator->() {
 	return &_handle;
 }
 
+bool Adapter::HasFeature(wgpu::FeatureName feature) const {
+	wgpu::FeatureName const* end = _features.features + _features.featureCount;
+	return std::find(_features.features, end, feature) != end;
+}
+
 void Adapter::DisplayFeatures() const {
 	std::cout << "\t - " << "Features (found " << _features.featureCount << "):" << std::endl;
 	for (size_t i = 0; i < _features.featureCount; ++i) {
@@ -122,6 +127,8 @@ void Adapter::DisplayFeatures() const {
 		}
 	}
 
+	// Required by DeviceDescriptor when available
+	std::cout << "\t - " << "Texture compression: " << (HasFeature(wgpu::FeatureName::TextureCompressionBC) ? "BC1, BC3 and BC7" : "none, textures are uploaded as RGBA8") << std::endl;
 	std::cout << std::endl;
 }
 
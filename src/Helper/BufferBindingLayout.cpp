@@ -1,10 +1,10 @@
 #include <Helper/BufferBindingLayout.hpp>
 
-BufferBindingLayout::BufferBindingLayout(uint32_t bufferBinding, wgpu::ShaderStage bufferVisibility, wgpu::BufferBindingType bufferType, uint32_t bufferMinBindingSize) {
+BufferBindingLayout::BufferBindingLayout(uint32_t bufferBinding, wgpu::ShaderStage bufferVisibility, wgpu::BufferBindingType bufferType, uint32_t bufferMinBindingSize, bool bufferHasDynamicOffset) {
 	binding = bufferBinding;
 	visibility = bufferVisibility;
 
-	buffer.hasDynamicOffset = false;
+	buffer.hasDynamicOffset = bufferHasDynamicOffset;
 	buffer.minBindingSize = bufferMinBindingSize;
 	buffer.type = bufferType;
 	buffer.nextInChain = nullptr;
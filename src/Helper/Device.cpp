@@ -59,6 +59,10 @@ void Device::DisplayLimits() const {
 	std::cout << std::endl;
 }
 
+bool Device::HasFeature(wgpu::FeatureName feature) const {
+	return _handle.hasFeature(feature);
+}
+
 wgpu::Device* Device::operator -> () {
 	return &_handle;
 }
@@ -2,34 +2,37 @@
 
 DeviceDescriptor::DeviceDescriptor(Adapter const& adapter) : DeviceDescriptor(adapter, Limits(adapter), {}, {}) {}
 
-DeviceDescriptor::DeviceDescriptor(Adapter const& adapter, Limits const& limits, DeviceLostCallbackInfo const& deviceLostCallbackInfo, UncapturedErrorCallbackInfo const& uncapturedErrorCallbackInfo) {
-	(void) adapter;
-
+DeviceDescriptor::DeviceDescriptor(Adapter const& adapter, Limits const& limits, DeviceLostCallbackInfo const& deviceLostCallbackInfo, UncapturedErrorCallbackInfo const& uncapturedErrorCallbackInfo) : wgpu::DeviceDescriptor(wgpu::Default) {
 	int did = id++;
+	_label = "device_" + std::to_string(did);
+	_queueLabel = "default_queue_" + std::to_string(did);
+	_limits = limits;
+
+	if (adapter.HasFeature(wgpu::FeatureName::TextureCompressionBC)) {
+		_requiredFeatures.push_back(wgpu::FeatureName::TextureCompressionBC);
+	}
+
 	wgpu::QueueDescriptor defaultQueueDescriptor {};
-	defaultQueueDescriptor.label = wgpu::StringView("default_queue_" + std::to_string(did));
+	defaultQueueDescriptor.label = wgpu::StringView(_queueLabel);
 	defaultQueueDescriptor.nextInChain = nullptr;
 
-	std::vector<wgpu::FeatureName> requiredDeviceFeatures {};
-
-	wgpu::DeviceDescriptor deviceDescriptor = wgpu::Default;
-	deviceDescriptor.defaultQueue = defaultQueueDescriptor;
+	defaultQueue = defaultQueueDescriptor;
 
-	deviceDescriptor.deviceLostCallbackInfo.callback = deviceLostCallbackInfo.callback;
-	deviceDescriptor.deviceLostCallbackInfo.nextInChain = deviceLostCallbackInfo.nextInChain;
-	deviceDescriptor.deviceLostCallbackInfo.userdata1 = deviceLostCallbackInfo.userdata1;
-	deviceDescriptor.deviceLostCallbackInfo.userdata2 = deviceLostCallbackInfo.userdata2;
+	this->deviceLostCallbackInfo.callback = deviceLostCallbackInfo.callback;
+	this->deviceLostCallbackInfo.nextInChain = deviceLostCallbackInfo.nextInChain;
+	this->deviceLostCallbackInfo.userdata1 = deviceLostCallbackInfo.userdata1;
+	this->deviceLostCallbackInfo.userdata2 = deviceLostCallbackInfo.userdata2;
 
-	deviceDescriptor.label = wgpu::StringView("device_" + std::to_string(did));
-	deviceDescriptor.nextInChain = nullptr;
-	deviceDescriptor.requiredFeatureCount = requiredDeviceFeatures.size();
-	deviceDescriptor.requiredFeatures = (WGPUFeatureName*) (requiredDeviceFeatures.data());
-	deviceDescriptor.requiredLimits = &limits;
+	label = wgpu::StringView(_label);
+	nextInChain = nullptr;
+	requiredFeatureCount = _requiredFeatures.size();
+	requiredFeatures = (WGPUFeatureName*) (_requiredFeatures.data());
+	requiredLimits = &_limits;
 
-	deviceDescriptor.uncapturedErrorCallbackInfo.callback = uncapturedErrorCallbackInfo.callback;
-	deviceDescriptor.uncapturedErrorCallbackInfo.nextInChain = uncapturedErrorCallbackInfo.nextInChain;
-	deviceDescriptor.uncapturedErrorCallbackInfo.userdata1 = uncapturedErrorCallbackInfo.userdata1;
-	deviceDescriptor.uncapturedErrorCallbackInfo.userdata2 = uncapturedErrorCallbackInfo.userdata2;
+	this->uncapturedErrorCallbackInfo.callback = uncapturedErrorCallbackInfo.callback;
+	this->uncapturedErrorCallbackInfo.nextInChain = uncapturedErrorCallbackInfo.nextInChain;
+	this->uncapturedErrorCallbackInfo.userdata1 = uncapturedErrorCallbackInfo.userdata1;
+	this->uncapturedErrorCallbackInfo.userdata2 = uncapturedErrorCallbackInfo.userdata2;
 }
 
 int DeviceDescriptor::id = 0;
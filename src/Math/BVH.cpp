@@ -0,0 +1,464 @@
+#include <Math/BVH.hpp>
+
+#include <bit>
+#include <array>
+#include <thread>
+#include <algorithm>
+
+namespace Math {
+	namespace {
+		constexpr size_t binCount = 16;
+		constexpr size_t minLeafSize = 2;  // Never split below
+		constexpr size_t maxLeafSize = 16; // Always split above
+		constexpr float traversalCost = 1.0f; // Relative to a triangle test
+
+		// Past medianDepth the nodes are split at the median, which bounds the
+		// depth to maxDepth for up to 2^32 triangles, and the traversal stacks
+		constexpr size_t maxDepth = 64;
+		constexpr size_t medianDepth = maxDepth - 32;
+
+		// Only subtrees with enough triangles are worth a thread
+		constexpr size_t minParallelCount = 4096;
+
+		constexpr float largest = std::numeric_limits<float>::max();
+		constexpr AABB emptyBounds { Vector3(largest), Vector3(-largest) };
+
+		// Component-wise so that the build loops stay branchless
+		inline void Grow(AABB& bounds, Vector3 const& point) {
+			bounds.min = Vector3(std::min(bounds.min.x, point.x), std::min(bounds.min.y, point.y), std::min(bounds.min.z, point.z));
+			bounds.max = Vector3(std::max(bounds.max.x, point.x), std::max(bounds.max.y, point.y), std::max(bounds.max.z, point.z));
+		}
+
+		inline void Grow(AABB& bounds, AABB const& box) {
+			bounds.min = Vector3(std::min(bounds.min.x, box.min.x), std::min(bounds.min.y, box.min.y), std::min(bounds.min.z, box.min.z));
+			bounds.max = Vector3(std::max(bounds.max.x, box.max.x), std::max(bounds.max.y, box.max.y), std::max(bounds.max.z, box.max.z));
+		}
+
+		// Half of the surface area, enough to compare costs
+		inline float HalfArea(AABB const& bounds) {
+			Vector3 size = bounds.max - bounds.min;
+			return size.x * size.y + size.y * size.z + size.z * size.x;
+		}
+
+		struct Bin {
+			AABB bounds = emptyBounds;
+			size_t count = 0;
+		};
+
+		// Partitioned in place while building, so that every pass over the
+		// triangles of a node reads contiguous memory
+		struct Primitive {
+			AABB bounds;
+			Vector3 centroid;
+			uint32_t triangle;
+		};
+
+		class Builder {
+		public:
+			Builder(std::span<Primitive> primitives) :
+				_primitives(primitives) {}
+
+			// Appends the subtree of the primitives [begin, end) to nodes
+			void Build(std::vector<BVH::Node>& nodes, size_t begin, size_t end, size_t depth, unsigned parallelDepth) const {
+				size_t index = nodes.size();
+				nodes.emplace_back();
+
+				AABB bounds = emptyBounds;
+				AABB centroidBounds = emptyBounds;
+				for (size_t i = begin; i < end; ++i) {
+					Grow(bounds, _primitives[i].bounds);
+					Grow(centroidBounds, _primitives[i].centroid);
+				}
+
+				nodes[index].bounds = bounds;
+
+				size_t count = end - begin;
+				size_t axis = 0;
+				size_t middle = begin;
+				if (count <= minLeafSize || !Split(bounds, centroidBounds, begin, end, depth, axis, middle)) {
+					nodes[index].offset = static_cast<uint32_t>(begin);
+					nodes[index].count = static_cast<uint16_t>(count);
+					return;
+				}
+
+				nodes[index].axis = static_cast<uint16_t>(axis);
+
+				if (parallelDepth > 0 && count >= minParallelCount) {
+					std::vector<BVH::Node> second {};
+					std::thread worker([&]() {
+						Build(second, middle, end, depth + 1, parallelDepth - 1);
+					});
+					Build(nodes, begin, middle, depth + 1, parallelDepth - 1);
+					worker.join();
+
+					// Offsets of the inner nodes of the second subtree are relative to it
+					uint32_t base = static_cast<uint32_t>(nodes.size());
+					nodes[index].offset = base;
+					for (BVH::Node node : second) {
+						if (!node.IsLeaf()) {
+							node.offset += base;
+						}
+
+						nodes.push_back(node);
+					}
+				}
+				else {
+					Build(nodes, begin, middle, depth + 1, 0);
+					nodes[index].offset = static_cast<uint32_t>(nodes.size());
+					Build(nodes, middle, end, depth + 1, 0);
+				}
+			}
+
+		private:
+			// Binned SAH: the centroids are sorted into bins along each axis and
+			// the triangles are split at the bin boundary of least cost. Returns
+			// false when a leaf is cheaper.
+			bool Split(AABB const& bounds, AABB const& centroidBounds, size_t begin, size_t end, size_t depth, size_t& axis, size_t& middle) const {
+				size_t count = end - begin;
+				Vector3 extent = centroidBounds.max - centroidBounds.min;
+				axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+				if (extent[axis] <= 0.0f || depth >= medianDepth) {
+					return SplitAtMedian(begin, end, axis, middle);
+				}
+
+				float bestCost = largest;
+				size_t bestBin = 0;
+				for (size_t candidate = 0; candidate < 3; ++candidate) {
+					if (extent[candidate] <= 0.0f) {
+						continue;
+					}
+
+					std::array<Bin, binCount> bins {};
+					float scale = BinScale(centroidBounds, candidate);
+					for (size_t i = begin; i < end; ++i) {
+						Bin& bin = bins[BinOf(_primitives[i].centroid[candidate], centroidBounds.min[candidate], scale)];
+						Grow(bin.bounds, _primitives[i].bounds);
+						++bin.count;
+					}
+
+					// Areas and counts on the right of each boundary, then the
+					// left side is accumulated while looking for the best one
+					std::array<float, binCount> rightAreas {};
+					std::array<size_t, binCount> rightCounts {};
+					Bin right {};
+					for (size_t b = binCount - 1; b > 0; --b) {
+						Grow(right.bounds, bins[b].bounds);
+						right.count += bins[b].count;
+						rightAreas[b] = HalfArea(right.bounds);
+						rightCounts[b] = right.count;
+					}
+
+					Bin left {};
+					for (size_t b = 1; b < binCount; ++b) {
+						Grow(left.bounds, bins[b - 1].bounds);
+						left.count += bins[b - 1].count;
+						if (left.count == 0 || rightCounts[b] == 0) {
+							continue;
+						}
+
+						float cost = HalfArea(left.bounds) * static_cast<float>(left.count) + rightAreas[b] * static_cast<float>(rightCounts[b]);
+						if (cost < bestCost) {
+							bestCost = cost;
+							bestBin = b;
+							axis = candidate;
+						}
+					}
+				}
+
+				if (bestCost == largest) {
+					return SplitAtMedian(begin, end, axis, middle);
+				}
+
+				float leafCost = HalfArea(bounds) * static_cast<float>(count);
+				float splitCost = traversalCost * HalfArea(bounds) + bestCost;
+				if (splitCost >= leafCost && count <= maxLeafSize) {
+					return false;
+				}
+
+				float scale = BinScale(centroidBounds, axis);
+				auto first = _primitives.begin() + static_cast<std::ptrdiff_t>(begin);
+				auto last = _primitives.begin() + static_cast<std::ptrdiff_t>(end);
+				middle = static_cast<size_t>(std::partition(first, last, [&](Primitive const& primitive) {
+					return BinOf(primitive.centroid[axis], centroidBounds.min[axis], scale) < bestBin;
+				}) - _primitives.begin());
+
+				return true;
+			}
+
+			bool SplitAtMedian(size_t begin, size_t end, size_t axis, size_t& middle) const {
+				middle = begin + (end - begin) / 2;
+
+				auto first = _primitives.begin() + static_cast<std::ptrdiff_t>(begin);
+				auto last = _primitives.begin() + static_cast<std::ptrdiff_t>(end);
+				std::nth_element(first, _primitives.begin() + static_cast<std::ptrdiff_t>(middle), last, [&](Primitive const& lhs, Primitive const& rhs) {
+					float a = lhs.centroid[axis];
+					float b = rhs.centroid[axis];
+					return a < b || (a == b && lhs.triangle < rhs.triangle);
+				});
+
+				return true;
+			}
+
+			static float BinScale(AABB const& centroidBounds, size_t axis) {
+				return static_cast<float>(binCount) / (centroidBounds.max[axis] - centroidBounds.min[axis]);
+			}
+
+			static size_t BinOf(float centroid, float min, float scale) {
+				size_t bin = static_cast<size_t>((centroid - min) * scale);
+				return std::min(bin, binCount - 1);
+			}
+
+		private:
+			std::span<Primitive> _primitives;
+		};
+
+		// Slab test against the part of the ray in [0, maxDistance]. Zero
+		// components of the direction give infinite inverses, and the NaN of a
+		// ray starting on a slab are ignored by std::min and std::max.
+		inline bool Intersects(AABB const& bounds, Vector3 const& origin, Vector3 const& inversedDirection, float maxDistance) {
+			float near = 0.0f;
+			float far = maxDistance;
+			for (size_t i = 0; i < 3; ++i) {
+				float t0 = (bounds.min[i] - origin[i]) * inversedDirection[i];
+				float t1 = (bounds.max[i] - origin[i]) * inversedDirection[i];
+				if (inversedDirection[i] < 0.0f) {
+					std::swap(t0, t1);
+				}
+
+				near = std::max(near, t0);
+				far = std::min(far, t1);
+			}
+
+			return near <= far;
+		}
+
+		inline AABB TriangleBounds(Vector3 const* triangle) {
+			AABB bounds { triangle[0], triangle[0] };
+			Grow(bounds, triangle[1]);
+			Grow(bounds, triangle[2]);
+			return bounds;
+		}
+
+		template <typename Vertex>
+		void BuildFrom(size_t triangleCount, unsigned threadCount, Vertex&& vertex, std::vector<BVH::Node>& nodes, std::vector<Vector3>& vertices, std::vector<uint32_t>& triangles) {
+			assert("Triangles must be indexable with 32 bits" && triangleCount <= std::numeric_limits<uint32_t>::max());
+
+			std::vector<Primitive> primitives(triangleCount);
+			for (size_t t = 0; t < triangleCount; ++t) {
+				Vector3 const triangle[3] = { vertex(t, 0), vertex(t, 1), vertex(t, 2) };
+				primitives[t].bounds = TriangleBounds(triangle);
+				primitives[t].centroid = primitives[t].bounds.Center();
+				primitives[t].triangle = static_cast<uint32_t>(t);
+			}
+
+			nodes.clear();
+			if (triangleCount > 0) {
+				// A subtree per thread, both children of a node built at the same time
+				unsigned parallelDepth = static_cast<unsigned>(std::bit_width(std::max(threadCount, 1u) - 1));
+				nodes.reserve(2 * triangleCount);
+				Builder(primitives).Build(nodes, 0, triangleCount, 0, parallelDepth);
+				nodes.shrink_to_fit();
+			}
+
+			triangles.resize(triangleCount);
+			vertices.resize(3 * triangleCount);
+			for (size_t i = 0; i < triangleCount; ++i) {
+				triangles[i] = primitives[i].triangle;
+				for (size_t k = 0; k < 3; ++k) {
+					vertices[3 * i + k] = vertex(triangles[i], k);
+				}
+			}
+		}
+	}
+
+	bool IntersectTriangle(Ray const& ray, Vector3 const* triangle, float maxDistance, float& distance, float& u, float& v) {
+		Vector3 edge1 = triangle[1] - triangle[0];
+		Vector3 edge2 = triangle[2] - triangle[0];
+		Vector3 p = Vector3::Cross(ray.direction, edge2);
+		float determinant = Vector3::Dot(edge1, p);
+		if (determinant == 0.0f) {
+			return false;
+		}
+
+		float inversedDeterminant = 1.0f / determinant;
+		Vector3 s = ray.origin - triangle[0];
+		u = Vector3::Dot(s, p) * inversedDeterminant;
+		if (u < 0.0f || u > 1.0f) {
+			return false;
+		}
+
+		Vector3 q = Vector3::Cross(s, edge1);
+		v = Vector3::Dot(ray.direction, q) * inversedDeterminant;
+		if (v < 0.0f || u + v > 1.0f) {
+			return false;
+		}
+
+		distance = Vector3::Dot(edge2, q) * inversedDeterminant;
+		return distance >= 0.0f && distance < maxDistance;
+	}
+
+	BVH BVH::Build(std::span<Vector3 const> positions, unsigned threadCount) {
+		assert("Triangles need 3 positions each" && positions.size() % 3 == 0);
+
+		BVH result {};
+		BuildFrom(positions.size() / 3, threadCount, [&](size_t triangle, size_t k) {
+			return positions[3 * triangle + k];
+		}, result._nodes, result._vertices, result._triangles);
+
+		return result;
+	}
+
+	BVH BVH::Build(std::span<Vector3 const> positions, std::span<uint32_t const> indices, unsigned threadCount) {
+		assert("Triangles need 3 indices each" && indices.size() % 3 == 0);
+
+		BVH result {};
+		BuildFrom(indices.size() / 3, threadCount, [&](size_t triangle, size_t k) {
+			assert("Index must be in the bounds of the positions" && indices[3 * triangle + k] < positions.size());
+			return positions[indices[3 * triangle + k]];
+		}, result._nodes, result._vertices, result._triangles);
+
+		return result;
+	}
+
+	bool BVH::Raycast(Ray const& ray, RayHit& hit, float maxDistance) const {
+		if (_nodes.empty()) {
+			return false;
+		}
+
+		Vector3 inversedDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+		float closest = maxDistance;
+		bool found = false;
+
+		std::array<uint32_t, maxDepth + 1> stack {};
+		size_t top = 0;
+		uint32_t index = 0;
+		while (true) {
+			Node const& node = _nodes[index];
+			if (Intersects(node.bounds, ray.origin, inversedDirection, closest)) {
+				if (!node.IsLeaf()) {
+					// Nearest child first, so that its hits shorten the ray for the other
+					uint32_t first = index + 1;
+					uint32_t second = node.offset;
+					if (ray.direction[node.axis] < 0.0f) {
+						std::swap(first, second);
+					}
+
+					stack[top++] = second;
+					index = first;
+					continue;
+				}
+
+				for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+					float distance = 0.0f;
+					float u = 0.0f;
+					float v = 0.0f;
+					if (IntersectTriangle(ray, &_vertices[3 * i], closest, distance, u, v)) {
+						closest = distance;
+						hit = RayHit { _triangles[i], distance, u, v };
+						found = true;
+					}
+				}
+			}
+
+			if (top == 0) {
+				break;
+			}
+
+			index = stack[--top];
+		}
+
+		return found;
+	}
+
+	void BVH::Query(AABB const& box, std::vector<uint32_t>& triangles) const {
+		if (_nodes.empty()) {
+			return;
+		}
+
+		std::array<uint32_t, maxDepth + 1> stack {};
+		size_t top = 0;
+		stack[top++] = 0;
+		while (top > 0) {
+			Node const& node = _nodes[stack[--top]];
+			if (!node.bounds.Intersects(box)) {
+				continue;
+			}
+
+			if (!node.IsLeaf()) {
+				stack[top++] = node.offset;
+				stack[top++] = static_cast<uint32_t>(&node - _nodes.data()) + 1;
+				continue;
+			}
+
+			for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+				if (TriangleBounds(&_vertices[3 * i]).Intersects(box)) {
+					triangles.push_back(_triangles[i]);
+				}
+			}
+		}
+	}
+
+	void BVH::Query(Frustum const& frustum, std::vector<uint32_t>& triangles) const {
+		if (_nodes.empty()) {
+			return;
+		}
+
+		// Nodes entirely inside the frustum are pushed with their triangles
+		// accepted, the tests are only done along its planes
+		struct Entry {
+			uint32_t index;
+			bool inside;
+		};
+
+		std::array<Entry, maxDepth + 1> stack {};
+		size_t top = 0;
+		stack[top++] = Entry { 0, false };
+		while (top > 0) {
+			Entry entry = stack[--top];
+			Node const& node = _nodes[entry.index];
+
+			bool inside = entry.inside;
+			if (!inside) {
+				if (!frustum.Intersects(node.bounds)) {
+					continue;
+				}
+
+				inside = frustum.Contains(node.bounds);
+			}
+
+			if (!node.IsLeaf()) {
+				stack[top++] = Entry { node.offset, inside };
+				stack[top++] = Entry { entry.index + 1, inside };
+				continue;
+			}
+
+			if (inside) {
+				AppendTriangles(node, triangles);
+				continue;
+			}
+
+			for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+				if (frustum.Intersects(TriangleBounds(&_vertices[3 * i]))) {
+					triangles.push_back(_triangles[i]);
+				}
+			}
+		}
+	}
+
+	std::span<BVH::Node const> BVH::GetNodes() const {
+		return _nodes;
+	}
+
+	AABB BVH::GetBounds() const {
+		return _nodes.empty() ? AABB {} : _nodes[0].bounds;
+	}
+
+	size_t BVH::GetTriangleCount() const {
+		return _triangles.size();
+	}
+
+	void BVH::AppendTriangles(Node const& leaf, std::vector<uint32_t>& triangles) const {
+		triangles.insert(triangles.end(), _triangles.begin() + leaf.offset, _triangles.begin() + leaf.offset + leaf.count);
+	}
+}
@@ -0,0 +1,200 @@
+#include <Math/Batch.hpp>
+
+#include <algorithm>
+
+#include <Math/Simd.hpp>
+#include <Math/Parallel.hpp>
+
+namespace Math {
+	static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be tightly packed to be processed as a float array");
+	static_assert(sizeof(Vector4) == 4 * sizeof(float), "Vector4 must be tightly packed to be processed as a float array");
+
+	namespace {
+		using namespace Simd;
+
+		// Coefficients of the 3 first lines of a matrix, splat in every lane
+		struct SplatMatrix {
+			SplatMatrix(Matrix4x4 const& m) {
+				for (int i = 0; i < 12; ++i) {
+					coefficients[i] = Splat<Float4>(m[i]);
+				}
+			}
+
+			Float4 coefficients[12];
+		};
+
+		// Transforms 4 vectors given as x, y and z registers in place
+		template <bool isPoint>
+		inline void Transform4(SplatMatrix const& m, Float4& x, Float4& y, Float4& z) {
+			Float4 const* c = m.coefficients;
+			Float4 resultX = Add(Add(Mul(c[0], x), Mul(c[1], y)), Mul(c[2], z));
+			Float4 resultY = Add(Add(Mul(c[4], x), Mul(c[5], y)), Mul(c[6], z));
+			Float4 resultZ = Add(Add(Mul(c[8], x), Mul(c[9], y)), Mul(c[10], z));
+
+			if constexpr (isPoint) {
+				resultX = Add(resultX, c[3]);
+				resultY = Add(resultY, c[7]);
+				resultZ = Add(resultZ, c[11]);
+			}
+
+			x = resultX;
+			y = resultY;
+			z = resultZ;
+		}
+
+		template <bool isPoint>
+		inline void Transform1(Matrix4x4 const& m, float& x, float& y, float& z) {
+			float resultX = m[0] * x + m[1] * y + m[2] * z;
+			float resultY = m[4] * x + m[5] * y + m[6] * z;
+			float resultZ = m[8] * x + m[9] * y + m[10] * z;
+
+			if constexpr (isPoint) {
+				resultX += m[3];
+				resultY += m[7];
+				resultZ += m[11];
+			}
+
+			x = resultX;
+			y = resultY;
+			z = resultZ;
+		}
+
+		template <bool isPoint>
+		void TransformAoS(Matrix4x4 const& m, std::span<Vector3 const> input, std::span<Vector3> output, unsigned threadCount) {
+			assert("Input and output must have the same size" && input.size() == output.size());
+
+			SplatMatrix splat(m);
+			ParallelFor(input.size(), threadCount, [&](size_t begin, size_t end) {
+				size_t i = begin;
+				for (; i + 4 <= end; i += 4) {
+					float const* source = &input[i].x;
+					Float4 v0 = Load<Float4>(source + 0); // x0 y0 z0 x1
+					Float4 v1 = Load<Float4>(source + 4); // y1 z1 x2 y2
+					Float4 v2 = Load<Float4>(source + 8); // z2 x3 y3 z3
+
+					// Deinterleave into x, y and z registers
+					Float4 t0 = Shuffle<2, 3, 0, 1>(v1, v2); // x2 y2 z2 x3
+					Float4 t1 = Shuffle<1, 2, 0, 1>(v0, v1); // y0 z0 y1 z1
+					Float4 t2 = Shuffle<3, 3, 2, 3>(v1, v2); // y2 y2 y3 z3
+					Float4 x = Shuffle<0, 3, 0, 3>(v0, t0);
+					Float4 y = Shuffle<0, 2, 0, 2>(t1, t2);
+					Float4 z = Shuffle<1, 3, 0, 3>(t1, v2);
+
+					Transform4<isPoint>(splat, x, y, z);
+
+					// Interleave back
+					Float4 a = Shuffle<0, 2, 0, 2>(x, y); // x0 x2 y0 y2
+					Float4 b = Shuffle<1, 3, 1, 3>(x, y); // x1 x3 y1 y3
+					Float4 u = Shuffle<0, 0, 0, 0>(z, b); // z0 z0 x1 x1
+					Float4 p = Shuffle<1, 1, 2, 2>(z, b); // z1 z1 y1 y1
+					Float4 r = Shuffle<2, 2, 1, 1>(z, b); // z2 z2 x3 x3
+					Float4 s = Shuffle<3, 3, 3, 3>(b, z); // y3 y3 z3 z3
+
+					float* destination = &output[i].x;
+					Store(destination + 0, Shuffle<0, 2, 0, 2>(a, u)); // x0 y0 z0 x1
+					Store(destination + 4, Shuffle<2, 0, 1, 3>(p, a)); // y1 z1 x2 y2
+					Store(destination + 8, Shuffle<0, 2, 0, 2>(r, s)); // z2 x3 y3 z3
+				}
+
+				for (; i < end; ++i) {
+					Vector3 v = input[i];
+					Transform1<isPoint>(m, v.x, v.y, v.z);
+					output[i] = v;
+				}
+			});
+		}
+
+		template <bool isPoint>
+		void TransformSoA(Matrix4x4 const& m, ConstVector3SoA input, Vector3SoA output, unsigned threadCount) {
+			assert("Input and output must have the same size" && input.size() == output.size());
+
+			SplatMatrix splat(m);
+			ParallelFor(input.size(), threadCount, [&](size_t begin, size_t end) {
+				size_t i = begin;
+				for (; i + 4 <= end; i += 4) {
+					Float4 x = Load<Float4>(&input.x[i]);
+					Float4 y = Load<Float4>(&input.y[i]);
+					Float4 z = Load<Float4>(&input.z[i]);
+
+					Transform4<isPoint>(splat, x, y, z);
+
+					Store(&output.x[i], x);
+					Store(&output.y[i], y);
+					Store(&output.z[i], z);
+				}
+
+				for (; i < end; ++i) {
+					float x = input.x[i];
+					float y = input.y[i];
+					float z = input.z[i];
+					Transform1<isPoint>(m, x, y, z);
+					output.x[i] = x;
+					output.y[i] = y;
+					output.z[i] = z;
+				}
+			});
+		}
+	}
+
+	void TransformPoints(Matrix4x4 const& m, std::span<Vector3 const> points, std::span<Vector3> result, unsigned threadCount) {
+		TransformAoS<true>(m, points, result, threadCount);
+	}
+
+	void TransformPoints(Matrix4x4 const& m, ConstVector3SoA points, Vector3SoA result, unsigned threadCount) {
+		TransformSoA<true>(m, points, result, threadCount);
+	}
+
+	void TransformDirections(Matrix4x4 const& m, std::span<Vector3 const> directions, std::span<Vector3> result, unsigned threadCount) {
+		TransformAoS<false>(m, directions, result, threadCount);
+	}
+
+	void TransformDirections(Matrix4x4 const& m, ConstVector3SoA directions, Vector3SoA result, unsigned threadCount) {
+		TransformSoA<false>(m, directions, result, threadCount);
+	}
+
+	void TransformVectors(Matrix4x4 const& m, std::span<Vector4 const> vectors, std::span<Vector4> result, unsigned threadCount) {
+		assert("Input and output must have the same size" && vectors.size() == result.size());
+
+		// Columns of m, so that m * v = c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w
+		Float4 c0 = Load<Float4>(&m[0]);
+		Float4 c1 = Load<Float4>(&m[4]);
+		Float4 c2 = Load<Float4>(&m[8]);
+		Float4 c3 = Load<Float4>(&m[12]);
+		Simd::Transpose(c0, c1, c2, c3);
+
+		ParallelFor(vectors.size(), threadCount, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				Float4 v = Load<Float4>(&vectors[i].x);
+				Float4 r = Mul(c0, SplatLane<0>(v));
+				r = Add(r, Mul(c1, SplatLane<1>(v)));
+				r = Add(r, Mul(c2, SplatLane<2>(v)));
+				r = Add(r, Mul(c3, SplatLane<3>(v)));
+				Store(&result[i].x, r);
+			}
+		});
+	}
+
+	void MultiplyMatrices(Matrix4x4 const& lhs, std::span<Matrix4x4 const> rhs, std::span<Matrix4x4> result, unsigned threadCount) {
+		assert("Input and output must have the same size" && rhs.size() == result.size());
+
+		ParallelFor(rhs.size(), threadCount, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				alignas(16) float product[16];
+				MultiplyMatrix4(&lhs[0], &rhs[i][0], product);
+				std::copy(product, product + 16, &result[i][0]);
+			}
+		});
+	}
+
+	void MultiplyMatrices(std::span<Matrix4x4 const> lhs, std::span<Matrix4x4 const> rhs, std::span<Matrix4x4> result, unsigned threadCount) {
+		assert("Inputs and output must have the same size" && lhs.size() == rhs.size() && lhs.size() == result.size());
+
+		ParallelFor(lhs.size(), threadCount, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				alignas(16) float product[16];
+				MultiplyMatrix4(&lhs[i][0], &rhs[i][0], product);
+				std::copy(product, product + 16, &result[i][0]);
+			}
+		});
+	}
+}
@@ -0,0 +1,171 @@
+#include <Math/Culling.hpp>
+
+#include <Math/Simd.hpp>
+#include <Math/Parallel.hpp>
+
+namespace Math {
+	static_assert(sizeof(AABB) == 6 * sizeof(float), "AABB must be tightly packed to be processed as a float array");
+	static_assert(sizeof(BoundingSphere) == 4 * sizeof(float), "BoundingSphere must be tightly packed to be processed as a float array");
+
+	namespace {
+		using namespace Simd;
+
+		// Registers of 4 bounds each tested per iteration. Every plane coefficient
+		// is loaded once per iteration and the independent groups hide the
+		// latency of the additions.
+		constexpr size_t groupCount = 2;
+		constexpr size_t blockSize = 4 * groupCount;
+
+		// Plane coefficients and their absolute values, splat in every lane
+		struct SplatFrustum {
+			SplatFrustum(Frustum const& frustum) {
+				for (size_t p = 0; p < 6; ++p) {
+					Vector4 const& plane = frustum.GetPlanes()[p];
+					for (size_t i = 0; i < 4; ++i) {
+						normals[p][i] = Splat<Float4>(plane[i]);
+						absoluteNormals[p][i] = Splat<Float4>(plane[i] < 0.0f ? -plane[i] : plane[i]);
+					}
+				}
+			}
+
+			Float4 normals[6][4];
+			Float4 absoluteNormals[6][4];
+		};
+
+		// Smallest signed distance to the planes of 4 bounds given as centers and
+		// extents, the bounds are visible where it is positive
+		inline void Distances(SplatFrustum const& f, Float4 const (&x)[groupCount], Float4 const (&y)[groupCount], Float4 const (&z)[groupCount], Float4 const (&ex)[groupCount], Float4 const (&ey)[groupCount], Float4 const (&ez)[groupCount], Float4 (&result)[groupCount]) {
+			for (size_t p = 0; p < 6; ++p) {
+				Float4 const* n = f.normals[p];
+				Float4 const* a = f.absoluteNormals[p];
+
+				for (size_t g = 0; g < groupCount; ++g) {
+					Float4 distance = Add(Add(Add(Mul(n[0], x[g]), Mul(n[1], y[g])), Mul(n[2], z[g])), n[3]);
+					Float4 radius = Add(Add(Mul(a[0], ex[g]), Mul(a[1], ey[g])), Mul(a[2], ez[g]));
+					Float4 sum = Add(distance, radius);
+					result[g] = p == 0 ? sum : Min(result[g], sum);
+				}
+			}
+		}
+
+		inline void StoreVisibility(Float4 const (&distances)[groupCount], uint8_t* visible) {
+			for (size_t g = 0; g < groupCount; ++g) {
+				float values[4];
+				Store(values, distances[g]);
+				for (size_t i = 0; i < 4; ++i) {
+					visible[4 * g + i] = values[i] >= 0.0f ? 1 : 0;
+				}
+			}
+		}
+
+		template <typename Bounds, typename Block>
+		void Cull(Frustum const& frustum, std::span<Bounds const> bounds, std::span<uint8_t> visible, unsigned threadCount, Block&& block) {
+			assert("Input and output must have the same size" && bounds.size() == visible.size());
+
+			SplatFrustum splat(frustum);
+			ParallelFor<blockSize>(bounds.size(), threadCount, [&](size_t begin, size_t end) {
+				size_t i = begin;
+				for (; i + blockSize <= end; i += blockSize) {
+					block(splat, &bounds[i], &visible[i]);
+				}
+
+				for (; i < end; ++i) {
+					visible[i] = frustum.Intersects(bounds[i]) ? 1 : 0;
+				}
+			});
+		}
+
+		void CullBoxBlock(SplatFrustum const& f, AABB const* boxes, uint8_t* visible) {
+			Float4 const half = Splat<Float4>(0.5f);
+			Float4 x[groupCount], y[groupCount], z[groupCount];
+			Float4 ex[groupCount], ey[groupCount], ez[groupCount];
+
+			for (size_t g = 0; g < groupCount; ++g) {
+				// Every box is 6 floats: the first 4 and the last 4 of each give
+				// minX minY minZ maxX and minZ maxX maxY maxZ once transposed
+				float const* source = &boxes[4 * g].min.x;
+				Float4 a0 = Load<Float4>(source + 0);
+				Float4 a1 = Load<Float4>(source + 6);
+				Float4 a2 = Load<Float4>(source + 12);
+				Float4 a3 = Load<Float4>(source + 18);
+				Float4 b0 = Load<Float4>(source + 2);
+				Float4 b1 = Load<Float4>(source + 8);
+				Float4 b2 = Load<Float4>(source + 14);
+				Float4 b3 = Load<Float4>(source + 20);
+				Simd::Transpose(a0, a1, a2, a3);
+				Simd::Transpose(b0, b1, b2, b3);
+
+				// Same operations as AABB::Center and AABB::Extents
+				x[g] = Mul(Add(a0, a3), half);
+				y[g] = Mul(Add(a1, b2), half);
+				z[g] = Mul(Add(a2, b3), half);
+				ex[g] = Mul(Sub(a3, a0), half);
+				ey[g] = Mul(Sub(b2, a1), half);
+				ez[g] = Mul(Sub(b3, a2), half);
+			}
+
+			Float4 distances[groupCount];
+			Distances(f, x, y, z, ex, ey, ez, distances);
+			StoreVisibility(distances, visible);
+		}
+
+		void CullSphereBlock(SplatFrustum const& f, BoundingSphere const* spheres, uint8_t* visible) {
+			Float4 x[groupCount], y[groupCount], z[groupCount], radii[groupCount];
+
+			for (size_t g = 0; g < groupCount; ++g) {
+				float const* source = &spheres[4 * g].center.x;
+				x[g] = Load<Float4>(source + 0);
+				y[g] = Load<Float4>(source + 4);
+				z[g] = Load<Float4>(source + 8);
+				radii[g] = Load<Float4>(source + 12);
+				Simd::Transpose(x[g], y[g], z[g], radii[g]);
+			}
+
+			Float4 distances[groupCount];
+			for (size_t p = 0; p < 6; ++p) {
+				Float4 const* n = f.normals[p];
+
+				for (size_t g = 0; g < groupCount; ++g) {
+					Float4 distance = Add(Add(Add(Mul(n[0], x[g]), Mul(n[1], y[g])), Mul(n[2], z[g])), n[3]);
+					Float4 sum = Add(distance, radii[g]);
+					distances[g] = p == 0 ? sum : Min(distances[g], sum);
+				}
+			}
+
+			StoreVisibility(distances, visible);
+		}
+
+		size_t Compact(std::span<uint8_t const> visible, std::vector<uint32_t>& visibleIndices) {
+			visibleIndices.clear();
+			for (size_t i = 0; i < visible.size(); ++i) {
+				if (visible[i] != 0) {
+					visibleIndices.push_back(static_cast<uint32_t>(i));
+				}
+			}
+
+			return visibleIndices.size();
+		}
+	}
+
+	void CullBoxes(Frustum const& frustum, std::span<AABB const> boxes, std::span<uint8_t> visible, unsigned threadCount) {
+		Cull(frustum, boxes, visible, threadCount, CullBoxBlock);
+	}
+
+	void CullSpheres(Frustum const& frustum, std::span<BoundingSphere const> spheres, std::span<uint8_t> visible, unsigned threadCount) {
+		Cull(frustum, spheres, visible, threadCount, CullSphereBlock);
+	}
+
+	size_t CullBoxes(Frustum const& frustum, std::span<AABB const> boxes, std::vector<uint32_t>& visibleIndices, unsigned threadCount) {
+		std::vector<uint8_t> visible(boxes.size());
+		CullBoxes(frustum, boxes, visible, threadCount);
+
+		return Compact(visible, visibleIndices);
+	}
+
+	size_t CullSpheres(Frustum const& frustum, std::span<BoundingSphere const> spheres, std::vector<uint32_t>& visibleIndices, unsigned threadCount) {
+		std::vector<uint8_t> visible(spheres.size());
+		CullSpheres(frustum, spheres, visible, threadCount);
+
+		return Compact(visible, visibleIndices);
+	}
+}
@@ -0,0 +1,61 @@
+#include <Math/DepthPrecision.hpp>
+
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+namespace Math {
+	float QuantizeDepth(float depth, DepthFormat format) {
+		float clamped = std::clamp(depth, 0.0f, 1.0f);
+
+		switch (format) {
+			case DepthFormat::Depth16Unorm: {
+				constexpr double levels = 65535.0;
+				return static_cast<float>(std::round(clamped * levels) / levels);
+			}
+
+			case DepthFormat::Depth24Plus: {
+				constexpr double levels = 16777215.0;
+				return static_cast<float>(std::round(clamped * levels) / levels);
+			}
+
+			case DepthFormat::Depth32Float:
+			default: {
+				return clamped;
+			}
+		}
+	}
+
+	DepthPrecisionReport MeasureDepthPrecision(Matrix4x4 const& projection, DepthFormat format, float near, float far, size_t sampleCount) {
+		assert("Range must be valid and finite" && near > 0.0f && far > near && std::isfinite(far));
+		assert("At least two samples are needed" && sampleCount >= 2);
+
+		Matrix4x4d inverse = Matrix4x4d::InverseProjection(Matrix4x4d(projection));
+
+		DepthPrecisionReport report {};
+		report.samples.reserve(sampleCount);
+
+		double logNear = std::log(static_cast<double>(near));
+		double logFar = std::log(static_cast<double>(far));
+		for (size_t i = 0; i < sampleCount; ++i) {
+			double t = static_cast<double>(i) / static_cast<double>(sampleCount - 1);
+			float distance = static_cast<float>(std::exp(logNear + t * (logFar - logNear)));
+
+			Vector4 clip = projection * Vector4(0.0f, 0.0f, distance, 1.0f);
+			float depth = QuantizeDepth(clip.z / clip.w, format);
+
+			Vector4d view = inverse * Vector4d(0.0, 0.0, static_cast<double>(depth), 1.0);
+			double reconstructed = view.z / view.w;
+
+			DepthPrecisionSample sample {};
+			sample.distance = distance;
+			sample.error = std::abs(reconstructed - distance) / distance;
+
+			report.maxError = std::max(report.maxError, sample.error);
+			report.meanError += sample.error / static_cast<double>(sampleCount);
+			report.samples.push_back(sample);
+		}
+
+		return report;
+	}
+}
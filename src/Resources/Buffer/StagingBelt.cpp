@@ -0,0 +1,181 @@
+#include <Resources/Buffer/StagingBelt.hpp>
+
+// Rows of texture copies from a buffer must be 256 bytes apart
+static constexpr uint32_t textureRowAlignment = 256;
+
+StagingBelt::StagingBelt(Device& device, size_t chunkSize, uint32_t chunkCount) :
+	_device(device),
+	_state(std::make_shared<State>(State { StagingRing((chunkSize + 3) & ~size_t(3), chunkCount), {} })) {
+	CreateChunks();
+}
+
+void StagingBelt::CreateChunks() {
+	_state->chunks.resize(_state->ring.GetChunkCount());
+	for (uint32_t chunk = 0; chunk < _state->ring.GetChunkCount(); ++chunk) {
+		size_t chunkSize = _state->ring.GetChunkSize(chunk);
+		if (_state->chunks[chunk].buffer != nullptr || chunkSize == 0) {
+			continue;
+		}
+
+		BufferDescriptor bufferDescriptor(chunkSize, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc, "staging_belt");
+		bufferDescriptor.mappedAtCreation = true;
+
+		Chunk& staging = _state->chunks[chunk];
+		staging.buffer = std::make_unique<Buffer>(_device, bufferDescriptor);
+		staging.mapped = static_cast<uint8_t*>(staging.buffer->Handle().getMappedRange(0, chunkSize));
+	}
+}
+
+StagingAllocation StagingBelt::Allocate(size_t size, size_t alignment) {
+	// Mapped buffers must be a multiple of 4 bytes, so are the chunks
+	StagingAllocation allocation = _state->ring.Allocate((size + 3) & ~size_t(3), alignment);
+	CreateChunks();
+	return allocation;
+}
+
+void StagingBelt::WriteBuffer(Buffer& buffer, uint64_t offset, void const* data, size_t size) {
+	if (size % 4 != 0 || offset % 4 != 0) {
+		throw std::runtime_error("Staged buffer writes must have a size and an offset multiple of 4");
+	}
+
+	if (size == 0) {
+		return;
+	}
+
+	StagingAllocation allocation = Allocate(size, 4);
+	std::memcpy(_state->chunks[allocation.chunk].mapped + allocation.offset, data, size);
+
+	// Following the previous write in both buffers, a single copy does both
+	if (!_bufferCopies.empty()) {
+		BufferCopy& last = _bufferCopies.back();
+		if (last.chunk == allocation.chunk && last.sourceOffset + last.size == allocation.offset && last.destination == &buffer && last.destinationOffset + last.size == offset) {
+			last.size += size;
+			return;
+		}
+	}
+
+	_bufferCopies.push_back({ allocation.chunk, allocation.offset, &buffer, offset, size });
+}
+
+void StagingBelt::WriteTexture(TexelCopyTextureInfo const& destination, void const* data, size_t size, TexelCopyBufferLayout const& layout, Extent3D const& writeSize) {
+	// The rows of the block-compressed formats are rows of 4x4 blocks
+	uint32_t blockRows = GetBlockFormat(destination.texture.getFormat()).has_value() ? (writeSize.height + 3) / 4 : writeSize.height;
+	uint32_t rowsPerImage = layout.rowsPerImage;
+	if (rowsPerImage == WGPU_COPY_STRIDE_UNDEFINED) {
+		if (writeSize.depthOrArrayLayers > 1) {
+			throw std::invalid_argument("Staged texture writes of several layers must set rowsPerImage");
+		}
+
+		rowsPerImage = blockRows;
+	}
+
+	// The last layer ends at its last row, like in data
+	uint64_t rowCount = writeSize.depthOrArrayLayers == 0 ? 0 : static_cast<uint64_t>(writeSize.depthOrArrayLayers - 1) * rowsPerImage + blockRows;
+	uint64_t stagedBytesPerRow = (static_cast<uint64_t>(layout.bytesPerRow) + textureRowAlignment - 1) & ~uint64_t(textureRowAlignment - 1);
+	if (rowCount == 0 || size <= layout.offset) {
+		return;
+	}
+
+	StagingAllocation allocation = Allocate(static_cast<size_t>(stagedBytesPerRow * rowCount), textureRowAlignment);
+
+	// The last row of data may be shorter than bytesPerRow
+	uint8_t const* source = static_cast<uint8_t const*>(data) + layout.offset;
+	size_t remaining = size - layout.offset;
+	uint8_t* staged = _state->chunks[allocation.chunk].mapped + allocation.offset;
+	for (uint64_t row = 0; row < rowCount && remaining > 0; ++row) {
+		size_t rowSize = std::min<size_t>(layout.bytesPerRow, remaining);
+		std::memcpy(staged + static_cast<size_t>(row * stagedBytesPerRow), source + static_cast<size_t>(row * layout.bytesPerRow), rowSize);
+		remaining -= rowSize;
+	}
+
+	TextureCopy copy {};
+	copy.chunk = allocation.chunk;
+	copy.layout.offset = allocation.offset;
+	copy.layout.bytesPerRow = static_cast<uint32_t>(stagedBytesPerRow);
+	copy.layout.rowsPerImage = rowsPerImage;
+	copy.destination = destination;
+	copy.size = writeSize;
+	_textureCopies.push_back(copy);
+}
+
+void StagingBelt::Finish(CommandEncoder& encoder) {
+	for (BufferCopy const& copy : _bufferCopies) {
+		encoder->copyBufferToBuffer(_state->chunks[copy.chunk].buffer->Handle(), copy.sourceOffset, copy.destination->Handle(), copy.destinationOffset, copy.size);
+	}
+
+	for (TextureCopy const& copy : _textureCopies) {
+		wgpu::TexelCopyBufferInfo source {};
+		source.layout = copy.layout;
+		source.buffer = _state->chunks[copy.chunk].buffer->Handle();
+		encoder->copyBufferToTexture(source, copy.destination, copy.size);
+	}
+
+	_copyCount = static_cast<uint32_t>(_bufferCopies.size() + _textureCopies.size());
+	_bufferCopies.clear();
+	_textureCopies.clear();
+
+	// The GPU can only read unmapped buffers
+	for (uint32_t chunk : _state->ring.Close()) {
+		_state->chunks[chunk].buffer->Handle().unmap();
+		_state->chunks[chunk].mapped = nullptr;
+		_finished.push_back(chunk);
+	}
+}
+
+void StagingBelt::Recall(Queue& queue) {
+	// The callbacks of the submissions already done, without waiting for the
+	// GPU
+	_device->poll(false, nullptr);
+
+	if (_finished.empty()) {
+		return;
+	}
+
+	// The chunks are only mapped once the submission is done, so that the
+	// mapping resolves at once instead of waiting for the GPU
+	std::weak_ptr<State> weakState = _state;
+	queue->onSubmittedWorkDone(wgpu::CallbackMode::AllowSpontaneous, [weakState, chunks = _finished](auto) {
+		std::shared_ptr<State> state = weakState.lock();
+		if (state == nullptr) {
+			return;
+		}
+
+		for (uint32_t chunk : chunks) {
+			if (state->ring.IsTemporary(chunk)) {
+				state->ring.Recycle(chunk);
+				state->chunks[chunk].buffer.reset();
+				continue;
+			}
+
+			size_t chunkSize = state->ring.GetChunkSize(chunk);
+			state->chunks[chunk].buffer->Handle().mapAsync(wgpu::MapMode::Write, 0, chunkSize, wgpu::CallbackMode::AllowSpontaneous, [weakState, chunk, chunkSize](auto status, auto) {
+				std::shared_ptr<State> state = weakState.lock();
+				if (state == nullptr || status != wgpu::MapAsyncStatus::Success) {
+					return;
+				}
+
+				state->chunks[chunk].mapped = static_cast<uint8_t*>(state->chunks[chunk].buffer->Handle().getMappedRange(0, chunkSize));
+				state->ring.Recycle(chunk);
+			});
+		}
+	});
+
+	_finished.clear();
+}
+
+uint32_t StagingBelt::GetInFlightCount() const {
+	uint32_t count = 0;
+	for (uint32_t chunk = 0; chunk < _state->ring.GetChunkCount(); ++chunk) {
+		count += _state->ring.GetChunkState(chunk) == StagingRing::ChunkState::InFlight ? 1 : 0;
+	}
+
+	return count;
+}
+
+size_t StagingBelt::GetCapacity() const {
+	return _state->ring.GetCapacity();
+}
+
+StagingStatistics const& StagingBelt::GetStatistics() const {
+	return _state->ring.GetStatistics();
+}
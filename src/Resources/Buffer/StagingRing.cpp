@@ -0,0 +1,149 @@
+#include <Resources/Buffer/StagingRing.hpp>
+
+StagingRing::StagingRing(size_t chunkSize, uint32_t chunkCount) : _chunkSize(chunkSize) {
+	if (chunkSize == 0 || chunkCount == 0) {
+		throw std::runtime_error("A staging ring needs at least one chunk of at least one byte");
+	}
+
+	_chunks.resize(chunkCount, { chunkSize, 0, ChunkState::Free, false });
+}
+
+size_t StagingRing::Fit(Chunk const& chunk, size_t size, size_t alignment) {
+	size_t offset = (chunk.used + alignment - 1) & ~(alignment - 1);
+	if (offset > chunk.size || chunk.size - offset < size) {
+		return SIZE_MAX;
+	}
+
+	return offset;
+}
+
+uint32_t StagingRing::AddTemporary(size_t size) {
+	auto released = std::find_if(_chunks.begin(), _chunks.end(), [](Chunk const& chunk) {
+		return chunk.state == ChunkState::Released;
+	});
+
+	uint32_t chunk = static_cast<uint32_t>(released - _chunks.begin());
+	if (released == _chunks.end()) {
+		_chunks.emplace_back();
+	}
+
+	_chunks[chunk] = { size, size, ChunkState::Open, true };
+	return chunk;
+}
+
+StagingAllocation StagingRing::Allocate(size_t size, size_t alignment) {
+	if (size == 0) {
+		throw std::runtime_error("Empty staging allocation");
+	}
+
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+		throw std::runtime_error("The alignment of a staging allocation must be a power of two");
+	}
+
+	// Alone in its chunk, which the next allocations do not share: the ring
+	// goes on from the chunk written last
+	if (size > _chunkSize) {
+		uint32_t chunk = AddTemporary(size);
+		_openBytes += size;
+		_statistics.totalStagedBytes += size;
+		++_statistics.oversized;
+		return { chunk, 0 };
+	}
+
+	uint32_t chunk = static_cast<uint32_t>(_chunks.size());
+	size_t offset = SIZE_MAX;
+
+	if (_started && _chunks[_current].state == ChunkState::Open) {
+		offset = Fit(_chunks[_current], size, alignment);
+		chunk = _current;
+	}
+
+	// The next free chunk in the order of the ring
+	uint32_t chunkCount = static_cast<uint32_t>(_chunks.size());
+	uint32_t start = _started ? _current + 1 : 0;
+	for (uint32_t i = 0; i < chunkCount && offset == SIZE_MAX; ++i) {
+		uint32_t candidate = (start + i) % chunkCount;
+		if (_chunks[candidate].state != ChunkState::Free) {
+			continue;
+		}
+
+		offset = Fit(_chunks[candidate], size, alignment);
+		chunk = candidate;
+		if (offset != SIZE_MAX && _started && start + i >= chunkCount) {
+			++_statistics.wraparounds;
+		}
+	}
+
+	// Every chunk is in flight
+	if (offset == SIZE_MAX) {
+		_chunks.push_back({ _chunkSize, 0, ChunkState::Free, false });
+		chunk = static_cast<uint32_t>(_chunks.size() - 1);
+		offset = 0;
+		++_statistics.stalls;
+	}
+
+	Chunk& allocated = _chunks[chunk];
+	_openBytes += offset + size - allocated.used;
+	_statistics.totalStagedBytes += offset + size - allocated.used;
+
+	allocated.used = offset + size;
+	allocated.state = ChunkState::Open;
+	_current = chunk;
+	_started = true;
+
+	return { chunk, offset };
+}
+
+std::vector<uint32_t> StagingRing::Close() {
+	std::vector<uint32_t> closed {};
+	for (uint32_t chunk = 0; chunk < _chunks.size(); ++chunk) {
+		if (_chunks[chunk].state == ChunkState::Open) {
+			_chunks[chunk].state = ChunkState::InFlight;
+			closed.push_back(chunk);
+		}
+	}
+
+	_statistics.stagedBytes = _openBytes;
+	_openBytes = 0;
+	++_statistics.closes;
+	return closed;
+}
+
+void StagingRing::Recycle(uint32_t chunk) {
+	if (chunk >= _chunks.size() || _chunks[chunk].state != ChunkState::InFlight) {
+		throw std::runtime_error("Only the chunks in flight can be recycled");
+	}
+
+	_chunks[chunk].used = 0;
+	_chunks[chunk].state = ChunkState::Free;
+
+	if (_chunks[chunk].temporary) {
+		_chunks[chunk].size = 0;
+		_chunks[chunk].state = ChunkState::Released;
+	}
+}
+
+uint32_t StagingRing::GetChunkCount() const {
+	return static_cast<uint32_t>(_chunks.size());
+}
+
+size_t StagingRing::GetChunkSize(uint32_t chunk) const {
+	return _chunks.at(chunk).size;
+}
+
+StagingRing::ChunkState StagingRing::GetChunkState(uint32_t chunk) const {
+	return _chunks.at(chunk).state;
+}
+
+bool StagingRing::IsTemporary(uint32_t chunk) const {
+	return _chunks.at(chunk).temporary;
+}
+
+size_t StagingRing::GetCapacity() const {
+	size_t capacity = 0;
+	for (Chunk const& chunk : _chunks) {
+		capacity += chunk.size;
+	}
+
+	return capacity;
+}
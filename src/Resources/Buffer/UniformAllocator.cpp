@@ -0,0 +1,58 @@
+#include <Resources/Buffer/UniformAllocator.hpp>
+
+UniformAllocator::UniformAllocator(size_t capacity, uint32_t alignment) : _alignment(alignment) {
+	if (alignment < 4 || (alignment & (alignment - 1)) != 0) {
+		throw std::runtime_error("The alignment of uniform slices must be a power of two, at least 4");
+	}
+
+	if (capacity == 0) {
+		throw std::runtime_error("Empty uniform allocator");
+	}
+
+	_data.resize((capacity + alignment - 1) & ~(static_cast<size_t>(alignment) - 1));
+}
+
+uint32_t UniformAllocator::Allocate(size_t size) {
+	if (size == 0 || size > _data.size() - _next) {
+		throw std::runtime_error("Uniform allocator full: " + std::to_string(_count) + " slices, " + std::to_string(_data.size()) + " bytes");
+	}
+
+	uint32_t offset = static_cast<uint32_t>(_next);
+	std::memset(&_data[offset], 0, size);
+
+	_used = (_next + size + 3) & ~size_t(3);
+	_next = (_next + size + _alignment - 1) & ~(static_cast<size_t>(_alignment) - 1);
+	++_count;
+
+	return offset;
+}
+
+uint8_t* UniformAllocator::GetData(uint32_t offset) {
+	return &_data.at(offset);
+}
+
+uint8_t const* UniformAllocator::GetData() const {
+	return _data.data();
+}
+
+size_t UniformAllocator::GetUsedBytes() const {
+	return _used;
+}
+
+uint32_t UniformAllocator::GetCount() const {
+	return _count;
+}
+
+size_t UniformAllocator::GetCapacity() const {
+	return _data.size();
+}
+
+uint32_t UniformAllocator::GetAlignment() const {
+	return _alignment;
+}
+
+void UniformAllocator::Reset() {
+	_next = 0;
+	_used = 0;
+	_count = 0;
+}
@@ -0,0 +1,47 @@
+#include <Resources/Buffer/UniformArena.hpp>
+
+UniformArena::UniformArena(Device& device, size_t capacity, uint32_t bindingSize) :
+	_allocator(capacity, device.Limits().minUniformBufferOffsetAlignment),
+	_bindingSize(bindingSize),
+	_buffer(device, BufferDescriptor(_allocator.GetCapacity(), wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Uniform, "uniform_arena")) {
+	// The last slice is bound with bindingSize bytes too
+	if (bindingSize == 0 || bindingSize > _allocator.GetCapacity()) {
+		throw std::runtime_error("The bindings of a uniform arena must fit in it");
+	}
+}
+
+BufferBindingLayout UniformArena::LayoutEntry(uint32_t binding, wgpu::ShaderStage visibility) const {
+	return BufferBindingLayout(binding, visibility, wgpu::BufferBindingType::Uniform, _bindingSize, true);
+}
+
+BufferBinding UniformArena::BindGroupEntry(uint32_t binding) {
+	return BufferBinding(binding, _buffer, _bindingSize, 0);
+}
+
+void UniformArena::Upload(StagingBelt& stagingBelt) {
+	if (_allocator.GetUsedBytes() != 0) {
+		stagingBelt.WriteBuffer(_buffer, 0, _allocator.GetData(), _allocator.GetUsedBytes());
+	}
+}
+
+void UniformArena::Upload(Queue& queue) {
+	if (_allocator.GetUsedBytes() != 0) {
+		queue->writeBuffer(_buffer.Handle(), 0, _allocator.GetData(), _allocator.GetUsedBytes());
+	}
+}
+
+void UniformArena::Reset() {
+	_allocator.Reset();
+}
+
+uint32_t UniformArena::GetCount() const {
+	return _allocator.GetCount();
+}
+
+uint32_t UniformArena::GetAlignment() const {
+	return _allocator.GetAlignment();
+}
+
+size_t UniformArena::GetCapacity() const {
+	return _allocator.GetCapacity();
+}
@@ -0,0 +1,57 @@
+#include <Resources/Geometry/CookedMesh.hpp>
+
+wgpu::VertexFormat GetVertexFormat(MeshAttributeFormat format) {
+	switch (format) {
+		case MeshAttributeFormat::Float32x2:
+			return wgpu::VertexFormat::Float32x2;
+
+		case MeshAttributeFormat::Float32x3:
+			return wgpu::VertexFormat::Float32x3;
+
+		case MeshAttributeFormat::Snorm16x2:
+			return wgpu::VertexFormat::Snorm16x2;
+
+		case MeshAttributeFormat::Snorm16x4:
+			return wgpu::VertexFormat::Snorm16x4;
+
+		case MeshAttributeFormat::Float16x2:
+			return wgpu::VertexFormat::Float16x2;
+	}
+
+	throw std::runtime_error("Unknown mesh attribute format");
+}
+
+wgpu::IndexFormat GetIndexFormat(MeshContainer const& container) {
+	return container.GetIndexSize() == sizeof(uint16_t) ? wgpu::IndexFormat::Uint16 : wgpu::IndexFormat::Uint32;
+}
+
+std::vector<VertexAttribute> GetVertexAttributes(MeshContainer const& container) {
+	std::vector<VertexAttribute> attributes {};
+	for (MeshContainerAttribute const& attribute : container.GetAttributes()) {
+		attributes.push_back(VertexAttribute(attribute.location, GetVertexFormat(attribute.format), attribute.offset));
+	}
+
+	return attributes;
+}
+
+VertexBufferLayout GetVertexBufferLayout(MeshContainer const& container, std::vector<VertexAttribute> const& attributes) {
+	return VertexBufferLayout(container.GetVertexStride(), attributes);
+}
+
+BufferDescriptor GetVertexBufferDescriptor(MeshContainer const& container) {
+	return BufferDescriptor(container.GetVertexDataSize(), wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Vertex, "cooked_vertex_buffer");
+}
+
+BufferDescriptor GetIndexBufferDescriptor(MeshContainer const& container) {
+	return BufferDescriptor(container.GetIndexDataSize(), wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Index, "cooked_index_buffer");
+}
+
+void WriteMeshContainer(Queue& queue, Buffer& vertexBuffer, Buffer& indexBuffer, MeshContainer const& container) {
+	if (container.GetVertexDataSize() != 0) {
+		queue->writeBuffer(vertexBuffer.Handle(), 0, container.GetVertexData(), container.GetVertexDataSize());
+	}
+
+	if (container.GetIndexDataSize() != 0) {
+		queue->writeBuffer(indexBuffer.Handle(), 0, container.GetIndexData(), container.GetIndexDataSize());
+	}
+}
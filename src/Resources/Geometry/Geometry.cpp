@@ -13,43 +13,19 @@ void WriteMipMaps(wgpu::Device device, wgpu::Texture texture, wgpu::Extent3D tex
 	wgpu::TexelCopyBufferLayout source {};
 	source.offset = 0;
 
-	wgpu::Extent3D mipLevelSize = textureSize;
-	std::vector<uint8_t> previousLevelPixels;
-	wgpu::Extent3D previousMipLevelSize;
+	// sRGB textures are filtered in linear space, which the sampler gives back
+	ColorSpace colorSpace = texture.getFormat() == wgpu::TextureFormat::RGBA8UnormSrgb ? ColorSpace::Srgb : ColorSpace::Linear;
+	MipChain mipChain(data, textureSize.width, textureSize.height, MipFilter::Box, colorSpace, mipLevelCount, std::thread::hardware_concurrency());
 	for (uint32_t level = 0; level < mipLevelCount; ++level) {
-		std::vector<uint8_t> pixels(4 * mipLevelSize.width * mipLevelSize.height);
-
-		if (level == 0) {
-			std::memcpy(pixels.data(), data, pixels.size());
-		}
-
-		else {
-			for (uint32_t i = 0; i < mipLevelSize.width; ++i) {
-				for (uint32_t j = 0; j < mipLevelSize.height; ++j) {
-					uint8_t* p = &pixels[4 * (j * mipLevelSize.width + i)];
-
-					uint8_t* p00 = &previousLevelPixels[4 * ((2 * j + 0) * previousMipLevelSize.width + (2 * i + 0))];
-					uint8_t* p01 = &previousLevelPixels[4 * ((2 * j + 0) * previousMipLevelSize.width + (2 * i + 1))];
-					uint8_t* p10 = &previousLevelPixels[4 * ((2 * j + 1) * previousMipLevelSize.width + (2 * i + 0))];
-					uint8_t* p11 = &previousLevelPixels[4 * ((2 * j + 1) * previousMipLevelSize.width + (2 * i + 1))];
-
-					p[0] = (p00[0] + p01[0] + p10[0] + p11[0]) / 4;
-					p[1] = (p00[1] + p01[1] + p10[1] + p11[1]) / 4;
-					p[2] = (p00[2] + p01[2] + p10[2] + p11[2]) / 4;
-					p[3] = (p00[3] + p01[3] + p10[3] + p11[3]) / 4;
-				}
-			}
-		}
+		MipChain::Level const& mipLevel = mipChain.GetLevel(level);
+		wgpu::Extent3D mipLevelSize = textureSize;
+		mipLevelSize.width = mipLevel.width;
+		mipLevelSize.height = mipLevel.height;
 
 		destination.mipLevel = level;
 		source.bytesPerRow = 4 * mipLevelSize.width;
 		source.rowsPerImage = mipLevelSize.height;
-		queue.writeTexture(destination, pixels.data(), pixels.size(), source, mipLevelSize);
-
-		previousLevelPixels = std::move(pixels);
-		previousMipLevelSize = mipLevelSize;
-		mipLevelSize.width /= 2;
-		mipLevelSize.height /= 2;
+		queue.writeTexture(destination, mipChain.GetData(level), mipChain.GetSize(level), source, mipLevelSize);
 	}
 
 	queue.release();
@@ -96,6 +72,18 @@ wgpu::Texture LoadTexture(std::filesystem::path const& path, wgpu::Device device
 	return texture;
 }
 
+std::vector<VertexAttribute> GetQuantizedVertexAttributes() {
+	std::vector<VertexAttribute> attributes {};
+	attributes.push_back(VertexAttribute(0, wgpu::VertexFormat::Snorm16x4, offsetof(QuantizedVertex, position)));
+	attributes.push_back(VertexAttribute(1, wgpu::VertexFormat::Snorm16x2, offsetof(QuantizedVertex, normal)));
+	attributes.push_back(VertexAttribute(2, wgpu::VertexFormat::Float16x2, offsetof(QuantizedVertex, uv)));
+	return attributes;
+}
+
+VertexBufferLayout GetQuantizedVertexBufferLayout(std::vector<VertexAttribute> const& attributes) {
+	return VertexBufferLayout(sizeof(QuantizedVertex), attributes);
+}
+
 wgpu::TextureView GetNextTexture(wgpu::Device& device, wgpu::Surface& surface) {
 	(void) device;
 
@@ -149,100 +137,3 @@ wgpu::TextureView GetNextTexture(wgpu::Device& device, wgpu::Surface& surface) {
 
 	return textureView;
 }
-
-bool LoadGeometry(std::filesystem::path const& path, std::vector<float>& pointData, std::vector<uint16_t>& indexData, int dimensions) {
-	std::ifstream file(path);
-	if (!file.is_open()) {
-		return false;
-	}
-
-	pointData.clear();
-	indexData.clear();
-
-	enum class Section
-	{
-		None,
-		Points,
-		Indices,
-	};
-
-	Section currentSection = Section::None;
-
-	float value = 0.0;
-	uint16_t index = 0;
-	std::string line = "";
-	while (!file.eof()) {
-		std::getline(file, line);
-
-		if (!line.empty() && line.back() == '\r') {
-			line.pop_back();
-		}
-
-		if (line == "[points]") {
-			currentSection = Section::Points;
-		}
-
-		else if (line == "[indices]") {
-			currentSection = Section::Indices;
-		}
-
-		else if (line[0] == '#' || line.empty()) {
-			// Do nothing, this is a comment
-		}
-
-		else if (currentSection == Section::Points) {
-			std::istringstream iss(line);
-			for (int i = 0; i < dimensions + 3; ++i) {
-				iss >> value;
-				pointData.push_back(value);
-			}
-		}
-
-		else if (currentSection == Section::Indices) {
-			std::istringstream iss(line);
-			for (int i = 0; i < 3; ++i) {
-				iss >> index;
-				indexData.push_back(index);
-			}
-		}
-	}
-	return true;
-}
-
-bool LoadGeometryFromOBJ(std::filesystem::path const& path, std::vector<VertexAttributes>& vertexData) {
-	tinyobj::attrib_t attrib {};
-	std::vector<tinyobj::shape_t> shapes {};
-	std::vector<tinyobj::material_t> materials {};
-
-	std::string warn {};
-	std::string err {};
-
-	bool result = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.string().c_str());
-
-	if (!warn.empty()) {
-		std::cerr << "Warning: " << warn << std::endl;
-	}
-
-	if (!err.empty()) {
-		std::cerr << "Error: " << err << std::endl;
-	}
-
-	if (!result) {
-		return false;
-	}
-
-	for (auto const& shape : shapes) {
-		size_t offset = vertexData.size();
-		vertexData.resize(offset + shape.mesh.indices.size());
-		for (size_t i = 0; i < shape.mesh.indices.size(); i++) {
-			tinyobj::index_t idx = shape.mesh.indices[i];
-
-			vertexData[i].position = {
-				attrib.vertices[3 * idx.vertex_index + 0],
-				-attrib.vertices[3 * idx.vertex_index + 2],
-				attrib.vertices[3 * idx.vertex_index + 1] };
-		}
-	}
-
-	return true;
-}
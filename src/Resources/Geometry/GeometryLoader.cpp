@@ -0,0 +1,130 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+
+#include <tiny_obj_loader.h>
+
+#include <Resources/Geometry/GeometryLoader.hpp>
+#include <Resources/Geometry/GeometryParser.hpp>
+#include <Utils/MappedFile.hpp>
+
+bool LoadGeometry(std::filesystem::path const& path, std::vector<float>& pointData, std::vector<uint32_t>& indexData, int dimensions) {
+	pointData.clear();
+	indexData.clear();
+
+	Utils::MappedFile file;
+	try {
+		file = Utils::MappedFile(path);
+	}
+
+	catch (std::runtime_error const&) {
+		return false;
+	}
+
+	std::string_view text(reinterpret_cast<char const*>(file.Data()), file.Size());
+	return ParseGeometry(text, pointData, indexData, dimensions);
+}
+
+// MARK: OBJ
+// Reads the file, warnings and errors going to the standard error
+static bool LoadOBJ(std::filesystem::path const& path, tinyobj::attrib_t& attrib, std::vector<tinyobj::shape_t>& shapes) {
+	std::vector<tinyobj::material_t> materials {};
+
+	std::string warn {};
+	std::string err {};
+
+	bool result = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.string().c_str());
+
+	if (!warn.empty()) {
+		std::cerr << "Warning: " << warn << std::endl;
+	}
+
+	if (!err.empty()) {
+		std::cerr << "Error: " << err << std::endl;
+	}
+
+	return result;
+}
+
+// Attributes of a corner, Z up in the file and Y up in the application, with
+// the texture origin at the top left
+static VertexAttributes GetVertex(tinyobj::attrib_t const& attrib, tinyobj::index_t const& idx) {
+	VertexAttributes vertex {};
+	vertex.position = {
+		attrib.vertices[3 * idx.vertex_index + 0],
+		-attrib.vertices[3 * idx.vertex_index + 2],
+		attrib.vertices[3 * idx.vertex_index + 1] };
+
+	if (idx.normal_index >= 0) {
+		vertex.normal = {
+			attrib.normals[3 * idx.normal_index + 0],
+			-attrib.normals[3 * idx.normal_index + 2],
+			attrib.normals[3 * idx.normal_index + 1] };
+	}
+
+	if (idx.texcoord_index >= 0) {
+		vertex.uv = {
+			attrib.texcoords[2 * idx.texcoord_index + 0],
+			1.0f - attrib.texcoords[2 * idx.texcoord_index + 1] };
+	}
+
+	return vertex;
+}
+
+bool LoadGeometryFromOBJ(std::filesystem::path const& path, std::vector<VertexAttributes>& vertexData) {
+	tinyobj::attrib_t attrib {};
+	std::vector<tinyobj::shape_t> shapes {};
+	if (!LoadOBJ(path, attrib, shapes)) {
+		return false;
+	}
+
+	for (auto const& shape : shapes) {
+		size_t offset = vertexData.size();
+		vertexData.resize(offset + shape.mesh.indices.size());
+		for (size_t i = 0; i < shape.mesh.indices.size(); i++) {
+			vertexData[offset + i] = GetVertex(attrib, shape.mesh.indices[i]);
+		}
+	}
+
+	return true;
+}
+
+bool LoadMeshFromOBJ(std::filesystem::path const& path, IndexedMesh& mesh) {
+	tinyobj::attrib_t attrib {};
+	std::vector<tinyobj::shape_t> shapes {};
+	if (!LoadOBJ(path, attrib, shapes)) {
+		return false;
+	}
+
+	mesh = IndexedMesh {};
+
+	size_t cornerCount = 0;
+	for (auto const& shape : shapes) {
+		cornerCount += shape.mesh.indices.size();
+	}
+
+	// Vertices are shared between shapes too
+	mesh.indices.reserve(cornerCount);
+	mesh.vertices.reserve(attrib.vertices.size() / 3);
+	VertexWelder welder(mesh, cornerCount);
+	for (auto const& shape : shapes) {
+		MeshPart part { shape.name, static_cast<uint32_t>(mesh.indices.size()), static_cast<uint32_t>(shape.mesh.indices.size()) };
+		for (tinyobj::index_t const& idx : shape.mesh.indices) {
+			welder.Add(GetVertex(attrib, idx));
+		}
+
+		mesh.parts.push_back(part);
+	}
+
+	return true;
+}
+
+Math::BVH BuildBVH(std::vector<VertexAttributes> const& vertexData, unsigned threadCount) {
+	std::vector<Math::Vector3> positions(vertexData.size());
+	for (size_t i = 0; i < vertexData.size(); ++i) {
+		positions[i] = vertexData[i].position;
+	}
+
+	return Math::BVH::Build(positions, threadCount);
+}
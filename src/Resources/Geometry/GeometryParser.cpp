@@ -0,0 +1,134 @@
+#include <charconv>
+#include <cstring>
+
+#include <Resources/Geometry/GeometryParser.hpp>
+
+namespace {
+	enum class Section {
+		None,
+		Points,
+		Indices,
+	};
+
+	// Next line of text from position, without its line ending and its
+	// leading and trailing spaces
+	std::string_view NextLine(std::string_view text, size_t& position) {
+		char const* begin = text.data() + position;
+		char const* newline = static_cast<char const*>(std::memchr(begin, '\n', text.size() - position));
+		size_t length = newline != nullptr ? static_cast<size_t>(newline - begin) : text.size() - position;
+		position += newline != nullptr ? length + 1 : length;
+
+		while (length != 0 && (begin[0] == ' ' || begin[0] == '\t')) {
+			++begin;
+			--length;
+		}
+
+		while (length != 0 && (begin[length - 1] == '\r' || begin[length - 1] == ' ' || begin[length - 1] == '\t')) {
+			--length;
+		}
+
+		return std::string_view(begin, length);
+	}
+
+	// Section started by line, or current if the line is not a section header
+	Section SectionOf(std::string_view line, Section current) {
+		if (line == "[points]") {
+			return Section::Points;
+		}
+
+		else if (line == "[indices]") {
+			return Section::Indices;
+		}
+
+		return current;
+	}
+
+	bool IsData(std::string_view line) {
+		return !line.empty() && line[0] != '#' && line[0] != '[';
+	}
+
+	// Reads count numbers separated by spaces at the end of output
+	template <typename T>
+	bool ParseNumbers(std::string_view line, int count, T* output) {
+		char const* current = line.data();
+		char const* end = line.data() + line.size();
+		for (int i = 0; i < count; ++i) {
+			while (current != end && (*current == ' ' || *current == '\t')) {
+				++current;
+			}
+
+			std::from_chars_result result = std::from_chars(current, end, output[i]);
+			if (result.ec != std::errc {}) {
+				return false;
+			}
+
+			current = result.ptr;
+		}
+
+		return true;
+	}
+
+	// Callers never see the geometry of a malformed text
+	bool Fail(std::vector<float>& pointData, std::vector<uint32_t>& indexData) {
+		pointData.clear();
+		indexData.clear();
+		return false;
+	}
+}
+
+bool ParseGeometry(std::string_view text, std::vector<float>& pointData, std::vector<uint32_t>& indexData, int dimensions) {
+	pointData.clear();
+	indexData.clear();
+
+	int pointSize = dimensions + 3;
+	if (pointSize <= 0) {
+		return false;
+	}
+
+	// MARK: Counting
+	size_t pointCount = 0;
+	size_t triangleCount = 0;
+	Section section = Section::None;
+	for (size_t position = 0; position < text.size();) {
+		std::string_view line = NextLine(text, position);
+		section = SectionOf(line, section);
+		if (IsData(line)) {
+			pointCount += section == Section::Points ? 1 : 0;
+			triangleCount += section == Section::Indices ? 1 : 0;
+		}
+	}
+
+	// MARK: Parsing
+	// Sized once, the numbers are written in place
+	pointData.resize(pointCount * pointSize);
+	indexData.resize(triangleCount * 3);
+
+	float* point = pointData.data();
+	uint32_t* index = indexData.data();
+	section = Section::None;
+	for (size_t position = 0; position < text.size();) {
+		std::string_view line = NextLine(text, position);
+		section = SectionOf(line, section);
+		if (!IsData(line) || section == Section::None) {
+			continue;
+		}
+
+		if (section == Section::Points) {
+			if (!ParseNumbers(line, pointSize, point)) {
+				return Fail(pointData, indexData);
+			}
+
+			point += pointSize;
+		}
+
+		else {
+			if (!ParseNumbers(line, 3, index)) {
+				return Fail(pointData, indexData);
+			}
+
+			index += 3;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,119 @@
+#include <cstring>
+#include <bit>
+#include <algorithm>
+
+#include <Resources/Geometry/Mesh.hpp>
+
+namespace {
+	// Bits of a component, -0 hashing as 0 since they compare equal
+	uint32_t FloatBits(float value) {
+		return value == 0.0f ? 0 : std::bit_cast<uint32_t>(value);
+	}
+}
+
+// MARK: Welding
+VertexWelder::VertexWelder(IndexedMesh& mesh, size_t expectedVertexCount) : _mesh(mesh) {
+	_indices.reserve(expectedVertexCount);
+	for (uint32_t i = 0; i < _mesh.vertices.size(); ++i) {
+		_indices.emplace(_mesh.vertices[i], i);
+	}
+}
+
+uint32_t VertexWelder::Add(VertexAttributes const& vertex) {
+	auto [it, added] = _indices.try_emplace(vertex, static_cast<uint32_t>(_mesh.vertices.size()));
+	if (added) {
+		_mesh.vertices.push_back(vertex);
+	}
+
+	_mesh.indices.push_back(it->second);
+	return it->second;
+}
+
+size_t VertexWelder::Hash::operator()(VertexAttributes const& vertex) const {
+	float const components[] = {
+		vertex.position.x, vertex.position.y, vertex.position.z,
+		vertex.normal.x, vertex.normal.y, vertex.normal.z,
+		vertex.uv.x, vertex.uv.y };
+
+	// FNV-1a over the components
+	uint64_t hash = 14695981039346656037ULL;
+	for (float component : components) {
+		hash = (hash ^ FloatBits(component)) * 1099511628211ULL;
+	}
+
+	return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+bool VertexWelder::Equal::operator()(VertexAttributes const& lhs, VertexAttributes const& rhs) const {
+	return lhs.position == rhs.position && lhs.normal == rhs.normal && lhs.uv == rhs.uv;
+}
+
+IndexedMesh WeldVertices(std::vector<VertexAttributes> const& corners) {
+	IndexedMesh mesh {};
+	mesh.indices.reserve(corners.size());
+
+	VertexWelder welder(mesh, corners.size());
+	for (VertexAttributes const& corner : corners) {
+		welder.Add(corner);
+	}
+
+	mesh.parts.push_back(MeshPart { "", 0, static_cast<uint32_t>(mesh.indices.size()) });
+	return mesh;
+}
+
+// MARK: Index buffer
+bool HasShortIndices(IndexedMesh const& mesh) {
+	return GetIndexSize(mesh) == sizeof(uint16_t);
+}
+
+uint32_t GetIndexSize(IndexedMesh const& mesh) {
+	return GetIndexSize(mesh.vertices.size());
+}
+
+uint32_t GetIndexSize(size_t vertexCount) {
+	return vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+std::vector<uint8_t> PackIndices(IndexedMesh const& mesh) {
+	return PackIndices(mesh.indices, GetIndexSize(mesh));
+}
+
+std::vector<uint8_t> PackIndices(std::span<uint32_t const> indices, uint32_t indexSize) {
+	std::vector<uint8_t> data(indices.size() * indexSize);
+	if (indexSize == sizeof(uint16_t)) {
+		for (size_t i = 0; i < indices.size(); ++i) {
+			uint16_t index = static_cast<uint16_t>(indices[i]);
+			std::memcpy(&data[i * sizeof(uint16_t)], &index, sizeof(uint16_t));
+		}
+	}
+
+	else if (!data.empty()) {
+		std::memcpy(data.data(), indices.data(), data.size());
+	}
+
+	return data;
+}
+
+MeshMemory GetMeshMemory(IndexedMesh const& mesh) {
+	MeshMemory memory {};
+	memory.soupBytes = mesh.indices.size() * sizeof(VertexAttributes);
+	memory.vertexBytes = mesh.vertices.size() * sizeof(VertexAttributes);
+	memory.indexBytes = mesh.indices.size() * GetIndexSize(mesh);
+	return memory;
+}
+
+Math::AABB GetBounds(IndexedMesh const& mesh) {
+	if (mesh.vertices.empty()) {
+		return Math::AABB {};
+	}
+
+	Math::AABB bounds { mesh.vertices[0].position, mesh.vertices[0].position };
+	for (VertexAttributes const& vertex : mesh.vertices) {
+		for (size_t i = 0; i < 3; ++i) {
+			bounds.min[i] = std::min(bounds.min[i], vertex.position[i]);
+			bounds.max[i] = std::max(bounds.max[i], vertex.position[i]);
+		}
+	}
+
+	return bounds;
+}
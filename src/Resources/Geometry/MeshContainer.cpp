@@ -0,0 +1,364 @@
+#include <bit>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+
+#include <Resources/Geometry/MeshContainer.hpp>
+
+static_assert(std::endian::native == std::endian::little, "Mesh containers are read and written as they are in memory.");
+
+namespace {
+	// Sections start on multiples of this, for the copies of the driver
+	constexpr uint64_t sectionAlignment = 16;
+
+	// The limits of WebGPU
+	constexpr uint32_t maxAttributeCount = 16;
+	constexpr uint32_t maxVertexStride = 2048;
+
+	uint64_t Align(uint64_t value, uint64_t alignment = sectionAlignment) {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	bool IsKnownFormat(MeshAttributeFormat format) {
+		switch (format) {
+			case MeshAttributeFormat::Float32x2:
+			case MeshAttributeFormat::Float32x3:
+			case MeshAttributeFormat::Snorm16x2:
+			case MeshAttributeFormat::Snorm16x4:
+			case MeshAttributeFormat::Float16x2:
+				return true;
+		}
+
+		return false;
+	}
+
+	// Sizes of the sections, in bytes, the vertices and indices padded to 4
+	uint64_t VertexBytes(MeshContainerHeader const& header) {
+		return Align(static_cast<uint64_t>(header.vertexCount) * header.vertexStride, 4);
+	}
+
+	uint64_t IndexBytes(MeshContainerHeader const& header) {
+		return Align(static_cast<uint64_t>(header.indexCount) * header.indexSize, 4);
+	}
+
+	uint64_t PartBytes(MeshContainerHeader const& header) {
+		return static_cast<uint64_t>(header.partCount) * sizeof(MeshContainerPart);
+	}
+
+	uint64_t MeshletBytes(MeshContainerHeader const& header) {
+		return static_cast<uint64_t>(header.meshletCount) * sizeof(MeshContainerMeshlet);
+	}
+
+	uint64_t MeshletVertexBytes(MeshContainerHeader const& header) {
+		return static_cast<uint64_t>(header.meshletVertexCount) * sizeof(uint32_t);
+	}
+
+	uint64_t MeshletTriangleBytes(MeshContainerHeader const& header) {
+		return static_cast<uint64_t>(header.meshletTriangleCount) * 3;
+	}
+
+	void CheckSection(char const* name, uint64_t offset, uint64_t size, uint64_t fileSize) {
+		if (offset % 4 != 0 || offset > fileSize || size > fileSize - offset) {
+			throw std::runtime_error(std::string("truncated ") + name);
+		}
+	}
+
+	std::vector<MeshContainerAttribute> FullPrecisionAttributes() {
+		return {
+			MeshContainerAttribute { 0, MeshAttributeFormat::Float32x3, offsetof(VertexAttributes, position), 0 },
+			MeshContainerAttribute { 1, MeshAttributeFormat::Float32x3, offsetof(VertexAttributes, normal), 0 },
+			MeshContainerAttribute { 2, MeshAttributeFormat::Float32x2, offsetof(VertexAttributes, uv), 0 } };
+	}
+
+	std::vector<MeshContainerAttribute> QuantizedAttributes() {
+		return {
+			MeshContainerAttribute { 0, MeshAttributeFormat::Snorm16x4, offsetof(QuantizedVertex, position), 0 },
+			MeshContainerAttribute { 1, MeshAttributeFormat::Snorm16x2, offsetof(QuantizedVertex, normal), 0 },
+			MeshContainerAttribute { 2, MeshAttributeFormat::Float16x2, offsetof(QuantizedVertex, uv), 0 } };
+	}
+
+	// Indices, parts and bounds shared by both kinds of vertices
+	template <typename MeshType>
+	void SetIndices(MeshType const& mesh, Math::AABB const& bounds, MeshContainerHeader& header, std::vector<uint8_t>& indices, std::vector<MeshContainerPart>& parts) {
+		header.indexSize = GetIndexSize(mesh.vertices.size());
+		header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+		indices = PackIndices(mesh.indices, header.indexSize);
+
+		for (MeshPart const& part : mesh.parts) {
+			if (static_cast<uint64_t>(part.firstIndex) + part.indexCount > mesh.indices.size()) {
+				throw std::runtime_error("Part " + part.name + " out of the indices of its mesh");
+			}
+
+			parts.push_back(MeshContainerPart { part.firstIndex, part.indexCount });
+		}
+
+		header.partCount = static_cast<uint32_t>(parts.size());
+		header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+		header.boundsMin = { bounds.min.x, bounds.min.y, bounds.min.z };
+		header.boundsMax = { bounds.max.x, bounds.max.y, bounds.max.z };
+	}
+}
+
+uint32_t GetAttributeSize(MeshAttributeFormat format) {
+	switch (format) {
+		case MeshAttributeFormat::Float32x2:
+			return 8;
+
+		case MeshAttributeFormat::Float32x3:
+			return 12;
+
+		case MeshAttributeFormat::Snorm16x2:
+			return 4;
+
+		case MeshAttributeFormat::Snorm16x4:
+			return 8;
+
+		case MeshAttributeFormat::Float16x2:
+			return 4;
+	}
+
+	throw std::runtime_error("Unknown mesh attribute format");
+}
+
+// MARK: Reading
+MeshContainer::MeshContainer(std::filesystem::path const& path) : _file(path) {
+	std::string error = "Invalid mesh container " + path.string() + ": ";
+
+	if (_file.Size() < sizeof(MeshContainerHeader)) {
+		throw std::runtime_error(error + "too small");
+	}
+
+	std::memcpy(&_header, _file.Data(), sizeof(MeshContainerHeader));
+	if (_header.identifier != MeshContainerHeader::magic) {
+		throw std::runtime_error(error + "not a mesh container");
+	}
+
+	if (_header.version != MeshContainerHeader::currentVersion) {
+		throw std::runtime_error(error + "version " + std::to_string(_header.version) + " is not supported");
+	}
+
+	if ((_header.flags & ~MeshContainerHeader::quantizedFlag) != 0) {
+		throw std::runtime_error(error + "unknown flags");
+	}
+
+	if (_header.attributeCount == 0 || _header.attributeCount > maxAttributeCount) {
+		throw std::runtime_error(error + "invalid attribute count");
+	}
+
+	if (_header.vertexStride == 0 || _header.vertexStride > maxVertexStride || _header.vertexStride % 4 != 0) {
+		throw std::runtime_error(error + "invalid vertex stride");
+	}
+
+	if ((_header.indexSize != 2 && _header.indexSize != 4) || _header.indexCount % 3 != 0) {
+		throw std::runtime_error(error + "invalid indices");
+	}
+
+	uint64_t fileSize = _file.Size();
+	try {
+		CheckSection("attributes", sizeof(MeshContainerHeader), _header.attributeCount * sizeof(MeshContainerAttribute), fileSize);
+		CheckSection("vertices", _header.vertexOffset, VertexBytes(_header), fileSize);
+		CheckSection("indices", _header.indexOffset, IndexBytes(_header), fileSize);
+		CheckSection("parts", _header.partOffset, PartBytes(_header), fileSize);
+		CheckSection("meshlets", _header.meshletOffset, MeshletBytes(_header), fileSize);
+		CheckSection("meshlet vertices", _header.meshletVertexOffset, MeshletVertexBytes(_header), fileSize);
+		CheckSection("meshlet triangles", _header.meshletTriangleOffset, MeshletTriangleBytes(_header), fileSize);
+	}
+
+	catch (std::exception const& e) {
+		throw std::runtime_error(error + e.what());
+	}
+
+	_attributes.resize(_header.attributeCount);
+	std::memcpy(_attributes.data(), _file.Data() + sizeof(MeshContainerHeader), _attributes.size() * sizeof(MeshContainerAttribute));
+	for (MeshContainerAttribute const& attribute : _attributes) {
+		if (!IsKnownFormat(attribute.format) || static_cast<uint64_t>(attribute.offset) + GetAttributeSize(attribute.format) > _header.vertexStride) {
+			throw std::runtime_error(error + "invalid attribute at location " + std::to_string(attribute.location));
+		}
+	}
+
+	_parts.resize(_header.partCount);
+	std::memcpy(_parts.data(), _file.Data() + _header.partOffset, PartBytes(_header));
+	for (MeshContainerPart const& part : _parts) {
+		if (static_cast<uint64_t>(part.firstIndex) + part.indexCount > _header.indexCount) {
+			throw std::runtime_error(error + "part out of the indices");
+		}
+	}
+
+	for (uint32_t i = 0; i < _header.meshletCount; ++i) {
+		MeshContainerMeshlet meshlet = GetMeshlet(i);
+		if (static_cast<uint64_t>(meshlet.vertexOffset) + meshlet.vertexCount > _header.meshletVertexCount
+			|| static_cast<uint64_t>(meshlet.triangleOffset) + meshlet.triangleCount > _header.meshletTriangleCount) {
+			throw std::runtime_error(error + "meshlet " + std::to_string(i) + " out of its vertices or triangles");
+		}
+	}
+}
+
+std::vector<MeshContainerAttribute> const& MeshContainer::GetAttributes() const {
+	return _attributes;
+}
+
+uint32_t MeshContainer::GetVertexStride() const {
+	return _header.vertexStride;
+}
+
+uint32_t MeshContainer::GetVertexCount() const {
+	return _header.vertexCount;
+}
+
+uint32_t MeshContainer::GetIndexSize() const {
+	return _header.indexSize;
+}
+
+uint32_t MeshContainer::GetIndexCount() const {
+	return _header.indexCount;
+}
+
+bool MeshContainer::IsQuantized() const {
+	return (_header.flags & MeshContainerHeader::quantizedFlag) != 0;
+}
+
+Math::Matrix4x4 MeshContainer::GetDequantization() const {
+	return IsQuantized() ? GetDequantizationMatrix(GetBounds()) : Math::Matrix4x4::Identity();
+}
+
+Math::AABB MeshContainer::GetBounds() const {
+	return Math::AABB {
+		{ _header.boundsMin[0], _header.boundsMin[1], _header.boundsMin[2] },
+		{ _header.boundsMax[0], _header.boundsMax[1], _header.boundsMax[2] } };
+}
+
+uint8_t const* MeshContainer::GetVertexData() const {
+	return _file.Data() + _header.vertexOffset;
+}
+
+size_t MeshContainer::GetVertexDataSize() const {
+	return static_cast<size_t>(VertexBytes(_header));
+}
+
+uint8_t const* MeshContainer::GetIndexData() const {
+	return _file.Data() + _header.indexOffset;
+}
+
+size_t MeshContainer::GetIndexDataSize() const {
+	return static_cast<size_t>(IndexBytes(_header));
+}
+
+std::vector<MeshContainerPart> const& MeshContainer::GetParts() const {
+	return _parts;
+}
+
+uint32_t MeshContainer::GetMeshletCount() const {
+	return _header.meshletCount;
+}
+
+MeshContainerMeshlet MeshContainer::GetMeshlet(uint32_t meshlet) const {
+	MeshContainerMeshlet result {};
+	std::memcpy(&result, _file.Data() + _header.meshletOffset + static_cast<uint64_t>(meshlet) * sizeof(MeshContainerMeshlet), sizeof(MeshContainerMeshlet));
+	return result;
+}
+
+uint32_t MeshContainer::GetMeshletVertex(uint32_t index) const {
+	uint32_t vertex = 0;
+	std::memcpy(&vertex, _file.Data() + _header.meshletVertexOffset + static_cast<uint64_t>(index) * sizeof(uint32_t), sizeof(uint32_t));
+	return vertex;
+}
+
+uint8_t const* MeshContainer::GetMeshletTriangles() const {
+	return _file.Data() + _header.meshletTriangleOffset;
+}
+
+// MARK: Writing
+MeshContainerWriter::MeshContainerWriter(IndexedMesh const& mesh) : _attributes(FullPrecisionAttributes()) {
+	SetIndices(mesh, GetBounds(mesh), _header, _indices, _parts);
+	_header.vertexStride = sizeof(VertexAttributes);
+	_vertices = reinterpret_cast<uint8_t const*>(mesh.vertices.data());
+}
+
+MeshContainerWriter::MeshContainerWriter(QuantizedMesh const& mesh) : _attributes(QuantizedAttributes()) {
+	SetIndices(mesh, mesh.bounds, _header, _indices, _parts);
+	_header.flags = MeshContainerHeader::quantizedFlag;
+	_header.vertexStride = sizeof(QuantizedVertex);
+	_vertices = reinterpret_cast<uint8_t const*>(mesh.vertices.data());
+}
+
+void MeshContainerWriter::SetMeshlets(Meshlets const& meshlets) {
+	_meshlets.clear();
+	for (Meshlet const& meshlet : meshlets.meshlets) {
+		_meshlets.push_back(MeshContainerMeshlet {
+			meshlet.vertexOffset, meshlet.vertexCount, meshlet.triangleOffset, meshlet.triangleCount,
+			{ meshlet.bounds.min.x, meshlet.bounds.min.y, meshlet.bounds.min.z },
+			{ meshlet.bounds.max.x, meshlet.bounds.max.y, meshlet.bounds.max.z } });
+	}
+
+	_meshletVertices = meshlets.vertices;
+	_meshletTriangles = meshlets.triangles;
+}
+
+void MeshContainerWriter::Write(std::filesystem::path const& path) const {
+	MeshContainerHeader header = _header;
+	header.attributeCount = static_cast<uint32_t>(_attributes.size());
+	header.meshletCount = static_cast<uint32_t>(_meshlets.size());
+	header.meshletVertexCount = static_cast<uint32_t>(_meshletVertices.size());
+	header.meshletTriangleCount = static_cast<uint32_t>(_meshletTriangles.size() / 3);
+
+	// Each section after the previous one, aligned
+	uint64_t end = sizeof(MeshContainerHeader) + _attributes.size() * sizeof(MeshContainerAttribute);
+	auto place = [&end](uint64_t& offset, uint64_t size) {
+		offset = Align(end);
+		end = offset + size;
+	};
+
+	place(header.vertexOffset, VertexBytes(header));
+	place(header.indexOffset, IndexBytes(header));
+	place(header.partOffset, PartBytes(header));
+	place(header.meshletOffset, MeshletBytes(header));
+	place(header.meshletVertexOffset, MeshletVertexBytes(header));
+	place(header.meshletTriangleOffset, MeshletTriangleBytes(header));
+
+	// Written next to the file then moved into place, so that a failed write
+	// never leaves a truncated container behind
+	std::filesystem::path temporary = path;
+	temporary += ".tmp";
+	try {
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("Failed to open " + temporary.string());
+		}
+
+		file.write(reinterpret_cast<char const*>(&header), sizeof(MeshContainerHeader));
+		file.write(reinterpret_cast<char const*>(_attributes.data()), static_cast<std::streamsize>(_attributes.size() * sizeof(MeshContainerAttribute)));
+
+		// The padding up to the next section, or to the end of the vertices and
+		// indices, is made of zeroes
+		uint64_t position = sizeof(MeshContainerHeader) + _attributes.size() * sizeof(MeshContainerAttribute);
+		char const padding[sectionAlignment] {};
+		auto write = [&](uint64_t offset, void const* data, uint64_t size, uint64_t paddedSize) {
+			file.write(padding, static_cast<std::streamsize>(offset - position));
+			file.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+			file.write(padding, static_cast<std::streamsize>(paddedSize - size));
+			position = offset + paddedSize;
+		};
+
+		write(header.vertexOffset, _vertices, static_cast<uint64_t>(header.vertexCount) * header.vertexStride, VertexBytes(header));
+		write(header.indexOffset, _indices.data(), _indices.size(), IndexBytes(header));
+		write(header.partOffset, _parts.data(), PartBytes(header), PartBytes(header));
+		write(header.meshletOffset, _meshlets.data(), MeshletBytes(header), MeshletBytes(header));
+		write(header.meshletVertexOffset, _meshletVertices.data(), MeshletVertexBytes(header), MeshletVertexBytes(header));
+		write(header.meshletTriangleOffset, _meshletTriangles.data(), MeshletTriangleBytes(header), MeshletTriangleBytes(header));
+
+		file.flush();
+		file.close();
+		if (file.fail()) {
+			throw std::runtime_error("Failed to write " + path.string());
+		}
+
+		std::filesystem::rename(temporary, path);
+	}
+
+	catch (...) {
+		std::error_code error {};
+		std::filesystem::remove(temporary, error);
+		throw;
+	}
+}
@@ -0,0 +1,397 @@
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+
+#include <Resources/Geometry/MeshOptimizer.hpp>
+
+namespace {
+	constexpr uint32_t noVertex = std::numeric_limits<uint32_t>::max();
+
+	void CheckIndices(std::span<uint32_t const> indices, size_t vertexCount) {
+		if (indices.size() % 3 != 0) {
+			throw std::runtime_error("Indices of a triangle list: " + std::to_string(indices.size()) + " is not a multiple of 3");
+		}
+
+		for (uint32_t index : indices) {
+			if (index >= vertexCount) {
+				throw std::runtime_error("Index " + std::to_string(index) + " out of " + std::to_string(vertexCount) + " vertices");
+			}
+		}
+	}
+
+	// FIFO cache simulated with the time of the miss that inserted each vertex:
+	// a vertex is in the cache while less than cacheSize misses followed it
+	class VertexCache {
+	public:
+		VertexCache(size_t vertexCount, uint32_t cacheSize) : _insertions(vertexCount, 0), _size(cacheSize), _time(cacheSize + 1) {}
+
+		bool Contains(uint32_t vertex) const {
+			return _time - _insertions[vertex] <= _size;
+		}
+
+		// Whether the vertex missed
+		bool Use(uint32_t vertex) {
+			if (Contains(vertex)) {
+				return false;
+			}
+
+			_insertions[vertex] = _time++;
+			return true;
+		}
+
+		uint32_t Misses(uint32_t const* triangle) {
+			return Use(triangle[0]) + Use(triangle[1]) + Use(triangle[2]);
+		}
+
+		// Misses since the vertex was inserted
+		uint32_t Age(uint32_t vertex) const {
+			return _time - _insertions[vertex];
+		}
+
+		void Flush() {
+			_time += _size + 1;
+		}
+
+	private:
+		std::vector<uint32_t> _insertions {};
+		uint32_t _size = 0;
+		uint32_t _time = 0;
+	};
+}
+
+// MARK: Analysis
+VertexCacheStatistics AnalyzeVertexCache(std::span<uint32_t const> indices, size_t vertexCount, uint32_t cacheSize) {
+	CheckIndices(indices, vertexCount);
+
+	VertexCacheStatistics statistics {};
+	VertexCache cache(vertexCount, cacheSize);
+	std::vector<uint8_t> used(vertexCount, 0);
+	size_t usedCount = 0;
+	for (size_t i = 0; i < indices.size(); i += 3) {
+		statistics.misses += cache.Misses(&indices[i]);
+		for (size_t corner = i; corner < i + 3; ++corner) {
+			usedCount += used[indices[corner]] == 0 ? 1 : 0;
+			used[indices[corner]] = 1;
+		}
+	}
+
+	if (!indices.empty()) {
+		statistics.acmr = static_cast<float>(statistics.misses) / static_cast<float>(indices.size() / 3);
+		statistics.atvr = static_cast<float>(statistics.misses) / static_cast<float>(usedCount);
+	}
+
+	return statistics;
+}
+
+// MARK: Vertex cache
+void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount, uint32_t cacheSize) {
+	CheckIndices(indices, vertexCount);
+	if (indices.empty()) {
+		return;
+	}
+
+	size_t triangleCount = indices.size() / 3;
+
+	// Triangles of each vertex, live ones being the triangles not emitted yet
+	std::vector<uint32_t> offsets(vertexCount + 1, 0);
+	for (uint32_t index : indices) {
+		++offsets[index + 1];
+	}
+
+	std::vector<uint32_t> live(vertexCount, 0);
+	for (size_t v = 0; v < vertexCount; ++v) {
+		live[v] = offsets[v + 1];
+		offsets[v + 1] += offsets[v];
+	}
+
+	std::vector<uint32_t> adjacency(indices.size());
+	std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (size_t i = 0; i < indices.size(); ++i) {
+		adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+	}
+
+	std::vector<uint32_t> output {};
+	output.reserve(indices.size());
+	std::vector<uint8_t> emitted(triangleCount, 0);
+	std::vector<uint32_t> deadEnd {};
+	std::vector<uint32_t> candidates {};
+	VertexCache cache(vertexCount, cacheSize);
+
+	size_t cursor = 0;
+	uint32_t fanning = indices[0];
+	while (fanning != noVertex) {
+		candidates.clear();
+		for (uint32_t a = offsets[fanning]; a < offsets[fanning + 1]; ++a) {
+			uint32_t triangle = adjacency[a];
+			if (emitted[triangle] != 0) {
+				continue;
+			}
+
+			for (size_t corner = 3 * triangle; corner < 3 * triangle + 3; ++corner) {
+				uint32_t vertex = indices[corner];
+				output.push_back(vertex);
+				deadEnd.push_back(vertex);
+				candidates.push_back(vertex);
+				--live[vertex];
+				cache.Use(vertex);
+			}
+
+			emitted[triangle] = 1;
+		}
+
+		// The oldest candidate still in the cache after its own fan, any
+		// candidate with triangles left otherwise
+		fanning = noVertex;
+		int64_t bestPriority = -1;
+		for (uint32_t vertex : candidates) {
+			if (live[vertex] == 0) {
+				continue;
+			}
+
+			int64_t priority = 0;
+			if (cache.Age(vertex) + 2 * live[vertex] <= cacheSize) {
+				priority = cache.Age(vertex);
+			}
+
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				fanning = vertex;
+			}
+		}
+
+		// Dead end: the last vertices emitted, then the next one in the buffer
+		while (fanning == noVertex && !deadEnd.empty()) {
+			uint32_t vertex = deadEnd.back();
+			deadEnd.pop_back();
+			fanning = live[vertex] != 0 ? vertex : noVertex;
+		}
+
+		while (fanning == noVertex && cursor < vertexCount) {
+			fanning = live[cursor] != 0 ? static_cast<uint32_t>(cursor) : noVertex;
+			++cursor;
+		}
+	}
+
+	std::copy(output.begin(), output.end(), indices.begin());
+}
+
+// MARK: Overdraw
+void OptimizeOverdraw(std::span<uint32_t> indices, std::vector<VertexAttributes> const& vertices, uint32_t cacheSize, float threshold) {
+	CheckIndices(indices, vertices.size());
+
+	size_t triangleCount = indices.size() / 3;
+	if (triangleCount < 2) {
+		return;
+	}
+
+	// Hard boundaries where the cache starts cold, a triangle missing all of
+	// its vertices
+	std::vector<size_t> hardBoundaries { 0 };
+	VertexCache cache(vertices.size(), cacheSize);
+	for (size_t t = 0; t < triangleCount; ++t) {
+		if (cache.Misses(&indices[3 * t]) == 3 && t != 0) {
+			hardBoundaries.push_back(t);
+		}
+	}
+
+	hardBoundaries.push_back(triangleCount);
+
+	// Soft boundaries inside of them, once the misses of a cluster come down
+	// to threshold times those of its hard cluster
+	std::vector<size_t> boundaries {};
+	for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+		size_t begin = hardBoundaries[h];
+		size_t end = hardBoundaries[h + 1];
+
+		cache.Flush();
+		uint32_t hardMisses = 0;
+		for (size_t t = begin; t < end; ++t) {
+			hardMisses += cache.Misses(&indices[3 * t]);
+		}
+
+		float limit = threshold * static_cast<float>(hardMisses) / static_cast<float>(end - begin);
+
+		cache.Flush();
+		size_t clusterBegin = begin;
+		uint32_t misses = 0;
+		boundaries.push_back(begin);
+		for (size_t t = begin; t < end; ++t) {
+			misses += cache.Misses(&indices[3 * t]);
+			if (t + 1 < end && static_cast<float>(misses) <= limit * static_cast<float>(t + 1 - clusterBegin)) {
+				boundaries.push_back(t + 1);
+				clusterBegin = t + 1;
+				misses = 0;
+				cache.Flush();
+			}
+		}
+	}
+
+	boundaries.push_back(triangleCount);
+
+	// Area weighted centroid and normal of each cluster and of the mesh
+	struct Cluster {
+	public:
+		size_t begin = 0;
+		size_t end = 0;
+		Math::Vector3 centroid {};
+		Math::Vector3 normal {};
+		float area = 0.0f;
+		float key = 0.0f;
+	};
+
+	std::vector<Cluster> clusters(boundaries.size() - 1);
+	Math::Vector3 meshCentroid {};
+	float meshArea = 0.0f;
+	for (size_t c = 0; c < clusters.size(); ++c) {
+		Cluster& cluster = clusters[c];
+		cluster.begin = boundaries[c];
+		cluster.end = boundaries[c + 1];
+		for (size_t t = cluster.begin; t < cluster.end; ++t) {
+			Math::Vector3 const& a = vertices[indices[3 * t + 0]].position;
+			Math::Vector3 const& b = vertices[indices[3 * t + 1]].position;
+			Math::Vector3 const& p = vertices[indices[3 * t + 2]].position;
+
+			Math::Vector3 cross = Math::Vector3::Cross(b - a, p - a);
+			float area = Math::Vector3::Magnitude(cross);
+			cluster.centroid += (a + b + p) * (area / 3.0f);
+			cluster.normal += cross;
+			cluster.area += area;
+		}
+
+		meshCentroid += cluster.centroid;
+		meshArea += cluster.area;
+		if (cluster.area > 0.0f) {
+			cluster.centroid /= cluster.area;
+		}
+	}
+
+	if (meshArea > 0.0f) {
+		meshCentroid /= meshArea;
+	}
+
+	for (Cluster& cluster : clusters) {
+		float length = Math::Vector3::Magnitude(cluster.normal);
+		cluster.key = length > 0.0f ? Math::Vector3::Dot(cluster.centroid - meshCentroid, cluster.normal) / length : 0.0f;
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(), [](Cluster const& lhs, Cluster const& rhs) {
+		return lhs.key > rhs.key;
+	});
+
+	std::vector<uint32_t> output {};
+	output.reserve(indices.size());
+	for (Cluster const& cluster : clusters) {
+		output.insert(output.end(), indices.begin() + 3 * cluster.begin, indices.begin() + 3 * cluster.end);
+	}
+
+	std::copy(output.begin(), output.end(), indices.begin());
+}
+
+// MARK: Vertex fetch
+void OptimizeVertexFetch(IndexedMesh& mesh) {
+	CheckIndices(mesh.indices, mesh.vertices.size());
+
+	std::vector<uint32_t> remap(mesh.vertices.size(), noVertex);
+	std::vector<VertexAttributes> vertices {};
+	vertices.reserve(mesh.vertices.size());
+	for (uint32_t& index : mesh.indices) {
+		if (remap[index] == noVertex) {
+			remap[index] = static_cast<uint32_t>(vertices.size());
+			vertices.push_back(mesh.vertices[index]);
+		}
+
+		index = remap[index];
+	}
+
+	mesh.vertices = std::move(vertices);
+}
+
+void OptimizeMesh(IndexedMesh& mesh, uint32_t cacheSize) {
+	CheckIndices(mesh.indices, mesh.vertices.size());
+
+	std::span<uint32_t> indices(mesh.indices);
+	if (mesh.parts.empty()) {
+		OptimizeVertexCache(indices, mesh.vertices.size(), cacheSize);
+		OptimizeOverdraw(indices, mesh.vertices, cacheSize);
+	}
+
+	for (MeshPart const& part : mesh.parts) {
+		if (static_cast<size_t>(part.firstIndex) + part.indexCount > mesh.indices.size()) {
+			throw std::runtime_error("Part " + part.name + " out of the indices of its mesh");
+		}
+
+		std::span<uint32_t> partIndices = indices.subspan(part.firstIndex, part.indexCount);
+		OptimizeVertexCache(partIndices, mesh.vertices.size(), cacheSize);
+		OptimizeOverdraw(partIndices, mesh.vertices, cacheSize);
+	}
+
+	OptimizeVertexFetch(mesh);
+}
+
+// MARK: Meshlets
+Meshlets BuildMeshlets(IndexedMesh const& mesh, uint32_t maxVertices, uint32_t maxTriangles) {
+	CheckIndices(mesh.indices, mesh.vertices.size());
+	if (maxVertices < 3 || maxVertices > 256 || maxTriangles == 0) {
+		throw std::runtime_error("Meshlets need 3 to 256 vertices and a triangle at least");
+	}
+
+	Meshlets meshlets {};
+	meshlets.vertices.reserve(mesh.vertices.size());
+	meshlets.triangles.reserve(mesh.indices.size());
+
+	// Index of each vertex in the current meshlet
+	std::vector<uint32_t> local(mesh.vertices.size(), noVertex);
+	Meshlet current {};
+
+	auto finish = [&]() {
+		if (current.triangleCount == 0) {
+			return;
+		}
+
+		Math::Vector3 first = mesh.vertices[meshlets.vertices[current.vertexOffset]].position;
+		current.bounds = { first, first };
+		for (uint32_t i = current.vertexOffset; i < current.vertexOffset + current.vertexCount; ++i) {
+			uint32_t vertex = meshlets.vertices[i];
+			for (size_t axis = 0; axis < 3; ++axis) {
+				current.bounds.min[axis] = std::min(current.bounds.min[axis], mesh.vertices[vertex].position[axis]);
+				current.bounds.max[axis] = std::max(current.bounds.max[axis], mesh.vertices[vertex].position[axis]);
+			}
+
+			local[vertex] = noVertex;
+		}
+
+		meshlets.meshlets.push_back(current);
+		current = Meshlet {};
+		current.vertexOffset = static_cast<uint32_t>(meshlets.vertices.size());
+		current.triangleOffset = static_cast<uint32_t>(meshlets.triangles.size() / 3);
+	};
+
+	for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+		uint32_t newVertices = 0;
+		for (size_t corner = i; corner < i + 3; ++corner) {
+			newVertices += local[mesh.indices[corner]] == noVertex ? 1 : 0;
+		}
+
+		// Repeated corners of degenerate triangles are counted twice, which
+		// only ends a meshlet early
+		if (current.vertexCount + newVertices > maxVertices || current.triangleCount == maxTriangles) {
+			finish();
+		}
+
+		for (size_t corner = i; corner < i + 3; ++corner) {
+			uint32_t vertex = mesh.indices[corner];
+			if (local[vertex] == noVertex) {
+				local[vertex] = current.vertexCount++;
+				meshlets.vertices.push_back(vertex);
+			}
+
+			meshlets.triangles.push_back(static_cast<uint8_t>(local[vertex]));
+		}
+
+		++current.triangleCount;
+	}
+
+	finish();
+	return meshlets;
+}
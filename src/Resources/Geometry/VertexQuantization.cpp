@@ -0,0 +1,109 @@
+#include <cmath>
+#include <algorithm>
+
+#include <Resources/Geometry/VertexQuantization.hpp>
+
+namespace {
+	float SignNotZero(float value) {
+		return value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	// Half of the size of the box on each axis, 1 on flat axes so that they
+	// still divide
+	Math::Vector3 QuantizationExtents(Math::AABB const& bounds) {
+		Math::Vector3 extents = bounds.Extents();
+		for (size_t i = 0; i < 3; ++i) {
+			extents[i] = extents[i] > 0.0f ? extents[i] : 1.0f;
+		}
+
+		return extents;
+	}
+}
+
+// MARK: Encodings
+int16_t EncodeSnorm16(float value) {
+	return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+float DecodeSnorm16(int16_t value) {
+	return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+}
+
+Math::Vector2 EncodeOctahedral(Math::Vector3 const& normal) {
+	float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+	if (sum == 0.0f) {
+		return Math::Vector2 {};
+	}
+
+	Math::Vector2 encoded(normal.x / sum, normal.y / sum);
+	if (normal.z < 0.0f) {
+		encoded = Math::Vector2(
+			(1.0f - std::abs(encoded.y)) * SignNotZero(encoded.x),
+			(1.0f - std::abs(encoded.x)) * SignNotZero(encoded.y));
+	}
+
+	return encoded;
+}
+
+Math::Vector3 DecodeOctahedral(Math::Vector2 const& encoded) {
+	Math::Vector3 normal(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+	float fold = std::max(-normal.z, 0.0f);
+	normal.x += normal.x >= 0.0f ? -fold : fold;
+	normal.y += normal.y >= 0.0f ? -fold : fold;
+
+	return Math::Vector3::Normalize(normal);
+}
+
+// MARK: Vertices
+QuantizedVertex QuantizeVertex(VertexAttributes const& vertex, Math::AABB const& bounds) {
+	Math::Vector3 center = bounds.Center();
+	Math::Vector3 extents = QuantizationExtents(bounds);
+
+	QuantizedVertex quantized {};
+	for (size_t i = 0; i < 3; ++i) {
+		quantized.position[i] = EncodeSnorm16((vertex.position[i] - center[i]) / extents[i]);
+	}
+
+	quantized.position[3] = 32767;
+
+	Math::Vector2 normal = EncodeOctahedral(vertex.normal);
+	quantized.normal = { EncodeSnorm16(normal.x), EncodeSnorm16(normal.y) };
+	quantized.uv = Math::Vector2h(vertex.uv);
+	return quantized;
+}
+
+VertexAttributes DequantizeVertex(QuantizedVertex const& vertex, Math::AABB const& bounds) {
+	Math::Vector3 center = bounds.Center();
+	Math::Vector3 extents = QuantizationExtents(bounds);
+
+	VertexAttributes attributes {};
+	for (size_t i = 0; i < 3; ++i) {
+		attributes.position[i] = center[i] + extents[i] * DecodeSnorm16(vertex.position[i]);
+	}
+
+	attributes.normal = DecodeOctahedral(Math::Vector2(DecodeSnorm16(vertex.normal[0]), DecodeSnorm16(vertex.normal[1])));
+	attributes.uv = Math::Vector2(vertex.uv);
+	return attributes;
+}
+
+// MARK: Meshes
+QuantizedMesh QuantizeMesh(IndexedMesh const& mesh) {
+	QuantizedMesh quantized {};
+	quantized.indices = mesh.indices;
+	quantized.parts = mesh.parts;
+	quantized.bounds = GetBounds(mesh);
+	quantized.dequantization = GetDequantizationMatrix(quantized.bounds);
+
+	quantized.vertices.reserve(mesh.vertices.size());
+	for (VertexAttributes const& vertex : mesh.vertices) {
+		quantized.vertices.push_back(QuantizeVertex(vertex, quantized.bounds));
+	}
+
+	return quantized;
+}
+
+Math::Matrix4x4 GetDequantizationMatrix(Math::AABB const& bounds) {
+	Math::Vector3 center = bounds.Center();
+	Math::Vector3 extents = QuantizationExtents(bounds);
+	return Math::Matrix4x4::Translate(center.x, center.y, center.z) * Math::Matrix4x4::Scale(extents.x, extents.y, extents.z);
+}
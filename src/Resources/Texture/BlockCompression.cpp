@@ -0,0 +1,751 @@
+#include <array>
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
+#include <Math/Simd.hpp>
+#include <Math/Parallel.hpp>
+
+#include <Resources/Texture/BlockCompression.hpp>
+
+namespace {
+	// Below this block count, starting threads costs more than it saves
+	constexpr size_t minParallelBlocks = 64 * 64;
+
+	// Weights of the second endpoint for the 16 levels of BC7, in 64ths
+	constexpr std::array<uint32_t, 16> bc7Weights { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	// The 16 pixels of a block, channel by channel, so that 4 pixels fit in a register
+	struct Block {
+	public:
+		alignas(16) float channels[4][16];
+	};
+
+	using Palette = float[16][4];
+
+	void LoadBlock(uint8_t const* source, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, Block& block) {
+		for (uint32_t j = 0; j < 4; ++j) {
+			uint32_t y = std::min(4 * blockY + j, height - 1);
+			for (uint32_t i = 0; i < 4; ++i) {
+				uint32_t x = std::min(4 * blockX + i, width - 1);
+				uint8_t const* pixel = source + 4 * (static_cast<size_t>(y) * width + x);
+				for (uint32_t channel = 0; channel < 4; ++channel) {
+					block.channels[channel][4 * j + i] = pixel[channel];
+				}
+			}
+		}
+	}
+
+	// The pixels of the block inside the image
+	void StoreBlock(uint8_t const (*pixels)[4], uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* destination) {
+		for (uint32_t j = 0; j < 4 && 4 * blockY + j < height; ++j) {
+			for (uint32_t i = 0; i < 4 && 4 * blockX + i < width; ++i) {
+				size_t pixel = static_cast<size_t>(4 * blockY + j) * width + 4 * blockX + i;
+				std::memcpy(destination + 4 * pixel, pixels[4 * j + i], 4);
+			}
+		}
+	}
+
+	// MARK: Fitting
+	// Index of the nearest entry of palette for each pixel, over channelCount
+	// channels from firstChannel. Returns the sum of the squared distances.
+	float NearestIndices(Block const& block, Palette const& palette, uint32_t paletteSize, uint32_t firstChannel, uint32_t channelCount, uint8_t* indices) {
+		float error = 0.0f;
+
+#if defined(MATH_SIMD_SSE)
+		for (uint32_t pixel = 0; pixel < 16; pixel += 4) {
+			__m128 values[4] {};
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				values[channel] = _mm_load_ps(block.channels[firstChannel + channel] + pixel);
+			}
+
+			__m128 best = _mm_set1_ps(std::numeric_limits<float>::max());
+			__m128 bestIndex = _mm_setzero_ps();
+			for (uint32_t k = 0; k < paletteSize; ++k) {
+				__m128 distance = _mm_setzero_ps();
+				for (uint32_t channel = 0; channel < channelCount; ++channel) {
+					__m128 delta = _mm_sub_ps(values[channel], _mm_set1_ps(palette[k][firstChannel + channel]));
+					distance = _mm_add_ps(distance, _mm_mul_ps(delta, delta));
+				}
+
+				__m128 closer = _mm_cmplt_ps(distance, best);
+				best = _mm_min_ps(distance, best);
+				bestIndex = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps(static_cast<float>(k))), _mm_andnot_ps(closer, bestIndex));
+			}
+
+			float distances[4] {};
+			float found[4] {};
+			_mm_storeu_ps(distances, best);
+			_mm_storeu_ps(found, bestIndex);
+			for (uint32_t i = 0; i < 4; ++i) {
+				indices[pixel + i] = static_cast<uint8_t>(found[i]);
+				error += distances[i];
+			}
+		}
+#elif defined(MATH_SIMD_NEON)
+		for (uint32_t pixel = 0; pixel < 16; pixel += 4) {
+			float32x4_t values[4] {};
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				values[channel] = vld1q_f32(block.channels[firstChannel + channel] + pixel);
+			}
+
+			float32x4_t best = vdupq_n_f32(std::numeric_limits<float>::max());
+			float32x4_t bestIndex = vdupq_n_f32(0.0f);
+			for (uint32_t k = 0; k < paletteSize; ++k) {
+				float32x4_t distance = vdupq_n_f32(0.0f);
+				for (uint32_t channel = 0; channel < channelCount; ++channel) {
+					float32x4_t delta = vsubq_f32(values[channel], vdupq_n_f32(palette[k][firstChannel + channel]));
+					distance = vaddq_f32(distance, vmulq_f32(delta, delta));
+				}
+
+				uint32x4_t closer = vcltq_f32(distance, best);
+				best = vbslq_f32(closer, distance, best);
+				bestIndex = vbslq_f32(closer, vdupq_n_f32(static_cast<float>(k)), bestIndex);
+			}
+
+			float distances[4] {};
+			float found[4] {};
+			vst1q_f32(distances, best);
+			vst1q_f32(found, bestIndex);
+			for (uint32_t i = 0; i < 4; ++i) {
+				indices[pixel + i] = static_cast<uint8_t>(found[i]);
+				error += distances[i];
+			}
+		}
+#else
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			float best = std::numeric_limits<float>::max();
+			uint8_t bestIndex = 0;
+			for (uint32_t k = 0; k < paletteSize; ++k) {
+				float distance = 0.0f;
+				for (uint32_t channel = firstChannel; channel < firstChannel + channelCount; ++channel) {
+					float delta = block.channels[channel][pixel] - palette[k][channel];
+					distance += delta * delta;
+				}
+
+				if (distance < best) {
+					best = distance;
+					bestIndex = static_cast<uint8_t>(k);
+				}
+			}
+
+			indices[pixel] = bestIndex;
+			error += best;
+		}
+#endif
+
+		return error;
+	}
+
+	// Mean of the first channelCount channels, and the unit direction along
+	// which they vary the most, by power iteration on their covariance. The
+	// direction is null when every pixel is the same.
+	void PrincipalAxis(Block const& block, uint32_t channelCount, float* mean, float* axis) {
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			float sum = 0.0f;
+			for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+				sum += block.channels[channel][pixel];
+			}
+
+			mean[channel] = sum / 16.0f;
+		}
+
+		float covariance[4][4] {};
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			float delta[4] {};
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				delta[channel] = block.channels[channel][pixel] - mean[channel];
+			}
+
+			for (uint32_t a = 0; a < channelCount; ++a) {
+				for (uint32_t b = 0; b < channelCount; ++b) {
+					covariance[a][b] += delta[a] * delta[b];
+				}
+			}
+		}
+
+		// Starting from the channel that varies the most avoids starting
+		// orthogonal to the axis
+		uint32_t largest = 0;
+		for (uint32_t channel = 1; channel < channelCount; ++channel) {
+			if (covariance[channel][channel] > covariance[largest][largest]) {
+				largest = channel;
+			}
+		}
+
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			axis[channel] = covariance[largest][channel];
+		}
+
+		for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+			float next[4] {};
+			float scale = 0.0f;
+			for (uint32_t a = 0; a < channelCount; ++a) {
+				for (uint32_t b = 0; b < channelCount; ++b) {
+					next[a] += covariance[a][b] * axis[b];
+				}
+
+				scale = std::max(scale, std::abs(next[a]));
+			}
+
+			if (scale == 0.0f) {
+				break;
+			}
+
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				axis[channel] = next[channel] / scale;
+			}
+		}
+
+		float length = 0.0f;
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			length += axis[channel] * axis[channel];
+		}
+
+		length = std::sqrt(length);
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			axis[channel] = length > 1.0e-6f ? axis[channel] / length : 0.0f;
+		}
+	}
+
+	// The extreme projections of the pixels on the axis
+	void AxisEndpoints(Block const& block, uint32_t channelCount, float const* mean, float const* axis, float* low, float* high) {
+		float minimum = 0.0f;
+		float maximum = 0.0f;
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			float projection = 0.0f;
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				projection += (block.channels[channel][pixel] - mean[channel]) * axis[channel];
+			}
+
+			minimum = std::min(minimum, projection);
+			maximum = std::max(maximum, projection);
+		}
+
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			low[channel] = std::clamp(mean[channel] + minimum * axis[channel], 0.0f, 255.0f);
+			high[channel] = std::clamp(mean[channel] + maximum * axis[channel], 0.0f, 255.0f);
+		}
+	}
+
+	// Endpoints minimizing the squared error of the pixels once each one is
+	// replaced by (1 - t) * first + t * second, t being given by its index.
+	// Returns false when the indices do not constrain both endpoints.
+	bool FitEndpoints(Block const& block, uint32_t channelCount, uint8_t const* indices, float const* weights, float* first, float* second) {
+		float a = 0.0f;
+		float b = 0.0f;
+		float c = 0.0f;
+		float x[4] {};
+		float y[4] {};
+
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			float t = weights[indices[pixel]];
+			a += (1.0f - t) * (1.0f - t);
+			b += t * (1.0f - t);
+			c += t * t;
+
+			for (uint32_t channel = 0; channel < channelCount; ++channel) {
+				x[channel] += (1.0f - t) * block.channels[channel][pixel];
+				y[channel] += t * block.channels[channel][pixel];
+			}
+		}
+
+		float determinant = a * c - b * b;
+		if (std::abs(determinant) < 1.0e-6f) {
+			return false;
+		}
+
+		for (uint32_t channel = 0; channel < channelCount; ++channel) {
+			first[channel] = std::clamp((c * x[channel] - b * y[channel]) / determinant, 0.0f, 255.0f);
+			second[channel] = std::clamp((a * y[channel] - b * x[channel]) / determinant, 0.0f, 255.0f);
+		}
+
+		return true;
+	}
+
+	// MARK: BC1 and BC3
+	// Weights of the second color for the indices of the 4 color mode
+	constexpr float colorWeights[4] { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+	uint16_t Pack565(float const* color) {
+		uint32_t r = static_cast<uint32_t>(std::lround(color[0] * 31.0f / 255.0f));
+		uint32_t g = static_cast<uint32_t>(std::lround(color[1] * 63.0f / 255.0f));
+		uint32_t b = static_cast<uint32_t>(std::lround(color[2] * 31.0f / 255.0f));
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	// The 4 colors of a BC1 block. With fourColors unset, the 3 color mode is
+	// used when color0 <= color1, the last entry being transparent black.
+	void ColorPalette(uint16_t color0, uint16_t color1, bool fourColors, uint8_t (*palette)[4]) {
+		for (uint32_t k = 0; k < 2; ++k) {
+			uint32_t color = k == 0 ? color0 : color1;
+			uint32_t r = color >> 11;
+			uint32_t g = (color >> 5) & 63;
+			uint32_t b = color & 31;
+			palette[k][0] = static_cast<uint8_t>((r << 3) | (r >> 2));
+			palette[k][1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+			palette[k][2] = static_cast<uint8_t>((b << 3) | (b >> 2));
+			palette[k][3] = 255;
+		}
+
+		for (uint32_t channel = 0; channel < 3; ++channel) {
+			uint32_t c0 = palette[0][channel];
+			uint32_t c1 = palette[1][channel];
+			if (fourColors || color0 > color1) {
+				palette[2][channel] = static_cast<uint8_t>((2 * c0 + c1 + 1) / 3);
+				palette[3][channel] = static_cast<uint8_t>((c0 + 2 * c1 + 1) / 3);
+			}
+
+			else {
+				palette[2][channel] = static_cast<uint8_t>((c0 + c1 + 1) / 2);
+				palette[3][channel] = 0;
+			}
+		}
+
+		palette[2][3] = 255;
+		palette[3][3] = fourColors || color0 > color1 ? 255 : 0;
+	}
+
+	float ColorIndices(Block const& block, uint16_t color0, uint16_t color1, uint8_t* indices) {
+		uint8_t colors[4][4] {};
+		ColorPalette(color0, color1, true, colors);
+
+		Palette palette {};
+		for (uint32_t k = 0; k < 4; ++k) {
+			for (uint32_t channel = 0; channel < 4; ++channel) {
+				palette[k][channel] = colors[k][channel];
+			}
+		}
+
+		return NearestIndices(block, palette, 4, 0, 3, indices);
+	}
+
+	// 8 bytes of colors in the 4 color mode, alpha being ignored
+	void EncodeColors(Block const& block, uint8_t* destination) {
+		float mean[4] {};
+		float axis[4] {};
+		float low[4] {};
+		float high[4] {};
+		PrincipalAxis(block, 3, mean, axis);
+		AxisEndpoints(block, 3, mean, axis, low, high);
+
+		uint16_t color0 = Pack565(high);
+		uint16_t color1 = Pack565(low);
+		uint8_t indices[16] {};
+		float error = ColorIndices(block, color0, color1, indices);
+
+		float first[4] {};
+		float second[4] {};
+		if (error > 0.0f && FitEndpoints(block, 3, indices, colorWeights, first, second)) {
+			uint16_t refined0 = Pack565(first);
+			uint16_t refined1 = Pack565(second);
+			uint8_t refinedIndices[16] {};
+			if (ColorIndices(block, refined0, refined1, refinedIndices) < error) {
+				color0 = refined0;
+				color1 = refined1;
+				std::memcpy(indices, refinedIndices, 16);
+			}
+		}
+
+		// The 4 color mode needs color0 > color1: swapping the colors swaps
+		// the indices 0 and 1, and 2 and 3
+		if (color0 < color1) {
+			std::swap(color0, color1);
+			for (uint8_t& index : indices) {
+				index ^= 1;
+			}
+		}
+
+		if (color0 == color1) {
+			std::fill(std::begin(indices), std::end(indices), uint8_t(0));
+		}
+
+		uint32_t bits = 0;
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			bits |= static_cast<uint32_t>(indices[pixel]) << (2 * pixel);
+		}
+
+		destination[0] = static_cast<uint8_t>(color0);
+		destination[1] = static_cast<uint8_t>(color0 >> 8);
+		destination[2] = static_cast<uint8_t>(color1);
+		destination[3] = static_cast<uint8_t>(color1 >> 8);
+		for (uint32_t i = 0; i < 4; ++i) {
+			destination[4 + i] = static_cast<uint8_t>(bits >> (8 * i));
+		}
+	}
+
+	void DecodeColors(uint8_t const* source, bool fourColors, uint8_t (*pixels)[4]) {
+		uint16_t color0 = static_cast<uint16_t>(source[0] | (source[1] << 8));
+		uint16_t color1 = static_cast<uint16_t>(source[2] | (source[3] << 8));
+		uint8_t palette[4][4] {};
+		ColorPalette(color0, color1, fourColors, palette);
+
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			uint32_t index = (source[4 + pixel / 4] >> (2 * (pixel % 4))) & 3;
+			std::memcpy(pixels[pixel], palette[index], 4);
+		}
+	}
+
+	// The 8 alphas of a BC3 block, the 8 alpha mode being used when alpha0 > alpha1
+	void AlphaPalette(uint32_t alpha0, uint32_t alpha1, uint8_t* palette) {
+		palette[0] = static_cast<uint8_t>(alpha0);
+		palette[1] = static_cast<uint8_t>(alpha1);
+		if (alpha0 > alpha1) {
+			for (uint32_t k = 2; k < 8; ++k) {
+				palette[k] = static_cast<uint8_t>(((8 - k) * alpha0 + (k - 1) * alpha1 + 3) / 7);
+			}
+		}
+
+		else {
+			for (uint32_t k = 2; k < 6; ++k) {
+				palette[k] = static_cast<uint8_t>(((6 - k) * alpha0 + (k - 1) * alpha1 + 2) / 5);
+			}
+
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+	}
+
+	// 8 bytes of alpha in the 8 alpha mode, between the extremes of the block
+	void EncodeAlpha(Block const& block, uint8_t* destination) {
+		float const* alphas = block.channels[3];
+		uint32_t alpha0 = static_cast<uint32_t>(*std::max_element(alphas, alphas + 16));
+		uint32_t alpha1 = static_cast<uint32_t>(*std::min_element(alphas, alphas + 16));
+
+		uint8_t indices[16] {};
+		if (alpha0 != alpha1) {
+			uint8_t alphaPalette[8] {};
+			AlphaPalette(alpha0, alpha1, alphaPalette);
+
+			Palette palette {};
+			for (uint32_t k = 0; k < 8; ++k) {
+				palette[k][3] = alphaPalette[k];
+			}
+
+			NearestIndices(block, palette, 8, 3, 1, indices);
+		}
+
+		uint64_t bits = 0;
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			bits |= static_cast<uint64_t>(indices[pixel]) << (3 * pixel);
+		}
+
+		destination[0] = static_cast<uint8_t>(alpha0);
+		destination[1] = static_cast<uint8_t>(alpha1);
+		for (uint32_t i = 0; i < 6; ++i) {
+			destination[2 + i] = static_cast<uint8_t>(bits >> (8 * i));
+		}
+	}
+
+	void DecodeAlpha(uint8_t const* source, uint8_t (*pixels)[4]) {
+		uint8_t palette[8] {};
+		AlphaPalette(source[0], source[1], palette);
+
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < 6; ++i) {
+			bits |= static_cast<uint64_t>(source[2 + i]) << (8 * i);
+		}
+
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			pixels[pixel][3] = palette[(bits >> (3 * pixel)) & 7];
+		}
+	}
+
+	// MARK: BC7
+	// Bits of a block, from the lowest bit of the first byte
+	struct BitWriter {
+	public:
+		uint8_t* data = nullptr;
+		uint32_t position = 0;
+
+		void Write(uint32_t value, uint32_t bitCount) {
+			for (uint32_t bit = 0; bit < bitCount; ++bit, ++position) {
+				data[position / 8] |= static_cast<uint8_t>(((value >> bit) & 1) << (position % 8));
+			}
+		}
+	};
+
+	struct BitReader {
+	public:
+		uint8_t const* data = nullptr;
+		uint32_t position = 0;
+
+		uint32_t Read(uint32_t bitCount) {
+			uint32_t value = 0;
+			for (uint32_t bit = 0; bit < bitCount; ++bit, ++position) {
+				value |= static_cast<uint32_t>((data[position / 8] >> (position % 8)) & 1) << bit;
+			}
+
+			return value;
+		}
+	};
+
+	// Endpoints of mode 6: 7 bits per channel, and a lowest bit shared by the channels
+	struct Bc7Endpoint {
+	public:
+		uint8_t values[4] {}; // With the shared bit
+	};
+
+	Bc7Endpoint QuantizeBc7(float const* color, uint32_t sharedBit) {
+		Bc7Endpoint endpoint {};
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			long quantized = std::clamp(std::lround((color[channel] - static_cast<float>(sharedBit)) / 2.0f), 0L, 127L);
+			endpoint.values[channel] = static_cast<uint8_t>(2 * quantized + sharedBit);
+		}
+
+		return endpoint;
+	}
+
+	void Bc7Palette(Bc7Endpoint const& first, Bc7Endpoint const& second, uint8_t (*palette)[4]) {
+		for (uint32_t k = 0; k < 16; ++k) {
+			for (uint32_t channel = 0; channel < 4; ++channel) {
+				uint32_t value = (64 - bc7Weights[k]) * first.values[channel] + bc7Weights[k] * second.values[channel] + 32;
+				palette[k][channel] = static_cast<uint8_t>(value >> 6);
+			}
+		}
+	}
+
+	struct Bc7Candidate {
+	public:
+		Bc7Endpoint first {};
+		Bc7Endpoint second {};
+		uint8_t indices[16] {};
+		float error = std::numeric_limits<float>::max();
+	};
+
+	// Every combination of the shared bits for the endpoints first and second
+	void TryBc7Endpoints(Block const& block, float const* first, float const* second, Bc7Candidate& best) {
+		for (uint32_t bits = 0; bits < 4; ++bits) {
+			Bc7Candidate candidate {};
+			candidate.first = QuantizeBc7(first, bits & 1);
+			candidate.second = QuantizeBc7(second, bits >> 1);
+
+			uint8_t colors[16][4] {};
+			Bc7Palette(candidate.first, candidate.second, colors);
+
+			Palette palette {};
+			for (uint32_t k = 0; k < 16; ++k) {
+				for (uint32_t channel = 0; channel < 4; ++channel) {
+					palette[k][channel] = colors[k][channel];
+				}
+			}
+
+			candidate.error = NearestIndices(block, palette, 16, 0, 4, candidate.indices);
+			if (candidate.error < best.error) {
+				best = candidate;
+			}
+		}
+	}
+
+	void EncodeBc7(Block const& block, uint8_t* destination) {
+		float mean[4] {};
+		float axis[4] {};
+		float low[4] {};
+		float high[4] {};
+		PrincipalAxis(block, 4, mean, axis);
+		AxisEndpoints(block, 4, mean, axis, low, high);
+
+		Bc7Candidate best {};
+		TryBc7Endpoints(block, low, high, best);
+
+		float weights[16] {};
+		for (uint32_t k = 0; k < 16; ++k) {
+			weights[k] = static_cast<float>(bc7Weights[k]) / 64.0f;
+		}
+
+		for (uint32_t iteration = 0; iteration < 2 && best.error > 0.0f; ++iteration) {
+			float first[4] {};
+			float second[4] {};
+			float error = best.error;
+			if (!FitEndpoints(block, 4, best.indices, weights, first, second)) {
+				break;
+			}
+
+			TryBc7Endpoints(block, first, second, best);
+			if (best.error >= error) {
+				break;
+			}
+		}
+
+		// The highest bit of the index of the first pixel is implicitly 0
+		if (best.indices[0] >= 8) {
+			std::swap(best.first, best.second);
+			for (uint8_t& index : best.indices) {
+				index = static_cast<uint8_t>(15 - index);
+			}
+		}
+
+		std::memset(destination, 0, 16);
+		BitWriter writer { destination };
+		writer.Write(1 << 6, 7);
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			writer.Write(best.first.values[channel] >> 1, 7);
+			writer.Write(best.second.values[channel] >> 1, 7);
+		}
+
+		writer.Write(best.first.values[0] & 1, 1);
+		writer.Write(best.second.values[0] & 1, 1);
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			writer.Write(best.indices[pixel], pixel == 0 ? 3 : 4);
+		}
+	}
+
+	void DecodeBc7(uint8_t const* source, uint8_t (*pixels)[4]) {
+		BitReader reader { source };
+		if (reader.Read(7) != 1 << 6) {
+			std::memset(pixels, 0, 16 * 4);
+			return;
+		}
+
+		Bc7Endpoint first {};
+		Bc7Endpoint second {};
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			first.values[channel] = static_cast<uint8_t>(reader.Read(7) << 1);
+			second.values[channel] = static_cast<uint8_t>(reader.Read(7) << 1);
+		}
+
+		uint32_t firstBit = reader.Read(1);
+		uint32_t secondBit = reader.Read(1);
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			first.values[channel] |= static_cast<uint8_t>(firstBit);
+			second.values[channel] |= static_cast<uint8_t>(secondBit);
+		}
+
+		uint8_t palette[16][4] {};
+		Bc7Palette(first, second, palette);
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			std::memcpy(pixels[pixel], palette[reader.Read(pixel == 0 ? 3 : 4)], 4);
+		}
+	}
+}
+
+size_t BlockBytes(BlockFormat format) {
+	return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+size_t CompressedSize(BlockFormat format, uint32_t width, uint32_t height) {
+	return static_cast<size_t>(BlockCount(width)) * BlockCount(height) * BlockBytes(format);
+}
+
+void CompressRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, BlockFormat format, unsigned threadCount) {
+	if (width == 0 || height == 0) {
+		return;
+	}
+
+	uint32_t blocksX = BlockCount(width);
+	uint32_t blocksY = BlockCount(height);
+	if (static_cast<size_t>(blocksX) * blocksY < minParallelBlocks) {
+		threadCount = 1;
+	}
+
+	size_t blockBytes = BlockBytes(format);
+	Math::ParallelFor<1>(blocksY, threadCount, [=](size_t begin, size_t end) {
+		Block block {};
+		for (uint32_t y = static_cast<uint32_t>(begin); y < end; ++y) {
+			for (uint32_t x = 0; x < blocksX; ++x) {
+				LoadBlock(source, width, height, x, y, block);
+				uint8_t* output = destination + (static_cast<size_t>(y) * blocksX + x) * blockBytes;
+
+				switch (format) {
+					case BlockFormat::BC1:
+						EncodeColors(block, output);
+						break;
+
+					case BlockFormat::BC3:
+						EncodeAlpha(block, output);
+						EncodeColors(block, output + 8);
+						break;
+
+					case BlockFormat::BC7:
+						EncodeBc7(block, output);
+						break;
+				}
+			}
+		}
+	});
+}
+
+void DecompressRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, BlockFormat format, unsigned threadCount) {
+	if (width == 0 || height == 0) {
+		return;
+	}
+
+	uint32_t blocksX = BlockCount(width);
+	uint32_t blocksY = BlockCount(height);
+	if (static_cast<size_t>(blocksX) * blocksY < minParallelBlocks) {
+		threadCount = 1;
+	}
+
+	size_t blockBytes = BlockBytes(format);
+	Math::ParallelFor<1>(blocksY, threadCount, [=](size_t begin, size_t end) {
+		uint8_t pixels[16][4] {};
+		for (uint32_t y = static_cast<uint32_t>(begin); y < end; ++y) {
+			for (uint32_t x = 0; x < blocksX; ++x) {
+				uint8_t const* input = source + (static_cast<size_t>(y) * blocksX + x) * blockBytes;
+
+				switch (format) {
+					case BlockFormat::BC1:
+						DecodeColors(input, false, pixels);
+						break;
+
+					case BlockFormat::BC3:
+						DecodeColors(input + 8, true, pixels);
+						DecodeAlpha(input, pixels);
+						break;
+
+					case BlockFormat::BC7:
+						DecodeBc7(input, pixels);
+						break;
+				}
+
+				StoreBlock(pixels, width, height, x, y, destination);
+			}
+		}
+	});
+}
+
+// MARK: Mip chain
+BlockCompressedChain::BlockCompressedChain(MipChain const& chain, BlockFormat format, unsigned threadCount) : _format(format) {
+	_levels.resize(chain.GetLevelCount());
+
+	size_t size = 0;
+	for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+		MipChain::Level const& mipLevel = chain.GetLevel(level);
+		_levels[level] = { mipLevel.width, mipLevel.height, size };
+		size += CompressedSize(format, mipLevel.width, mipLevel.height);
+	}
+
+	_data.resize(size);
+	for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+		CompressRGBA8(chain.GetData(level), _levels[level].width, _levels[level].height, _data.data() + _levels[level].offset, format, threadCount);
+	}
+}
+
+BlockFormat BlockCompressedChain::GetFormat() const {
+	return _format;
+}
+
+uint32_t BlockCompressedChain::GetLevelCount() const {
+	return static_cast<uint32_t>(_levels.size());
+}
+
+MipChain::Level const& BlockCompressedChain::GetLevel(uint32_t level) const {
+	return _levels[level];
+}
+
+uint8_t const* BlockCompressedChain::GetData(uint32_t level) const {
+	return _data.data() + _levels[level].offset;
+}
+
+size_t BlockCompressedChain::GetSize(uint32_t level) const {
+	return CompressedSize(_format, _levels[level].width, _levels[level].height);
+}
+
+uint32_t BlockCompressedChain::GetRowSize(uint32_t level) const {
+	return BlockCount(_levels[level].width) * static_cast<uint32_t>(BlockBytes(_format));
+}
+
+uint32_t BlockCompressedChain::GetRowCount(uint32_t level) const {
+	return BlockCount(_levels[level].height);
+}
@@ -0,0 +1,125 @@
+#include <Resources/Texture/CookedTexture.hpp>
+
+// Copies of block-compressed textures cover whole blocks, even for the
+// levels smaller than a block
+static Extent3D CopySize(uint32_t width, uint32_t height, bool blocks) {
+	if (blocks) {
+		return Extent3D(4 * BlockCount(width), 4 * BlockCount(height), 1);
+	}
+
+	return Extent3D(width, height, 1);
+}
+
+wgpu::TextureFormat GetTextureFormat(TextureContainerFormat format, bool blockCompression) {
+	if (IsBlockCompressed(format) && !blockCompression) {
+		return GetColorSpace(format) == ColorSpace::Srgb ? wgpu::TextureFormat::RGBA8UnormSrgb : wgpu::TextureFormat::RGBA8Unorm;
+	}
+
+	switch (format) {
+		case TextureContainerFormat::RGBA8Unorm:
+			return wgpu::TextureFormat::RGBA8Unorm;
+
+		case TextureContainerFormat::RGBA8UnormSrgb:
+			return wgpu::TextureFormat::RGBA8UnormSrgb;
+
+		case TextureContainerFormat::BC1RGBAUnorm:
+			return wgpu::TextureFormat::BC1RGBAUnorm;
+
+		case TextureContainerFormat::BC1RGBAUnormSrgb:
+			return wgpu::TextureFormat::BC1RGBAUnormSrgb;
+
+		case TextureContainerFormat::BC3RGBAUnorm:
+			return wgpu::TextureFormat::BC3RGBAUnorm;
+
+		case TextureContainerFormat::BC3RGBAUnormSrgb:
+			return wgpu::TextureFormat::BC3RGBAUnormSrgb;
+
+		case TextureContainerFormat::BC7RGBAUnorm:
+			return wgpu::TextureFormat::BC7RGBAUnorm;
+
+		case TextureContainerFormat::BC7RGBAUnormSrgb:
+			return wgpu::TextureFormat::BC7RGBAUnormSrgb;
+	}
+
+	throw std::runtime_error("Unknown texture container format");
+}
+
+std::optional<BlockFormat> GetBlockFormat(wgpu::TextureFormat format) {
+	switch (format) {
+		case wgpu::TextureFormat::BC1RGBAUnorm:
+		case wgpu::TextureFormat::BC1RGBAUnormSrgb:
+			return BlockFormat::BC1;
+
+		case wgpu::TextureFormat::BC3RGBAUnorm:
+		case wgpu::TextureFormat::BC3RGBAUnormSrgb:
+			return BlockFormat::BC3;
+
+		case wgpu::TextureFormat::BC7RGBAUnorm:
+		case wgpu::TextureFormat::BC7RGBAUnormSrgb:
+			return BlockFormat::BC7;
+
+		default:
+			return std::nullopt;
+	}
+}
+
+ColorSpace GetColorSpace(wgpu::TextureFormat format) {
+	switch (format) {
+		case wgpu::TextureFormat::RGBA8UnormSrgb:
+		case wgpu::TextureFormat::BC1RGBAUnormSrgb:
+		case wgpu::TextureFormat::BC3RGBAUnormSrgb:
+		case wgpu::TextureFormat::BC7RGBAUnormSrgb:
+			return ColorSpace::Srgb;
+
+		default:
+			return ColorSpace::Linear;
+	}
+}
+
+bool IsRGBA8(wgpu::TextureFormat format) {
+	return format == wgpu::TextureFormat::RGBA8Unorm || format == wgpu::TextureFormat::RGBA8UnormSrgb;
+}
+
+void WriteTextureContainer(Queue& queue, Texture& texture, TextureContainer const& container) {
+	TextureContainerFormat format = container.GetFormat();
+	bool decompress = IsBlockCompressed(format) && !GetBlockFormat(texture->getFormat()).has_value();
+
+	std::vector<uint8_t> pixels {};
+	for (uint32_t layer = 0; layer < container.GetLayerCount(); ++layer) {
+		for (uint32_t level = 0; level < container.GetLevelCount(); ++level) {
+			uint32_t width = container.GetWidth(level);
+			uint32_t height = container.GetHeight(level);
+			Origin3D origin = { 0, 0, layer };
+
+			TexelCopyTextureInfo copyTextureInfo(texture);
+			copyTextureInfo.origin = origin;
+			copyTextureInfo.mipLevel = level;
+
+			if (decompress) {
+				pixels.resize(4 * static_cast<size_t>(width) * height);
+				DecompressRGBA8(container.GetData(layer, level), width, height, pixels.data(), GetBlockFormat(format));
+
+				TexelCopyBufferLayout copyBufferLayout(4 * width, height);
+				queue->writeTexture(copyTextureInfo, pixels.data(), pixels.size(), copyBufferLayout, CopySize(width, height, false));
+				continue;
+			}
+
+			TexelCopyBufferLayout copyBufferLayout(TextureContainerRowSize(format, width), TextureContainerRowCount(format, height));
+			queue->writeTexture(copyTextureInfo, container.GetData(layer, level), container.GetSize(level), copyBufferLayout, CopySize(width, height, IsBlockCompressed(format)));
+		}
+	}
+}
+
+void WriteBlockCompressedChain(Queue& queue, Texture& texture, BlockCompressedChain const& chain, uint32_t layer) {
+	for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+		MipChain::Level const& mipLevel = chain.GetLevel(level);
+		Origin3D origin = { 0, 0, layer };
+
+		TexelCopyTextureInfo copyTextureInfo(texture);
+		copyTextureInfo.origin = origin;
+		copyTextureInfo.mipLevel = level;
+		TexelCopyBufferLayout copyBufferLayout(chain.GetRowSize(level), chain.GetRowCount(level));
+
+		queue->writeTexture(copyTextureInfo, chain.GetData(level), chain.GetSize(level), copyBufferLayout, CopySize(mipLevel.width, mipLevel.height, true));
+	}
+}
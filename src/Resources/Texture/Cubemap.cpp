@@ -1,58 +1,165 @@
 #include <Resources/Texture/Cubemap.hpp>
 
-Cubemap::Cubemap(std::array<std::filesystem::path, 6> const& texturePaths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
-	std::array<uint8_t*, 6> pixelData;
+static double SecondsSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+Cubemap::Cubemap(std::array<std::filesystem::path, 6> const& texturePaths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool, CubemapMipMaps const& mipMaps) {
 	try {
-		Extent3D cubemapSize = { 0, 0, 6 };
+		auto start = std::chrono::steady_clock::now();
+
+		// The faces are filtered in linear space when the texture is sRGB, and
+		// compressed when it is block-compressed
+		ColorSpace colorSpace = GetColorSpace(textureDescriptor.format);
+		std::optional<BlockFormat> blockFormat = GetBlockFormat(textureDescriptor.format);
+
+		// Everything is copied, as tasks may still run after an exception. The
+		// images are freed as soon as their chain is done.
+		std::array<std::future<MipChain>, 6> decodes {};
 		for (uint32_t layer = 0; layer < 6; ++layer) {
-			int width = 0;
-			int height = 0;
-			int channels = 0;
-			pixelData[layer] = stbi_load(texturePaths[layer].string().c_str(), &width, &height, &channels, 4);
-			if (pixelData[layer] == nullptr) {
-				throw std::runtime_error("Failed to load texture: " + texturePaths[layer].string());
+			decodes[layer] = threadPool.Submit([path = texturePaths[layer], filter = mipMaps.filter, levelCount = mipMaps.levelCount, colorSpace]() {
+				Image face = Image::Load(path);
+				if (face.Width() != face.Height()) {
+					throw std::runtime_error("Cubemap faces must be square!");
+				}
+
+				return MipChain(face.Data(), face.Width(), face.Height(), filter, colorSpace, levelCount);
+			});
+		}
+
+		std::array<MipChain, 6> chains {};
+		auto upload = [&](uint32_t layer) {
+			auto uploadStart = std::chrono::steady_clock::now();
+
+			for (uint32_t level = 0; level < chains[layer].GetLevelCount(); ++level) {
+				MipChain::Level const& mipLevel = chains[layer].GetLevel(level);
+				Origin3D origin = { 0, 0, layer };
+
+				TexelCopyTextureInfo copyTextureInfo(_texture);
+				copyTextureInfo.origin = origin;
+				copyTextureInfo.mipLevel = level;
+				TexelCopyBufferLayout copyBufferLayout(4 * mipLevel.width, mipLevel.height);
+
+				Extent3D writeSize(mipLevel.width, mipLevel.height, 1);
+				queue->writeTexture(copyTextureInfo, chains[layer].GetData(level), chains[layer].GetSize(level), copyBufferLayout, writeSize);
 			}
 
-			if (layer == 0) {
-				cubemapSize.width = (uint32_t) (width);
-				cubemapSize.height = (uint32_t) (height);
+			_timings.uploads += SecondsSince(uploadStart);
+		};
+
+		// The chains are moved to the tasks, and freed once compressed
+		std::array<std::future<BlockCompressedChain>, 6> compressions {};
+		auto compress = [&](uint32_t layer) {
+			compressions[layer] = threadPool.Submit([chain = std::move(chains[layer]), format = *blockFormat]() {
+				return BlockCompressedChain(chain, format);
+			});
+		};
+
+		auto uploadCompressed = [&](uint32_t layer) {
+			auto compressionStart = std::chrono::steady_clock::now();
+			BlockCompressedChain compressed = compressions[layer].get();
+			_timings.compression += SecondsSince(compressionStart);
+
+			auto uploadStart = std::chrono::steady_clock::now();
+			WriteBlockCompressedChain(queue, _texture, compressed, layer);
+			_timings.uploads += SecondsSince(uploadStart);
+		};
+
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			auto decodingStart = std::chrono::steady_clock::now();
+			chains[layer] = decodes[layer].get();
+			_timings.decoding += SecondsSince(decodingStart);
+
+			// The first face may already be uploaded and freed
+			if (layer != 0 && chains[layer].GetLevel(0).width != textureDescriptor.size.width) {
+				throw std::runtime_error("All cubemap faces must have the same size!");
 			}
 
-			else {
-				if (cubemapSize.width != (uint32_t) (width) || cubemapSize.height != (uint32_t) (height)) {
-					throw std::runtime_error("All cubemap faces must have the same size!");
+			if (layer == 0) {
+				if (blockFormat.has_value() && chains[0].GetLevel(0).width % 4 != 0) {
+					throw std::runtime_error("Block-compressed cubemap faces must have a size multiple of 4!");
 				}
+
+				textureDescriptor.size.width = chains[0].GetLevel(0).width;
+				textureDescriptor.size.height = chains[0].GetLevel(0).height;
+				textureDescriptor.size.depthOrArrayLayers = 6;
+				textureDescriptor.mipLevelCount = chains[0].GetLevelCount();
+				_texture = std::move(Texture(device, textureDescriptor));
 			}
-		}
 
-		_texture = std::move(Texture(device, textureDescriptor));
+			if (!mipMaps.seamAware && blockFormat.has_value()) {
+				compress(layer);
+			}
 
-		Extent3D cubemapLayerSize = { cubemapSize.width, cubemapSize.height, 1 };
-		for (uint32_t layer = 0; layer < 6; ++layer) {
-			Origin3D origin = { 0, 0, layer };
+			else if (!mipMaps.seamAware) {
+				upload(layer);
+				chains[layer] = MipChain();
+			}
+		}
+
+		if (mipMaps.seamAware) {
+			auto seamsStart = std::chrono::steady_clock::now();
+			FixCubemapSeams(chains, colorSpace);
+			_timings.seams = SecondsSince(seamsStart);
 
-			size_t dataSize = 4 * cubemapLayerSize.width * cubemapLayerSize.height;
-			TexelCopyTextureInfo copyTextureInfo(_texture);
-			copyTextureInfo.origin = origin;
-			TexelCopyBufferLayout copyBufferLayout(4 * cubemapLayerSize.width, cubemapLayerSize.height);
+			for (uint32_t layer = 0; layer < 6; ++layer) {
+				if (blockFormat.has_value()) {
+					compress(layer);
+				}
 
-			Extent3D writeSize(cubemapLayerSize.width, cubemapLayerSize.height, 1);
-			queue->writeTexture(copyTextureInfo, pixelData[layer], dataSize, copyBufferLayout, writeSize);
+				else {
+					upload(layer);
+				}
+			}
+		}
 
-			stbi_image_free(pixelData[layer]);
+		if (blockFormat.has_value()) {
+			for (uint32_t layer = 0; layer < 6; ++layer) {
+				uploadCompressed(layer);
+			}
 		}
 
-		_textureView = std::move(TextureView(_texture, textureViewDescriptor));
+		TextureViewDescriptor mipMappedViewDescriptor = textureViewDescriptor;
+		mipMappedViewDescriptor.mipLevelCount = textureDescriptor.mipLevelCount;
+		_textureView = std::move(TextureView(_texture, mipMappedViewDescriptor));
+
+		_timings.total = SecondsSince(start);
 	}
 
 	catch (std::exception const& e) {
 		std::cerr << "Failed to create texture: " << e.what() << std::endl;
-		for (auto& data : pixelData) {
-			if (data != nullptr) {
-				stbi_image_free(data);
-			}
+		throw std::runtime_error("Failed to create texture or view");
+	}
+}
+
+Cubemap::Cubemap(TextureContainer const& container, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	try {
+		auto start = std::chrono::steady_clock::now();
+
+		if (!container.IsCubemap()) {
+			throw std::runtime_error("The container is not a cubemap!");
 		}
 
+		textureDescriptor.format = GetTextureFormat(container.GetFormat(), device.HasFeature(wgpu::FeatureName::TextureCompressionBC));
+		textureDescriptor.size.width = container.GetWidth();
+		textureDescriptor.size.height = container.GetHeight();
+		textureDescriptor.size.depthOrArrayLayers = 6;
+		textureDescriptor.mipLevelCount = container.GetLevelCount();
+		_texture = std::move(Texture(device, textureDescriptor));
+
+		WriteTextureContainer(queue, _texture, container);
+		_timings.uploads = SecondsSince(start);
+
+		TextureViewDescriptor mipMappedViewDescriptor = textureViewDescriptor;
+		mipMappedViewDescriptor.format = textureDescriptor.format;
+		mipMappedViewDescriptor.mipLevelCount = textureDescriptor.mipLevelCount;
+		_textureView = std::move(TextureView(_texture, mipMappedViewDescriptor));
+
+		_timings.total = SecondsSince(start);
+	}
+
+	catch (std::exception const& e) {
+		std::cerr << "Failed to create texture: " << e.what() << std::endl;
 		throw std::runtime_error("Failed to create texture or view");
 	}
 }
@@ -0,0 +1,85 @@
+#include <stdexcept>
+#include <future>
+#include <exception>
+#include <algorithm>
+
+#include <stb_image.h>
+
+#include <Resources/Texture/Image.hpp>
+
+void Image::Deleter::operator()(uint8_t* data) const {
+	stbi_image_free(data);
+}
+
+Image Image::Load(std::filesystem::path const& path) {
+	int width = 0;
+	int height = 0;
+	int channels = 0;
+
+	Image image {};
+	image._data.reset(stbi_load(path.string().c_str(), &width, &height, &channels, 4));
+	if (image._data == nullptr) {
+		throw std::runtime_error("Failed to load texture: " + path.string());
+	}
+
+	image._width = static_cast<uint32_t>(width);
+	image._height = static_cast<uint32_t>(height);
+	return image;
+}
+
+static void CheckCubemapFaces(std::array<Image, 6> const& faces) {
+	for (Image const& face : faces) {
+		if (face.Width() != faces[0].Width() || face.Height() != faces[0].Height()) {
+			throw std::runtime_error("All cubemap faces must have the same size!");
+		}
+	}
+}
+
+std::array<Image, 6> LoadCubemapFaces(std::array<std::filesystem::path, 6> const& paths) {
+	std::array<Image, 6> faces {};
+	for (size_t layer = 0; layer < 6; ++layer) {
+		faces[layer] = Image::Load(paths[layer]);
+	}
+
+	CheckCubemapFaces(faces);
+	return faces;
+}
+
+std::array<Image, 6> LoadCubemapFaces(std::array<std::filesystem::path, 6> const& paths, Utils::ThreadPool& threadPool) {
+	std::vector<Image> images = LoadImages(std::vector<std::filesystem::path>(paths.begin(), paths.end()), threadPool);
+
+	std::array<Image, 6> faces {};
+	std::move(images.begin(), images.end(), faces.begin());
+
+	CheckCubemapFaces(faces);
+	return faces;
+}
+
+std::vector<Image> LoadImages(std::vector<std::filesystem::path> const& paths, Utils::ThreadPool& threadPool) {
+	std::vector<std::future<Image>> decodes {};
+	decodes.reserve(paths.size());
+	for (std::filesystem::path const& path : paths) {
+		decodes.push_back(threadPool.Submit([&path]() { return Image::Load(path); }));
+	}
+
+	// Every future is waited for, so that no task is left using paths
+	std::vector<Image> images(paths.size());
+	std::exception_ptr error {};
+	for (size_t i = 0; i < decodes.size(); ++i) {
+		try {
+			images[i] = decodes[i].get();
+		}
+
+		catch (...) {
+			if (error == nullptr) {
+				error = std::current_exception();
+			}
+		}
+	}
+
+	if (error != nullptr) {
+		std::rethrow_exception(error);
+	}
+
+	return images;
+}
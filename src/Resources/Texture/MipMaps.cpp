@@ -0,0 +1,567 @@
+#include <bit>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <Math/Simd.hpp>
+#include <Math/Parallel.hpp>
+
+#include <Resources/Texture/MipMaps.hpp>
+
+namespace {
+	// Below this destination size, starting threads costs more than it saves
+	constexpr size_t minParallelPixels = 256 * 256;
+
+	// Rounded average of columns x rows source pixels from (x, y), for the
+	// borders of odd sized images
+	void AveragePixels(uint8_t const* source, uint32_t width, uint32_t x, uint32_t columns, uint32_t y, uint32_t rows, uint8_t* destination) {
+		uint32_t count = columns * rows;
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			uint32_t sum = 0;
+			for (uint32_t j = y; j < y + rows; ++j) {
+				for (uint32_t i = x; i < x + columns; ++i) {
+					sum += source[4 * (static_cast<size_t>(j) * width + i) + channel];
+				}
+			}
+
+			destination[channel] = static_cast<uint8_t>((sum + count / 2) / count);
+		}
+	}
+
+	// (a + b + c + d + 2) / 4 for count pixels, each from 2 pixels of row0 and 2 of row1
+	void AverageRowPair(uint8_t const* row0, uint8_t const* row1, uint32_t count, uint8_t* destination) {
+		uint32_t x = 0;
+
+#if defined(MATH_SIMD_SSE)
+		// 4 pixels from 2 x 8: vertical sums in 16 bits, then sums of the
+		// neighbouring pixels, which are the two halves of each register
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const two = _mm_set1_epi16(2);
+		for (; x + 4 <= count; x += 4) {
+			__m128i a0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + 8 * x));
+			__m128i a1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row0 + 8 * x + 16));
+			__m128i b0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + 8 * x));
+			__m128i b1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(row1 + 8 * x + 16));
+
+			__m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+			__m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+			__m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+			__m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+			__m128i p01 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+			__m128i p23 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+			p01 = _mm_srli_epi16(_mm_add_epi16(p01, two), 2);
+			p23 = _mm_srli_epi16(_mm_add_epi16(p23, two), 2);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * x), _mm_packus_epi16(p01, p23));
+		}
+#elif defined(MATH_SIMD_NEON)
+		// 2 pixels from 2 x 4, the rounding shift giving the + 2
+		for (; x + 2 <= count; x += 2) {
+			uint8x16_t a = vld1q_u8(row0 + 8 * x);
+			uint8x16_t b = vld1q_u8(row1 + 8 * x);
+
+			uint16x8_t s0 = vaddl_u8(vget_low_u8(a), vget_low_u8(b));
+			uint16x8_t s1 = vaddl_u8(vget_high_u8(a), vget_high_u8(b));
+			uint16x8_t sums = vcombine_u16(vadd_u16(vget_low_u16(s0), vget_high_u16(s0)), vadd_u16(vget_low_u16(s1), vget_high_u16(s1)));
+
+			vst1_u8(destination + 4 * x, vrshrn_n_u16(sums, 2));
+		}
+#endif
+
+		for (; x < count; ++x) {
+			for (uint32_t channel = 0; channel < 4; ++channel) {
+				uint32_t sum = row0[8 * x + channel] + row0[8 * x + 4 + channel] + row1[8 * x + channel] + row1[8 * x + 4 + channel];
+				destination[4 * x + channel] = static_cast<uint8_t>((sum + 2) / 4);
+			}
+		}
+	}
+
+	void DownsampleRows(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, uint32_t rowBegin, uint32_t rowEnd) {
+		uint32_t levelWidth = NextMipSize(width);
+		uint32_t levelHeight = NextMipSize(height);
+
+		// The last column and row take the one left by an odd size
+		uint32_t lastColumns = width == 1 ? 1 : 2 + width % 2;
+		uint32_t lastRows = height == 1 ? 1 : 2 + height % 2;
+
+		for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+			uint8_t* row = destination + 4 * static_cast<size_t>(y) * levelWidth;
+			uint32_t rows = y + 1 == levelHeight ? lastRows : 2;
+
+			if (rows != 2 || width == 1) {
+				for (uint32_t x = 0; x < levelWidth; ++x) {
+					AveragePixels(source, width, 2 * x, x + 1 == levelWidth ? lastColumns : 2, 2 * y, rows, row + 4 * x);
+				}
+
+				continue;
+			}
+
+			uint8_t const* row0 = source + 4 * static_cast<size_t>(2 * y) * width;
+			uint8_t const* row1 = row0 + 4 * static_cast<size_t>(width);
+			if (lastColumns == 2) {
+				AverageRowPair(row0, row1, levelWidth, row);
+			}
+
+			else {
+				AverageRowPair(row0, row1, levelWidth - 1, row);
+				AveragePixels(source, width, 2 * (levelWidth - 1), lastColumns, 2 * y, 2, row + 4 * (levelWidth - 1));
+			}
+		}
+	}
+
+	// MARK: Filters
+	// Linear values are encoded by looking up their bucket, then moving past
+	// the thresholds inside it; a bucket is never wider than one code
+	constexpr size_t srgbBuckets = 4096;
+
+	struct ConversionTables {
+	public:
+		std::array<float, 256> srgbToLinear {};
+		std::array<float, 256> unormToLinear {};
+		std::array<float, 255> srgbThresholds {}; // Linear values from which the encoding rounds up to i + 1
+		std::array<uint8_t, srgbBuckets + 1> srgbBucketCodes {}; // Encoding of the start of each bucket
+	};
+
+	double DecodeSrgb(double value) {
+		return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+	}
+
+	ConversionTables const& GetConversionTables() {
+		static ConversionTables const tables = [] {
+			ConversionTables result {};
+			for (int i = 0; i < 256; ++i) {
+				result.srgbToLinear[i] = static_cast<float>(DecodeSrgb(i / 255.0));
+				result.unormToLinear[i] = static_cast<float>(i / 255.0);
+			}
+
+			for (int i = 0; i < 255; ++i) {
+				result.srgbThresholds[i] = static_cast<float>(DecodeSrgb((i + 0.5) / 255.0));
+			}
+
+			for (size_t i = 0; i <= srgbBuckets; ++i) {
+				float value = static_cast<float>(i) / static_cast<float>(srgbBuckets);
+				auto threshold = std::upper_bound(result.srgbThresholds.begin(), result.srgbThresholds.end(), value);
+				result.srgbBucketCodes[i] = static_cast<uint8_t>(threshold - result.srgbThresholds.begin());
+			}
+
+			return result;
+		}();
+
+		return tables;
+	}
+
+	uint8_t LinearToUnorm(float value) {
+		return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	// Radius of the Kaiser and Lanczos kernels, in pixels of the destination
+	constexpr float kernelRadius = 3.0f;
+	constexpr float kaiserAlpha = 4.0f;
+	constexpr float pi = 3.14159265358979323846f;
+
+	float Sinc(float x) {
+		return x == 0.0f ? 1.0f : std::sin(pi * x) / (pi * x);
+	}
+
+	// Modified Bessel function of the first kind, of order 0
+	float BesselI0(float x) {
+		float sum = 1.0f;
+		float term = 1.0f;
+		for (int k = 1; k < 32; ++k) {
+			term *= (x / (2.0f * k)) * (x / (2.0f * k));
+			sum += term;
+		}
+
+		return sum;
+	}
+
+	float Kernel(MipFilter filter, float t) {
+		if (std::abs(t) >= kernelRadius) {
+			return 0.0f;
+		}
+
+		if (filter == MipFilter::Kaiser) {
+			float ratio = t / kernelRadius;
+			return Sinc(t) * BesselI0(kaiserAlpha * std::sqrt(1.0f - ratio * ratio)) / BesselI0(kaiserAlpha);
+		}
+
+		return Sinc(t) * Sinc(t / kernelRadius);
+	}
+
+	// Source pixels and normalized weights of each destination pixel along one
+	// axis, count per pixel, unused ones having a weight of 0
+	struct Taps {
+	public:
+		uint32_t count = 0;
+		std::vector<uint32_t> indices {};
+		std::vector<float> weights {};
+	};
+
+	Taps ComputeTaps(MipFilter filter, uint32_t size, uint32_t levelSize) {
+		Taps taps {};
+
+		if (filter == MipFilter::Box) {
+			// The blocks of the integer box filter, the last one taking an odd pixel
+			taps.count = size == 1 ? 1 : 2 + size % 2;
+			taps.indices.resize(static_cast<size_t>(taps.count) * levelSize);
+			taps.weights.resize(static_cast<size_t>(taps.count) * levelSize);
+			for (uint32_t x = 0; x < levelSize; ++x) {
+				uint32_t begin = size == 1 ? 0 : 2 * x;
+				uint32_t count = x + 1 == levelSize ? size - begin : 2;
+				for (uint32_t k = 0; k < taps.count; ++k) {
+					taps.indices[x * taps.count + k] = k < count ? begin + k : begin;
+					taps.weights[x * taps.count + k] = k < count ? 1.0f / static_cast<float>(count) : 0.0f;
+				}
+			}
+
+			return taps;
+		}
+
+		// The kernel is stretched by the ratio of the sizes, and centered on the
+		// destination pixel; source pixels out of the image repeat the borders
+		float scale = static_cast<float>(size) / static_cast<float>(levelSize);
+		float support = kernelRadius * scale;
+		taps.count = static_cast<uint32_t>(std::ceil(2.0f * support)) + 1;
+		taps.indices.resize(static_cast<size_t>(taps.count) * levelSize);
+		taps.weights.resize(static_cast<size_t>(taps.count) * levelSize);
+
+		for (uint32_t x = 0; x < levelSize; ++x) {
+			float center = (static_cast<float>(x) + 0.5f) * scale;
+			int64_t first = static_cast<int64_t>(std::floor(center - support));
+
+			float total = 0.0f;
+			for (uint32_t k = 0; k < taps.count; ++k) {
+				int64_t i = first + k;
+				float weight = Kernel(filter, (static_cast<float>(i) + 0.5f - center) / scale);
+				taps.indices[x * taps.count + k] = static_cast<uint32_t>(std::clamp<int64_t>(i, 0, size - 1));
+				taps.weights[x * taps.count + k] = weight;
+				total += weight;
+			}
+
+			for (uint32_t k = 0; k < taps.count; ++k) {
+				taps.weights[x * taps.count + k] /= total;
+			}
+		}
+
+		return taps;
+	}
+
+	// Each destination row is the weighted sum of source rows, converted to
+	// linear, then filtered horizontally, so that only one row of floats is needed
+	void FilterRows(uint8_t const* source, uint32_t width, uint8_t* destination, Taps const& horizontal, Taps const& vertical, ColorSpace colorSpace, uint32_t rowBegin, uint32_t rowEnd) {
+		ConversionTables const& tables = GetConversionTables();
+		float const* colorTable = colorSpace == ColorSpace::Srgb ? tables.srgbToLinear.data() : tables.unormToLinear.data();
+		float const* alphaTable = tables.unormToLinear.data();
+
+		uint32_t levelWidth = NextMipSize(width);
+		std::vector<float> row(4 * static_cast<size_t>(width));
+
+		for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+			std::fill(row.begin(), row.end(), 0.0f);
+			for (uint32_t k = 0; k < vertical.count; ++k) {
+				float weight = vertical.weights[y * vertical.count + k];
+				if (weight == 0.0f) {
+					continue;
+				}
+
+				uint8_t const* sourceRow = source + 4 * static_cast<size_t>(vertical.indices[y * vertical.count + k]) * width;
+				for (size_t i = 0; i < 4 * static_cast<size_t>(width); i += 4) {
+					row[i + 0] += weight * colorTable[sourceRow[i + 0]];
+					row[i + 1] += weight * colorTable[sourceRow[i + 1]];
+					row[i + 2] += weight * colorTable[sourceRow[i + 2]];
+					row[i + 3] += weight * alphaTable[sourceRow[i + 3]];
+				}
+			}
+
+			uint8_t* destinationRow = destination + 4 * static_cast<size_t>(y) * levelWidth;
+			for (uint32_t x = 0; x < levelWidth; ++x) {
+				float pixel[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				for (uint32_t k = 0; k < horizontal.count; ++k) {
+					float weight = horizontal.weights[x * horizontal.count + k];
+					float const* p = &row[4 * static_cast<size_t>(horizontal.indices[x * horizontal.count + k])];
+					pixel[0] += weight * p[0];
+					pixel[1] += weight * p[1];
+					pixel[2] += weight * p[2];
+					pixel[3] += weight * p[3];
+				}
+
+				for (int channel = 0; channel < 3; ++channel) {
+					destinationRow[4 * x + channel] = colorSpace == ColorSpace::Srgb ? LinearToSrgb(pixel[channel]) : LinearToUnorm(pixel[channel]);
+				}
+
+				destinationRow[4 * x + 3] = LinearToUnorm(pixel[3]);
+			}
+		}
+	}
+	// MARK: Cubemaps
+	// Direction of the point (u, v) of a face, u going right and v down, both
+	// in [-1, 1], with the layer order and orientation of WebGPU
+	std::array<float, 3> FaceDirection(uint32_t face, float u, float v) {
+		switch (face) {
+			case 0: return { 1.0f, -v, -u };
+			case 1: return { -1.0f, -v, u };
+			case 2: return { u, 1.0f, v };
+			case 3: return { u, -1.0f, -v };
+			case 4: return { u, -v, 1.0f };
+			default: return { -u, -v, -1.0f };
+		}
+	}
+
+	struct FaceTexel {
+	public:
+		uint32_t face = 0;
+		uint32_t x = 0;
+		uint32_t y = 0;
+	};
+
+	// Texel of the face along axis seen in direction, direction[axis] being 1 or -1
+	FaceTexel TexelAt(std::array<float, 3> const& direction, uint32_t axis, uint32_t size) {
+		uint32_t face = 2 * axis + (direction[axis] < 0.0f ? 1 : 0);
+
+		float u = 0.0f;
+		float v = 0.0f;
+		switch (face) {
+			case 0: u = -direction[2]; v = -direction[1]; break;
+			case 1: u = direction[2]; v = -direction[1]; break;
+			case 2: u = direction[0]; v = direction[2]; break;
+			case 3: u = direction[0]; v = -direction[2]; break;
+			case 4: u = direction[0]; v = -direction[1]; break;
+			default: u = -direction[0]; v = -direction[1]; break;
+		}
+
+		auto index = [size](float coordinate) {
+			return static_cast<uint32_t>(std::clamp((coordinate + 1.0f) * 0.5f * static_cast<float>(size), 0.0f, static_cast<float>(size - 1)));
+		};
+
+		return { face, index(u), index(v) };
+	}
+
+	template <size_t count>
+	void AverageTexels(std::array<uint8_t*, count> const& texels, ColorSpace colorSpace) {
+		for (uint32_t channel = 0; channel < 4; ++channel) {
+			bool srgb = colorSpace == ColorSpace::Srgb && channel != 3;
+
+			float sum = 0.0f;
+			for (uint8_t const* texel : texels) {
+				sum += srgb ? SrgbToLinear(texel[channel]) : static_cast<float>(texel[channel]);
+			}
+
+			float average = sum / static_cast<float>(count);
+			uint8_t value = srgb ? LinearToSrgb(average) : static_cast<uint8_t>(average + 0.5f);
+			for (uint8_t* texel : texels) {
+				texel[channel] = value;
+			}
+		}
+	}
+
+	void FixLevelSeams(std::array<MipChain, 6>& chains, uint32_t level, ColorSpace colorSpace) {
+		uint32_t size = chains[0].GetLevel(level).width;
+		auto texel = [&](FaceTexel const& faceTexel) {
+			return chains[faceTexel.face].GetData(level) + 4 * (static_cast<size_t>(faceTexel.y) * size + faceTexel.x);
+		};
+
+		if (size == 1) {
+			std::array<uint8_t*, 6> texels {};
+			for (uint32_t face = 0; face < 6; ++face) {
+				texels[face] = chains[face].GetData(level);
+			}
+
+			AverageTexels(texels, colorSpace);
+			return;
+		}
+
+		// Each edge texel with the one across the edge, found from the
+		// direction of the edge, which is on both faces
+		for (uint32_t face = 0; face < 6; ++face) {
+			for (uint32_t edge = 0; edge < 4; ++edge) {
+				for (uint32_t i = 0; i < size; ++i) {
+					float t = -1.0f + static_cast<float>(2 * i + 1) / static_cast<float>(size);
+					float side = edge % 2 == 0 ? -1.0f : 1.0f;
+					std::array<float, 3> direction = edge < 2 ? FaceDirection(face, side, t) : FaceDirection(face, t, side);
+
+					uint32_t axis = face / 2;
+					uint32_t neighbourAxis = (axis + 1) % 3;
+					if (std::abs(direction[neighbourAxis]) != 1.0f) {
+						neighbourAxis = (axis + 2) % 3;
+					}
+
+					AverageTexels(std::array { texel(TexelAt(direction, axis, size)), texel(TexelAt(direction, neighbourAxis, size)) }, colorSpace);
+				}
+			}
+		}
+
+		for (uint32_t corner = 0; corner < 8; ++corner) {
+			std::array<float, 3> direction { corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f, corner & 4 ? 1.0f : -1.0f };
+			AverageTexels(std::array { texel(TexelAt(direction, 0, size)), texel(TexelAt(direction, 1, size)), texel(TexelAt(direction, 2, size)) }, colorSpace);
+		}
+	}
+}
+
+uint32_t MipLevelCount(uint32_t width, uint32_t height) {
+	return std::bit_width(std::max(width, height));
+}
+
+float SrgbToLinear(uint8_t value) {
+	return GetConversionTables().srgbToLinear[value];
+}
+
+uint8_t LinearToSrgb(float value) {
+	ConversionTables const& tables = GetConversionTables();
+	value = std::clamp(value, 0.0f, 1.0f);
+
+	uint32_t code = tables.srgbBucketCodes[static_cast<size_t>(value * static_cast<float>(srgbBuckets))];
+	while (code < 255 && value >= tables.srgbThresholds[code]) {
+		++code;
+	}
+
+	return static_cast<uint8_t>(code);
+}
+
+void DownsampleRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, unsigned threadCount) {
+	if (width == 0 || height == 0) {
+		return;
+	}
+
+	uint32_t levelHeight = NextMipSize(height);
+	if (static_cast<size_t>(NextMipSize(width)) * levelHeight < minParallelPixels) {
+		threadCount = 1;
+	}
+
+	Math::ParallelFor<8>(levelHeight, threadCount, [=](size_t begin, size_t end) {
+		DownsampleRows(source, width, height, destination, static_cast<uint32_t>(begin), static_cast<uint32_t>(end));
+	});
+}
+
+void DownsampleRGBA8(uint8_t const* source, uint32_t width, uint32_t height, uint8_t* destination, MipFilter filter, ColorSpace colorSpace, unsigned threadCount) {
+	if (filter == MipFilter::Box && colorSpace == ColorSpace::Linear) {
+		DownsampleRGBA8(source, width, height, destination, threadCount);
+		return;
+	}
+
+	if (width == 0 || height == 0) {
+		return;
+	}
+
+	uint32_t levelWidth = NextMipSize(width);
+	uint32_t levelHeight = NextMipSize(height);
+	if (static_cast<size_t>(levelWidth) * levelHeight < minParallelPixels) {
+		threadCount = 1;
+	}
+
+	Taps horizontal = ComputeTaps(filter, width, levelWidth);
+	Taps vertical = ComputeTaps(filter, height, levelHeight);
+	Math::ParallelFor<8>(levelHeight, threadCount, [&](size_t begin, size_t end) {
+		FilterRows(source, width, destination, horizontal, vertical, colorSpace, static_cast<uint32_t>(begin), static_cast<uint32_t>(end));
+	});
+}
+
+// MARK: Mip chain
+MipChain::MipChain(uint8_t const* data, uint32_t width, uint32_t height, uint32_t levelCount, unsigned threadCount) {
+	Generate(data, width, height, levelCount, threadCount);
+}
+
+MipChain::MipChain(uint8_t const* data, uint32_t width, uint32_t height, MipFilter filter, ColorSpace colorSpace, uint32_t levelCount, unsigned threadCount) {
+	Generate(data, width, height, filter, colorSpace, levelCount, threadCount);
+}
+
+void MipChain::Generate(uint8_t const* data, uint32_t width, uint32_t height, uint32_t levelCount, unsigned threadCount) {
+	Generate(data, width, height, MipFilter::Box, ColorSpace::Linear, levelCount, threadCount);
+}
+
+void MipChain::Generate(uint8_t const* data, uint32_t width, uint32_t height, MipFilter filter, ColorSpace colorSpace, uint32_t levelCount, unsigned threadCount) {
+	uint32_t maxLevelCount = MipLevelCount(width, height);
+	if (levelCount > maxLevelCount) {
+		throw std::runtime_error("Too many mip levels for the size of the image");
+	}
+
+	_levels.resize(levelCount == 0 ? maxLevelCount : levelCount);
+
+	size_t size = 0;
+	for (Level& level : _levels) {
+		level.width = width;
+		level.height = height;
+		level.offset = size;
+
+		size += 4 * static_cast<size_t>(width) * height;
+		width = NextMipSize(width);
+		height = NextMipSize(height);
+	}
+
+	_data.resize(size);
+	if (_levels.empty()) {
+		return;
+	}
+
+	std::memcpy(_data.data(), data, GetSize(0));
+	for (uint32_t level = 1; level < _levels.size(); ++level) {
+		Level const& previous = _levels[level - 1];
+		DownsampleRGBA8(&_data[previous.offset], previous.width, previous.height, &_data[_levels[level].offset], filter, colorSpace, threadCount);
+	}
+}
+
+uint32_t MipChain::GetLevelCount() const {
+	return static_cast<uint32_t>(_levels.size());
+}
+
+MipChain::Level const& MipChain::GetLevel(uint32_t level) const {
+	return _levels[level];
+}
+
+uint8_t const* MipChain::GetData(uint32_t level) const {
+	return _data.data() + _levels[level].offset;
+}
+
+uint8_t* MipChain::GetData(uint32_t level) {
+	return _data.data() + _levels[level].offset;
+}
+
+size_t MipChain::GetSize(uint32_t level) const {
+	return 4 * static_cast<size_t>(_levels[level].width) * _levels[level].height;
+}
+
+std::vector<uint8_t> const& MipChain::GetBuffer() const {
+	return _data;
+}
+
+// MARK: Cubemaps
+std::array<MipChain, 6> GenerateCubemapMipChains(std::array<uint8_t const*, 6> const& faces, uint32_t size, MipFilter filter, ColorSpace colorSpace, bool seamAware, uint32_t levelCount, unsigned threadCount) {
+	// Checked here, as the faces are generated on other threads
+	if (levelCount > MipLevelCount(size, size)) {
+		throw std::runtime_error("Too many mip levels for the size of the image");
+	}
+
+	// Threads left once each face has one go to the filters
+	std::array<MipChain, 6> chains {};
+	unsigned faceThreadCount = std::max(threadCount / 6, 1u);
+	Math::ParallelFor<1>(6, threadCount, [&](size_t begin, size_t end) {
+		for (size_t face = begin; face < end; ++face) {
+			chains[face].Generate(faces[face], size, size, filter, colorSpace, levelCount, faceThreadCount);
+		}
+	});
+
+	if (seamAware) {
+		FixCubemapSeams(chains, colorSpace);
+	}
+
+	return chains;
+}
+
+void FixCubemapSeams(std::array<MipChain, 6>& chains, ColorSpace colorSpace) {
+	for (MipChain const& chain : chains) {
+		if (chain.GetLevelCount() != chains[0].GetLevelCount()) {
+			throw std::runtime_error("Cubemap faces must be square and of the same size!");
+		}
+
+		if (chain.GetLevelCount() != 0 && (chain.GetLevel(0).width != chains[0].GetLevel(0).width || chain.GetLevel(0).height != chain.GetLevel(0).width)) {
+			throw std::runtime_error("Cubemap faces must be square and of the same size!");
+		}
+	}
+
+	for (uint32_t level = 1; level < chains[0].GetLevelCount(); ++level) {
+		FixLevelSeams(chains, level, colorSpace);
+	}
+}
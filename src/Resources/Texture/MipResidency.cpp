@@ -0,0 +1,69 @@
+#include <stdexcept>
+
+#include <Resources/Texture/MipResidency.hpp>
+
+// MARK: Residency
+MipResidency::MipResidency(uint32_t levelCount, uint32_t baseLevel) : _levelCount(levelCount), _baseLevel(baseLevel), _residentLevel(levelCount) {
+	if (baseLevel >= levelCount) {
+		throw std::runtime_error("The base level must be a level of the mip chain");
+	}
+}
+
+uint32_t MipResidency::GetLevelCount() const {
+	return _levelCount;
+}
+
+uint32_t MipResidency::GetBaseLevel() const {
+	return _baseLevel;
+}
+
+uint32_t MipResidency::GetResidentLevel() const {
+	return _residentLevel;
+}
+
+bool MipResidency::IsEmpty() const {
+	return _residentLevel == _levelCount;
+}
+
+bool MipResidency::IsComplete() const {
+	return _residentLevel == _baseLevel;
+}
+
+uint32_t MipResidency::GetNextLevel() const {
+	return _residentLevel - 1;
+}
+
+void MipResidency::MarkNextLevelUploaded() {
+	if (!IsComplete()) {
+		--_residentLevel;
+	}
+}
+
+uint32_t MipResidency::GetViewBaseLevel() const {
+	return _residentLevel - _baseLevel;
+}
+
+uint32_t MipResidency::GetViewLevelCount() const {
+	return _levelCount - _residentLevel;
+}
+
+// MARK: Budget
+UploadBudget::UploadBudget(size_t bytes) : _bytes(bytes) {}
+
+bool UploadBudget::TryConsume(size_t bytes) {
+	if (_started ? bytes > GetRemaining() : _bytes == 0) {
+		return false;
+	}
+
+	_started = true;
+	_used += bytes;
+	return true;
+}
+
+size_t UploadBudget::GetUsed() const {
+	return _used;
+}
+
+size_t UploadBudget::GetRemaining() const {
+	return _used < _bytes ? _bytes - _used : 0;
+}
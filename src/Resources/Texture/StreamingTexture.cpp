@@ -0,0 +1,230 @@
+#include <Resources/Texture/StreamingTexture.hpp>
+
+// MARK: Streaming texture
+StreamingTexture::StreamingTexture(Device& device, Queue& queue, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, StreamingTextureOptions const& options) : _device(device), _queue(queue), _textureDescriptor(textureDescriptor), _textureViewDescriptor(textureViewDescriptor), _wantedLevel(options.wantedLevel) {
+	TextureDescriptor placeholderDescriptor = _textureDescriptor;
+	placeholderDescriptor.size.width = 1;
+	placeholderDescriptor.size.height = 1;
+	placeholderDescriptor.size.depthOrArrayLayers = 1;
+	placeholderDescriptor.mipLevelCount = 1;
+	_current.texture = std::move(Texture(_device, placeholderDescriptor));
+	_current.bytes = options.placeholder.size();
+
+	TexelCopyTextureInfo copyTextureInfo(_current.texture);
+	TexelCopyBufferLayout copyBufferLayout(4, 1);
+
+	Extent3D writeSize(1, 1, 1);
+	_queue->writeTexture(copyTextureInfo, options.placeholder.data(), options.placeholder.size(), copyBufferLayout, writeSize);
+
+	TextureViewDescriptor placeholderViewDescriptor = _textureViewDescriptor;
+	placeholderViewDescriptor.baseMipLevel = 0;
+	placeholderViewDescriptor.mipLevelCount = 1;
+	_current.view = std::move(TextureView(_current.texture, placeholderViewDescriptor));
+}
+
+bool StreamingTexture::IsComplete() const {
+	return _decoded && _next == nullptr && _current.residency.GetLevelCount() != 0 && _current.residency.IsComplete();
+}
+
+uint32_t StreamingTexture::GetLevelCount() const {
+	return _decoded ? _chain.GetLevelCount() : 0;
+}
+
+uint32_t StreamingTexture::GetResidentLevel() const {
+	// The placeholder has no residency
+	if (_current.residency.GetLevelCount() == 0) {
+		return GetLevelCount();
+	}
+
+	return _current.residency.GetResidentLevel();
+}
+
+void StreamingTexture::SetWantedLevel(uint32_t level) {
+	if (!_decoded) {
+		_wantedLevel = level;
+		return;
+	}
+
+	_wantedLevel = std::min(level, _chain.GetLevelCount() - 1);
+	if (_current.residency.GetLevelCount() != 0 && _current.residency.GetBaseLevel() == _wantedLevel) {
+		_next.reset();
+		return;
+	}
+
+	if (_next == nullptr || _next->residency.GetBaseLevel() != _wantedLevel) {
+		_next = std::make_unique<Allocation>(Allocate(_wantedLevel));
+	}
+}
+
+size_t StreamingTexture::GetAllocatedBytes() const {
+	return _current.bytes + (_next != nullptr ? _next->bytes : 0);
+}
+
+StreamingTexture::Allocation StreamingTexture::Allocate(uint32_t level) {
+	MipChain::Level const& mipLevel = _chain.GetLevel(level);
+
+	TextureDescriptor descriptor = _textureDescriptor;
+	descriptor.size.width = mipLevel.width;
+	descriptor.size.height = mipLevel.height;
+	descriptor.size.depthOrArrayLayers = 1;
+	descriptor.mipLevelCount = _chain.GetLevelCount() - level;
+
+	// The levels from level are the end of the chain
+	Allocation allocation {};
+	allocation.texture = std::move(Texture(_device, descriptor));
+	allocation.residency = MipResidency(_chain.GetLevelCount(), level);
+	allocation.bytes = _chain.GetBuffer().size() - mipLevel.offset;
+
+	return allocation;
+}
+
+void StreamingTexture::UploadNextLevel(Allocation& allocation) {
+	uint32_t level = allocation.residency.GetNextLevel();
+	MipChain::Level const& mipLevel = _chain.GetLevel(level);
+
+	TexelCopyTextureInfo copyTextureInfo(allocation.texture);
+	copyTextureInfo.mipLevel = level - allocation.residency.GetBaseLevel();
+	TexelCopyBufferLayout copyBufferLayout(4 * mipLevel.width, mipLevel.height);
+
+	Extent3D writeSize(mipLevel.width, mipLevel.height, 1);
+	_queue->writeTexture(copyTextureInfo, _chain.GetData(level), _chain.GetSize(level), copyBufferLayout, writeSize);
+
+	allocation.residency.MarkNextLevelUploaded();
+}
+
+void StreamingTexture::UpdateView(Allocation& allocation) {
+	TextureViewDescriptor descriptor = _textureViewDescriptor;
+	descriptor.baseMipLevel = allocation.residency.GetViewBaseLevel();
+	descriptor.mipLevelCount = allocation.residency.GetViewLevelCount();
+
+	allocation.view = std::move(TextureView(allocation.texture, descriptor));
+	++_viewVersion;
+}
+
+// MARK: Streamer
+TextureStreamer::TextureStreamer(Device& device, Queue& queue, Utils::ThreadPool& threadPool) : _device(device), _queue(queue), _threadPool(threadPool) {}
+
+std::shared_ptr<StreamingTexture> TextureStreamer::Load(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, StreamingTextureOptions const& options) {
+	// The levels are written as the RGBA8 pixels of the mip chain
+	if (!IsRGBA8(textureDescriptor.format)) {
+		throw std::runtime_error("Streamed textures must be RGBA8");
+	}
+
+	std::shared_ptr<StreamingTexture> texture(new StreamingTexture(_device, _queue, textureDescriptor, textureViewDescriptor, options));
+
+	// sRGB textures are filtered in linear space
+	ColorSpace colorSpace = textureDescriptor.format == wgpu::TextureFormat::RGBA8UnormSrgb ? ColorSpace::Srgb : ColorSpace::Linear;
+	texture->_decode = _threadPool.Submit([path, filter = options.filter, colorSpace]() {
+		Image image = Image::Load(path);
+		return MipChain(image.Data(), image.Width(), image.Height(), filter, colorSpace);
+	});
+
+	_textures.push_back(texture);
+	return texture;
+}
+
+void TextureStreamer::Update(size_t byteBudget) {
+	auto start = std::chrono::steady_clock::now();
+	_statistics = {};
+
+	std::erase_if(_textures, [](std::shared_ptr<StreamingTexture> const& texture) {
+		return texture.use_count() == 1;
+	});
+
+	// A texture that failed keeps its placeholder, and is no longer streamed
+	for (size_t i = 0; i < _textures.size();) {
+		StreamingTexture& texture = *_textures[i];
+		if (texture._decoded || texture._decode.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+			++i;
+			continue;
+		}
+
+		try {
+			texture._chain = texture._decode.get();
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to stream texture: " << e.what() << std::endl;
+			texture._failed = true;
+			++_statistics.failedTextures;
+			_textures.erase(_textures.begin() + static_cast<std::ptrdiff_t>(i));
+			continue;
+		}
+
+		texture._decoded = true;
+		texture._wantedLevel = std::min(texture._wantedLevel, texture._chain.GetLevelCount() - 1);
+		texture._next = std::make_unique<StreamingTexture::Allocation>(texture.Allocate(texture._wantedLevel));
+		++i;
+	}
+
+	// The smallest level left among the textures, until the budget is used
+	UploadBudget budget(byteBudget);
+	std::vector<bool> uploaded(_textures.size(), false);
+	while (true) {
+		size_t chosen = _textures.size();
+		size_t chosenSize = 0;
+		for (size_t i = 0; i < _textures.size(); ++i) {
+			StreamingTexture& texture = *_textures[i];
+			StreamingTexture::Allocation const& target = texture._next != nullptr ? *texture._next : texture._current;
+			if (!texture._decoded || target.residency.GetLevelCount() == 0 || target.residency.IsComplete()) {
+				continue;
+			}
+
+			size_t size = texture._chain.GetSize(target.residency.GetNextLevel());
+			if (chosen == _textures.size() || size < chosenSize) {
+				chosen = i;
+				chosenSize = size;
+			}
+		}
+
+		if (chosen == _textures.size() || !budget.TryConsume(chosenSize)) {
+			break;
+		}
+
+		StreamingTexture& texture = *_textures[chosen];
+		texture.UploadNextLevel(texture._next != nullptr ? *texture._next : texture._current);
+		uploaded[chosen] = true;
+
+		_statistics.uploadedBytes += chosenSize;
+		++_statistics.uploadedLevels;
+	}
+
+	// A new allocation replaces the current one once it has as many levels
+	for (size_t i = 0; i < _textures.size(); ++i) {
+		StreamingTexture& texture = *_textures[i];
+		if (!uploaded[i]) {
+			continue;
+		}
+
+		if (texture._next != nullptr) {
+			MipResidency const& next = texture._next->residency;
+			MipResidency const& current = texture._current.residency;
+			if (current.GetLevelCount() != 0 && !next.IsComplete() && next.GetResidentLevel() > current.GetResidentLevel()) {
+				continue;
+			}
+
+			texture._current = std::move(*texture._next);
+			texture._next.reset();
+		}
+
+		texture.UpdateView(texture._current);
+	}
+
+	for (std::shared_ptr<StreamingTexture> const& texture : _textures) {
+		if (texture->IsDecoded()) {
+			++_statistics.decodedTextures;
+		}
+
+		else {
+			++_statistics.pendingTextures;
+		}
+
+		if (texture->IsDecoded() && !texture->IsComplete()) {
+			++_statistics.incompleteTextures;
+		}
+
+		_statistics.allocatedBytes += texture->GetAllocatedBytes();
+	}
+
+	_statistics.updateSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
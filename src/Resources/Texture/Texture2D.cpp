@@ -1,34 +1,125 @@
 #include <Resources/Texture/Texture2D.hpp>
 
 Texture2D::Texture2D(std::filesystem::path const& path, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
-	int width = 0;
-	int height = 0;
-	int channels = 0;
-	unsigned char* data = nullptr;
+	Image image {};
 	try {
-		data = stbi_load(path.string().c_str(), &width, &height, &channels, 4);
-		if (data == nullptr) {
-			throw std::runtime_error("Failed to load texture: " + path.string());
+		image = Image::Load(path);
+	}
+
+	catch (std::exception const& e) {
+		std::cerr << "Failed to create texture: " << e.what() << std::endl;
+		throw std::runtime_error("Failed to create texture or view");
+	}
+
+	*this = Texture2D(image, device, queue, textureDescriptor, textureViewDescriptor);
+}
+
+Texture2D::Texture2D(Image const& image, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	try {
+		// The pixels are RGBA8, uploaded as they are or compressed
+		std::optional<BlockFormat> blockFormat = GetBlockFormat(textureDescriptor.format);
+		if (!blockFormat.has_value() && !IsRGBA8(textureDescriptor.format)) {
+			throw std::runtime_error("Images can only be uploaded to RGBA8 or block-compressed textures");
+		}
+
+		if (image.Data() == nullptr) {
+			throw std::runtime_error("Empty image");
+		}
+
+		if (blockFormat.has_value() && (image.Width() % 4 != 0 || image.Height() % 4 != 0)) {
+			throw std::runtime_error("Block-compressed textures must have a size multiple of 4");
 		}
 
+		textureDescriptor.size.width = image.Width();
+		textureDescriptor.size.height = image.Height();
+
 		_texture = std::move(Texture(device, textureDescriptor));
 		_textureView = std::move(TextureView(_texture, textureViewDescriptor));
 
 		TexelCopyTextureInfo copyTextureInfo(_texture);
-		TexelCopyBufferLayout copyBufferLayout(4 * width, height);
+		Extent3D writeSize(image.Width(), image.Height(), 1);
+
+		if (blockFormat.has_value()) {
+			std::vector<uint8_t> blocks(CompressedSize(*blockFormat, image.Width(), image.Height()));
+			CompressRGBA8(image.Data(), image.Width(), image.Height(), blocks.data(), *blockFormat, std::max(std::thread::hardware_concurrency(), 1u));
 
-		Extent3D writeSize(width, height, 1);
-		queue->writeTexture(copyTextureInfo, data, 4 * width * height, copyBufferLayout, writeSize);
+			TexelCopyBufferLayout copyBufferLayout(BlockCount(image.Width()) * static_cast<uint32_t>(BlockBytes(*blockFormat)), BlockCount(image.Height()));
+			queue->writeTexture(copyTextureInfo, blocks.data(), blocks.size(), copyBufferLayout, writeSize);
+			_uploadedBytes = blocks.size();
+		}
+
+		else {
+			TexelCopyBufferLayout copyBufferLayout(4 * image.Width(), image.Height());
+			queue->writeTexture(copyTextureInfo, image.Data(), image.Size(), copyBufferLayout, writeSize);
+			_uploadedBytes = image.Size();
+		}
 		//WriteMipMaps(device, texture, textureDescriptor.size, textureDescriptor.mipLevelCount, data);
+	}
 
-		stbi_image_free(data);
+	catch (std::exception const& e) {
+		std::cerr << "Failed to create texture: " << e.what() << std::endl;
+		throw std::runtime_error("Failed to create texture or view");
+	}
+}
+
+Texture2D::Texture2D(TextureContainer const& container, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	try {
+		if (container.GetLayerCount() != 1) {
+			throw std::runtime_error("The container has more than one layer");
+		}
+
+		textureDescriptor.format = GetTextureFormat(container.GetFormat(), device.HasFeature(wgpu::FeatureName::TextureCompressionBC));
+		textureDescriptor.size.width = container.GetWidth();
+		textureDescriptor.size.height = container.GetHeight();
+		textureDescriptor.size.depthOrArrayLayers = 1;
+		textureDescriptor.mipLevelCount = container.GetLevelCount();
+		_texture = std::move(Texture(device, textureDescriptor));
+
+		WriteTextureContainer(queue, _texture, container);
+
+		// Every level, decompressed to RGBA8 when the device cannot sample blocks
+		std::optional<BlockFormat> blockFormat = GetBlockFormat(textureDescriptor.format);
+		for (uint32_t level = 0; level < container.GetLevelCount(); ++level) {
+			uint32_t width = container.GetWidth(level);
+			uint32_t height = container.GetHeight(level);
+			_uploadedBytes += blockFormat.has_value() ? CompressedSize(*blockFormat, width, height) : 4 * static_cast<size_t>(width) * height;
+		}
+
+		TextureViewDescriptor mipMappedViewDescriptor = textureViewDescriptor;
+		mipMappedViewDescriptor.format = textureDescriptor.format;
+		mipMappedViewDescriptor.mipLevelCount = textureDescriptor.mipLevelCount;
+		_textureView = std::move(TextureView(_texture, mipMappedViewDescriptor));
 	}
 
 	catch (std::exception const& e) {
 		std::cerr << "Failed to create texture: " << e.what() << std::endl;
-		stbi_image_free(data);
 		throw std::runtime_error("Failed to create texture or view");
 	}
 }
 
-Texture2D::Texture2D(Texture2D&& other) : _texture(std::move(other._texture)), _textureView(std::move(other._textureView)) {}
+Texture2D::Texture2D(Texture2D&& other) : _texture(std::move(other._texture)), _textureView(std::move(other._textureView)), _uploadedBytes(other._uploadedBytes) {}
+
+std::vector<Texture2D> LoadTextures(std::vector<std::filesystem::path> const& paths, Device& device, Queue& queue, TextureDescriptor& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool) {
+	// The paths are copied, as tasks may still run after an exception
+	std::vector<std::future<Image>> decodes {};
+	decodes.reserve(paths.size());
+	for (std::filesystem::path const& path : paths) {
+		decodes.push_back(threadPool.Submit([path]() { return Image::Load(path); }));
+	}
+
+	// A texture that fails is logged and left empty, the others are uploaded
+	std::vector<Texture2D> textures {};
+	textures.reserve(paths.size());
+	for (size_t i = 0; i < decodes.size(); ++i) {
+		try {
+			textures.emplace_back(decodes[i].get(), device, queue, textureDescriptor, textureViewDescriptor);
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to load texture " << paths[i].string() << ": " << e.what() << std::endl;
+			textures.emplace_back();
+		}
+	}
+
+	return textures;
+}
@@ -0,0 +1,149 @@
+#include <Resources/Texture/TextureCache.hpp>
+
+size_t TextureCacheKeyHash::operator()(TextureCacheKey const& key) const {
+	size_t hash = std::hash<std::string>()(key.path);
+	for (uint32_t value : { key.format, key.mipLevelCount, key.viewBaseMipLevel, key.viewMipLevelCount }) {
+		hash ^= std::hash<uint32_t>()(value) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+	}
+
+	return hash;
+}
+
+TextureCache::TextureCache(Device& device, Queue& queue, size_t byteBudget) : _device(device), _queue(queue), _cache(byteBudget) {}
+
+TextureCacheKey TextureCache::MakeKey(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	// The file does not have to exist, loading it throws the usual error
+	TextureCacheKey key {};
+	key.path = std::filesystem::weakly_canonical(std::filesystem::absolute(path)).generic_string();
+	key.format = static_cast<uint32_t>(textureDescriptor.format);
+	key.mipLevelCount = textureDescriptor.mipLevelCount;
+	key.viewBaseMipLevel = textureViewDescriptor.baseMipLevel;
+	key.viewMipLevelCount = textureViewDescriptor.mipLevelCount;
+	return key;
+}
+
+std::shared_ptr<Texture2D> TextureCache::Upload(TextureCacheKey const& key, std::filesystem::path const& path, Image const* image, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	// The size, and the format and levels of the containers, are set by
+	// Texture2D on its own descriptor. The cost is what Texture2D uploaded,
+	// only the first level of the images.
+	TextureDescriptor descriptor = textureDescriptor;
+	std::shared_ptr<Texture2D> texture {};
+
+	if (image != nullptr) {
+		texture = std::make_shared<Texture2D>(*image, _device, _queue, descriptor, textureViewDescriptor);
+	}
+
+	else {
+		texture = std::make_shared<Texture2D>(TextureContainer(path), _device, _queue, descriptor, textureViewDescriptor);
+	}
+
+	size_t bytes = texture->GetUploadedBytes();
+	return _cache.Insert(key, std::move(texture), bytes);
+}
+
+std::shared_ptr<Texture2D> TextureCache::Load(std::filesystem::path const& path, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor) {
+	TextureCacheKey key = MakeKey(path, textureDescriptor, textureViewDescriptor);
+	if (std::shared_ptr<Texture2D> texture = _cache.Find(key)) {
+		return texture;
+	}
+
+	if (path.extension() == ".gstex") {
+		return Upload(key, path, nullptr, textureDescriptor, textureViewDescriptor);
+	}
+
+	Image image {};
+	try {
+		image = Image::Load(path);
+	}
+
+	catch (std::exception const& e) {
+		std::cerr << "Failed to create texture: " << e.what() << std::endl;
+		throw std::runtime_error("Failed to create texture or view");
+	}
+
+	return Upload(key, path, &image, textureDescriptor, textureViewDescriptor);
+}
+
+std::vector<std::shared_ptr<Texture2D>> TextureCache::Load(std::vector<std::filesystem::path> const& paths, TextureDescriptor const& textureDescriptor, TextureViewDescriptor const& textureViewDescriptor, Utils::ThreadPool& threadPool) {
+	std::vector<TextureCacheKey> keys {};
+	keys.reserve(paths.size());
+	std::vector<std::shared_ptr<Texture2D>> textures(paths.size());
+
+	// A decode per file missing from the cache, none for the containers. The
+	// paths are copied, as tasks may still run after an exception.
+	std::unordered_map<TextureCacheKey, std::future<Image>, TextureCacheKeyHash> decodes {};
+	for (size_t i = 0; i < paths.size(); ++i) {
+		keys.push_back(MakeKey(paths[i], textureDescriptor, textureViewDescriptor));
+		if (decodes.count(keys[i]) != 0) {
+			continue;
+		}
+
+		textures[i] = _cache.Find(keys[i]);
+		if (textures[i] == nullptr) {
+			std::future<Image>& decode = decodes[keys[i]];
+			if (paths[i].extension() != ".gstex") {
+				decode = threadPool.Submit([path = paths[i]]() { return Image::Load(path); });
+			}
+		}
+	}
+
+	// Each texture is uploaded as soon as it and the ones before it are
+	// decoded, the files given again reusing the first upload
+	std::unordered_map<TextureCacheKey, std::shared_ptr<Texture2D>, TextureCacheKeyHash> uploaded {};
+	for (size_t i = 0; i < paths.size(); ++i) {
+		if (textures[i] != nullptr) {
+			continue;
+		}
+
+		auto found = uploaded.find(keys[i]);
+		if (found != uploaded.end()) {
+			textures[i] = found->second;
+			continue;
+		}
+
+		// A texture that fails stays null, the files given again too
+		std::future<Image>& decode = decodes[keys[i]];
+		try {
+			if (!decode.valid()) {
+				textures[i] = Upload(keys[i], paths[i], nullptr, textureDescriptor, textureViewDescriptor);
+			}
+
+			else {
+				Image image = decode.get();
+				textures[i] = Upload(keys[i], paths[i], &image, textureDescriptor, textureViewDescriptor);
+			}
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to load texture " << paths[i].string() << ": " << e.what() << std::endl;
+		}
+
+		uploaded.emplace(keys[i], textures[i]);
+	}
+
+	return textures;
+}
+
+void TextureCache::SetByteBudget(size_t byteBudget) {
+	_cache.SetByteBudget(byteBudget);
+}
+
+size_t TextureCache::GetByteBudget() const {
+	return _cache.GetByteBudget();
+}
+
+size_t TextureCache::GetUsedBytes() const {
+	return _cache.GetUsedBytes();
+}
+
+size_t TextureCache::GetCount() const {
+	return _cache.GetCount();
+}
+
+Utils::LruCacheStatistics const& TextureCache::GetStatistics() const {
+	return _cache.GetStatistics();
+}
+
+void TextureCache::ReleaseUnused() {
+	_cache.Trim(0);
+}
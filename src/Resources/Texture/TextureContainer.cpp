@@ -0,0 +1,302 @@
+#include <bit>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+#include <Resources/Texture/TextureContainer.hpp>
+
+static_assert(std::endian::native == std::endian::little, "Texture containers are read and written as they are in memory.");
+
+namespace {
+	// Levels start on multiples of this, for the copies of the driver
+	constexpr uint64_t levelAlignment = 16;
+
+	// Far above what GPUs allow, and low enough for the sizes not to overflow
+	constexpr uint32_t maxDimension = 1 << 16;
+	constexpr uint32_t maxLayerCount = 1 << 12;
+
+	uint64_t Align(uint64_t value) {
+		return (value + levelAlignment - 1) / levelAlignment * levelAlignment;
+	}
+
+	uint32_t LevelDimension(uint32_t size, uint32_t level) {
+		return std::max(size >> level, 1u);
+	}
+
+	bool IsKnownFormat(TextureContainerFormat format) {
+		switch (format) {
+			case TextureContainerFormat::RGBA8Unorm:
+			case TextureContainerFormat::RGBA8UnormSrgb:
+			case TextureContainerFormat::BC1RGBAUnorm:
+			case TextureContainerFormat::BC1RGBAUnormSrgb:
+			case TextureContainerFormat::BC3RGBAUnorm:
+			case TextureContainerFormat::BC3RGBAUnormSrgb:
+			case TextureContainerFormat::BC7RGBAUnorm:
+			case TextureContainerFormat::BC7RGBAUnormSrgb:
+				return true;
+		}
+
+		return false;
+	}
+
+	uint64_t LayerSize(TextureContainerHeader const& header, uint32_t level) {
+		uint32_t width = LevelDimension(header.width, level);
+		uint32_t height = LevelDimension(header.height, level);
+		return static_cast<uint64_t>(TextureContainerRowSize(header.format, width)) * TextureContainerRowCount(header.format, height);
+	}
+
+	// Everything but the levels themselves
+	void CheckHeader(TextureContainerHeader const& header) {
+		if (!IsKnownFormat(header.format)) {
+			throw std::runtime_error("Unknown texture container format");
+		}
+
+		if (header.width == 0 || header.height == 0 || header.layerCount == 0) {
+			throw std::runtime_error("Empty texture container");
+		}
+
+		if (header.width > maxDimension || header.height > maxDimension || header.layerCount > maxLayerCount) {
+			throw std::runtime_error("Texture container too large");
+		}
+
+		if (header.levelCount == 0 || header.levelCount > static_cast<uint32_t>(std::bit_width(std::max(header.width, header.height)))) {
+			throw std::runtime_error("Invalid level count in texture container");
+		}
+
+		// Like WebGPU, only the smaller levels may have partial blocks
+		if (IsBlockCompressed(header.format) && (header.width % 4 != 0 || header.height % 4 != 0)) {
+			throw std::runtime_error("Block-compressed texture containers must have a size multiple of 4");
+		}
+
+		if ((header.flags & TextureContainerHeader::cubemapFlag) != 0 && (header.layerCount != 6 || header.width != header.height)) {
+			throw std::runtime_error("Cubemap texture containers must have 6 square layers");
+		}
+	}
+}
+
+uint32_t TextureContainerRowSize(TextureContainerFormat format, uint32_t width) {
+	if (IsBlockCompressed(format)) {
+		return BlockCount(width) * static_cast<uint32_t>(BlockBytes(GetBlockFormat(format)));
+	}
+
+	return 4 * width;
+}
+
+uint32_t TextureContainerRowCount(TextureContainerFormat format, uint32_t height) {
+	return IsBlockCompressed(format) ? BlockCount(height) : height;
+}
+
+bool IsBlockCompressed(TextureContainerFormat format) {
+	return format != TextureContainerFormat::RGBA8Unorm && format != TextureContainerFormat::RGBA8UnormSrgb;
+}
+
+BlockFormat GetBlockFormat(TextureContainerFormat format) {
+	switch (format) {
+		case TextureContainerFormat::BC1RGBAUnorm:
+		case TextureContainerFormat::BC1RGBAUnormSrgb:
+			return BlockFormat::BC1;
+
+		case TextureContainerFormat::BC3RGBAUnorm:
+		case TextureContainerFormat::BC3RGBAUnormSrgb:
+			return BlockFormat::BC3;
+
+		case TextureContainerFormat::BC7RGBAUnorm:
+		case TextureContainerFormat::BC7RGBAUnormSrgb:
+			return BlockFormat::BC7;
+
+		default:
+			throw std::runtime_error("Texture container format without blocks");
+	}
+}
+
+ColorSpace GetColorSpace(TextureContainerFormat format) {
+	switch (format) {
+		case TextureContainerFormat::RGBA8UnormSrgb:
+		case TextureContainerFormat::BC1RGBAUnormSrgb:
+		case TextureContainerFormat::BC3RGBAUnormSrgb:
+		case TextureContainerFormat::BC7RGBAUnormSrgb:
+			return ColorSpace::Srgb;
+
+		default:
+			return ColorSpace::Linear;
+	}
+}
+
+TextureContainerFormat GetContainerFormat(ColorSpace colorSpace) {
+	return colorSpace == ColorSpace::Srgb ? TextureContainerFormat::RGBA8UnormSrgb : TextureContainerFormat::RGBA8Unorm;
+}
+
+TextureContainerFormat GetContainerFormat(BlockFormat blockFormat, ColorSpace colorSpace) {
+	bool srgb = colorSpace == ColorSpace::Srgb;
+	switch (blockFormat) {
+		case BlockFormat::BC1:
+			return srgb ? TextureContainerFormat::BC1RGBAUnormSrgb : TextureContainerFormat::BC1RGBAUnorm;
+
+		case BlockFormat::BC3:
+			return srgb ? TextureContainerFormat::BC3RGBAUnormSrgb : TextureContainerFormat::BC3RGBAUnorm;
+
+		case BlockFormat::BC7:
+			return srgb ? TextureContainerFormat::BC7RGBAUnormSrgb : TextureContainerFormat::BC7RGBAUnorm;
+	}
+
+	throw std::runtime_error("Unknown block format");
+}
+
+// MARK: Reading
+TextureContainer::TextureContainer(std::filesystem::path const& path) : _file(path) {
+	std::string error = "Invalid texture container " + path.string() + ": ";
+
+	if (_file.Size() < sizeof(TextureContainerHeader)) {
+		throw std::runtime_error(error + "too small");
+	}
+
+	std::memcpy(&_header, _file.Data(), sizeof(TextureContainerHeader));
+	if (_header.identifier != TextureContainerHeader::magic) {
+		throw std::runtime_error(error + "not a texture container");
+	}
+
+	if (_header.version != TextureContainerHeader::currentVersion) {
+		throw std::runtime_error(error + "version " + std::to_string(_header.version) + " is not supported");
+	}
+
+	try {
+		CheckHeader(_header);
+	}
+
+	catch (std::exception const& e) {
+		throw std::runtime_error(error + e.what());
+	}
+
+	uint64_t fileSize = _file.Size();
+	if (sizeof(TextureContainerHeader) + static_cast<uint64_t>(_header.levelCount) * sizeof(TextureContainerLevel) > fileSize) {
+		throw std::runtime_error(error + "truncated level index");
+	}
+
+	_levels.resize(_header.levelCount);
+	std::memcpy(_levels.data(), _file.Data() + sizeof(TextureContainerHeader), _levels.size() * sizeof(TextureContainerLevel));
+
+	for (uint32_t level = 0; level < _header.levelCount; ++level) {
+		TextureContainerLevel const& entry = _levels[level];
+		if (entry.layerSize != LayerSize(_header, level)) {
+			throw std::runtime_error(error + "wrong size for level " + std::to_string(level));
+		}
+
+		// With the limits of the header, the product cannot overflow
+		if (entry.offset > fileSize || entry.layerSize * _header.layerCount > fileSize - entry.offset) {
+			throw std::runtime_error(error + "truncated level " + std::to_string(level));
+		}
+	}
+}
+
+TextureContainerFormat TextureContainer::GetFormat() const {
+	return _header.format;
+}
+
+uint32_t TextureContainer::GetWidth(uint32_t level) const {
+	return LevelDimension(_header.width, level);
+}
+
+uint32_t TextureContainer::GetHeight(uint32_t level) const {
+	return LevelDimension(_header.height, level);
+}
+
+uint32_t TextureContainer::GetLayerCount() const {
+	return _header.layerCount;
+}
+
+uint32_t TextureContainer::GetLevelCount() const {
+	return _header.levelCount;
+}
+
+bool TextureContainer::IsCubemap() const {
+	return (_header.flags & TextureContainerHeader::cubemapFlag) != 0;
+}
+
+uint8_t const* TextureContainer::GetData(uint32_t layer, uint32_t level) const {
+	return _file.Data() + _levels[level].offset + layer * _levels[level].layerSize;
+}
+
+size_t TextureContainer::GetSize(uint32_t level) const {
+	return static_cast<size_t>(_levels[level].layerSize);
+}
+
+// MARK: Writing
+TextureContainerWriter::TextureContainerWriter(TextureContainerFormat format, uint32_t width, uint32_t height, uint32_t layerCount, uint32_t levelCount, bool cubemap) {
+	_header.format = format;
+	_header.width = width;
+	_header.height = height;
+	_header.layerCount = layerCount;
+	_header.levelCount = levelCount;
+	_header.flags = cubemap ? TextureContainerHeader::cubemapFlag : 0;
+	CheckHeader(_header);
+
+	_data.resize(static_cast<size_t>(levelCount) * layerCount, nullptr);
+}
+
+void TextureContainerWriter::SetLevel(uint32_t layer, uint32_t level, uint8_t const* data, size_t size) {
+	if (layer >= _header.layerCount || level >= _header.levelCount) {
+		throw std::runtime_error("No such layer or level in the texture container");
+	}
+
+	if (size != LayerSize(_header, level)) {
+		throw std::runtime_error("Wrong size for level " + std::to_string(level) + " of the texture container");
+	}
+
+	_data[static_cast<size_t>(level) * _header.layerCount + layer] = data;
+}
+
+void TextureContainerWriter::Write(std::filesystem::path const& path) const {
+	if (std::find(_data.begin(), _data.end(), nullptr) != _data.end()) {
+		throw std::runtime_error("Missing level in texture container " + path.string());
+	}
+
+	// The smallest levels first, so that they are read first
+	std::vector<TextureContainerLevel> levels(_header.levelCount);
+	uint64_t offset = sizeof(TextureContainerHeader) + levels.size() * sizeof(TextureContainerLevel);
+	for (uint32_t level = _header.levelCount; level-- > 0;) {
+		levels[level].offset = Align(offset);
+		levels[level].layerSize = LayerSize(_header, level);
+		offset = levels[level].offset + levels[level].layerSize * _header.layerCount;
+	}
+
+	// Written next to the file then moved into place, so that a failed write
+	// never leaves a truncated container behind
+	std::filesystem::path temporary = path;
+	temporary += ".tmp";
+	try {
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("Failed to open " + temporary.string());
+		}
+
+		file.write(reinterpret_cast<char const*>(&_header), sizeof(TextureContainerHeader));
+		file.write(reinterpret_cast<char const*>(levels.data()), static_cast<std::streamsize>(levels.size() * sizeof(TextureContainerLevel)));
+
+		uint64_t position = sizeof(TextureContainerHeader) + levels.size() * sizeof(TextureContainerLevel);
+		char const padding[levelAlignment] {};
+		for (uint32_t level = _header.levelCount; level-- > 0;) {
+			file.write(padding, static_cast<std::streamsize>(levels[level].offset - position));
+			for (uint32_t layer = 0; layer < _header.layerCount; ++layer) {
+				file.write(reinterpret_cast<char const*>(_data[static_cast<size_t>(level) * _header.layerCount + layer]), static_cast<std::streamsize>(levels[level].layerSize));
+			}
+
+			position = levels[level].offset + levels[level].layerSize * _header.layerCount;
+		}
+
+		file.flush();
+		file.close();
+		if (file.fail()) {
+			throw std::runtime_error("Failed to write " + path.string());
+		}
+
+		std::filesystem::rename(temporary, path);
+	}
+
+	catch (...) {
+		std::error_code error {};
+		std::filesystem::remove(temporary, error);
+		throw;
+	}
+}
@@ -0,0 +1,101 @@
+#include <string>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <Utils/MappedFile.hpp>
+
+namespace Utils {
+	MappedFile::MappedFile(std::filesystem::path const& path) {
+		std::string error = "Failed to map " + path.string();
+
+#if defined(_WIN32)
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			throw std::runtime_error(error);
+		}
+
+		LARGE_INTEGER size {};
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			throw std::runtime_error(error);
+		}
+
+		_size = static_cast<size_t>(size.QuadPart);
+		if (_size != 0) {
+			// The view keeps the mapping and the file open
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping != nullptr) {
+				_data = static_cast<uint8_t const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				CloseHandle(mapping);
+			}
+		}
+
+		CloseHandle(file);
+#else
+		int file = open(path.c_str(), O_RDONLY);
+		if (file < 0) {
+			throw std::runtime_error(error);
+		}
+
+		struct stat status {};
+		if (fstat(file, &status) != 0) {
+			close(file);
+			throw std::runtime_error(error);
+		}
+
+		_size = static_cast<size_t>(status.st_size);
+		if (_size != 0) {
+			// The mapping keeps the file open
+			void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+			_data = data != MAP_FAILED ? static_cast<uint8_t const*>(data) : nullptr;
+		}
+
+		close(file);
+#endif
+
+		if (_size != 0 && _data == nullptr) {
+			_size = 0;
+			throw std::runtime_error(error);
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+
+	MappedFile::~MappedFile() {
+		Unmap();
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			Unmap();
+			_data = std::exchange(other._data, nullptr);
+			_size = std::exchange(other._size, 0);
+		}
+
+		return *this;
+	}
+
+	void MappedFile::Unmap() {
+		if (_data != nullptr) {
+#if defined(_WIN32)
+			UnmapViewOfFile(_data);
+#else
+			munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+		}
+
+		_data = nullptr;
+		_size = 0;
+	}
+}
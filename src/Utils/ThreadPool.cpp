@@ -0,0 +1,62 @@
+#include <algorithm>
+
+#include <Utils/ThreadPool.hpp>
+
+namespace Utils {
+	ThreadPool::ThreadPool(unsigned threadCount) {
+		threadCount = std::max(threadCount, 1u);
+
+		_threads.reserve(threadCount);
+		for (unsigned i = 0; i < threadCount; ++i) {
+			_threads.emplace_back(&ThreadPool::Run, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+
+		_condition.notify_all();
+		for (std::thread& thread : _threads) {
+			thread.join();
+		}
+	}
+
+	unsigned ThreadPool::GetThreadCount() const {
+		return static_cast<unsigned>(_threads.size());
+	}
+
+	size_t ThreadPool::GetQueuedCount() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _tasks.size();
+	}
+
+	void ThreadPool::Push(std::function<void()> task) {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_tasks.push_back(std::move(task));
+		}
+
+		_condition.notify_one();
+	}
+
+	void ThreadPool::Run() {
+		while (true) {
+			std::function<void()> task {};
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+				if (_tasks.empty()) {
+					return;
+				}
+
+				task = std::move(_tasks.front());
+				_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include <vector>
 #include <format>
 #include <memory>
+#include <optional>
 #include <cmath>
 #include <iomanip>
 #include <cstdint>
@@ -31,17 +32,19 @@
 
 #include <Resources/Texture/Texture2D.hpp>
 #include <Resources/Texture/Cubemap.hpp>
+#include <Resources/Buffer/StagingBelt.hpp>
+#include <Resources/Buffer/UniformArena.hpp>
 #include <Resources/Geometry/Geometry.hpp>
 
 #include <Logger.hpp>
 #include <Math/Math.hpp>
-#include <Math/Matrix3x3.hpp>
-#include <Math/Matrix4x4.hpp>
-#include <Math/Vector2.hpp>
-#include <Math/Vector3.hpp>
-#include <Math/Vector4.hpp>
+#include <Math/Matrix.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Transform3D.hpp>
+#include <Math/Vector.hpp>
 
 #include <Utils/StringView.hpp>
+#include <Utils/ThreadPool.hpp>
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
@@ -198,8 +201,12 @@ int main() {
 		vertexBufferLayouts.push_back(vertexBufferLayout);
 
 		// MARK: Cube binding layouts
+		// The uniforms of every draw are slices of a single buffer, bound with a
+		// dynamic offset
+		UniformArena uniformArena(device, 64 * 1024, sizeof(MyUniforms));
+
 		std::vector<BindGroupLayoutEntry> bindGroupLayoutEntries {};
-		bindGroupLayoutEntries.push_back(BufferBindingLayout(0, wgpu::ShaderStage::Vertex | wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Uniform, sizeof(MyUniforms)));
+		bindGroupLayoutEntries.push_back(uniformArena.LayoutEntry(0, wgpu::ShaderStage::Vertex | wgpu::ShaderStage::Fragment));
 		bindGroupLayoutEntries.push_back(TextureBindingLayout(1, wgpu::ShaderStage::Fragment, wgpu::TextureSampleType::Float));
 		bindGroupLayoutEntries[1].texture.viewDimension = wgpu::TextureViewDimension::Cube;
 		bindGroupLayoutEntries.push_back(SamplerBindingLayout(2, wgpu::ShaderStage::Fragment, wgpu::SamplerBindingType::Filtering));
@@ -215,11 +222,11 @@ int main() {
 		// int indexCount = static_cast<int>(vertexData.size());
 
 		// MARK: Cube binding handles
-		BufferDescriptor uniformBufferDescriptor(sizeof(MyUniforms), wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Uniform, "uniform_buffer");
-		Buffer uniformBuffer(device, uniformBufferDescriptor);
-
+		// The faces are sRGB images, sampled as linear colors, and compressed
+		// to BC1 when the GPU can sample it, as the skybox is opaque
+		wgpu::TextureFormat skyboxFormat = device.HasFeature(wgpu::FeatureName::TextureCompressionBC) ? wgpu::TextureFormat::BC1RGBAUnormSrgb : wgpu::TextureFormat::RGBA8UnormSrgb;
 		TextureDescriptor textureDescriptor(
-			wgpu::TextureFormat::RGBA8Unorm,
+			skyboxFormat,
 			wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding,
 			Extent3D((int) windowWidth, (int) windowHeight, 6));
 
@@ -229,28 +236,56 @@ int main() {
 
 		TextureViewDescriptor textureViewDescriptor(
 			wgpu::TextureAspect::All,
-			wgpu::TextureFormat::RGBA8Unorm);
+			skyboxFormat);
 		textureViewDescriptor.dimension = wgpu::TextureViewDimension::Cube;
 		textureViewDescriptor.baseArrayLayer = 0;
 		textureViewDescriptor.arrayLayerCount = 6;
 
+		// Decodes the images of the textures at the same time
+		Utils::ThreadPool threadPool {};
+
 		// Texture2D texture("resources/futuristic.png", device, queue, textureDescriptor, textureViewDescriptor);
 
-		Cubemap skyboxCubemap({ "resources/stars_px.jpg",
-							   "resources/stars_nx.jpg",
-							   "resources/stars_py.jpg",
-							   "resources/stars_ny.jpg",
-							   "resources/stars_pz.jpg",
-							   "resources/stars_nz.jpg" },
-			device, queue, textureDescriptor, textureViewDescriptor);
+		// The skybox cooked by "xmake run cook" is uploaded straight from its
+		// file, the faces are decoded and filtered here otherwise, or when the
+		// container cannot be loaded
+		std::filesystem::path cookedSkyboxPath = "resources/stars_cube.gstex";
+		std::optional<Cubemap> skyboxCubemap {};
+		if (std::filesystem::exists(cookedSkyboxPath)) {
+			try {
+				// The format and size are those of the container once it is loaded
+				TextureDescriptor cookedTextureDescriptor = textureDescriptor;
+				skyboxCubemap.emplace(TextureContainer(cookedSkyboxPath), device, queue, cookedTextureDescriptor, textureViewDescriptor);
+				textureDescriptor = cookedTextureDescriptor;
+			}
+
+			catch (std::exception const& e) {
+				logger.Error("Failed to load " + cookedSkyboxPath.string() + ", decoding the faces instead: " + e.what());
+			}
+		}
+
+		if (!skyboxCubemap.has_value()) {
+			skyboxCubemap.emplace(std::array<std::filesystem::path, 6> { "resources/stars_px.jpg",
+									  "resources/stars_nx.jpg",
+									  "resources/stars_py.jpg",
+									  "resources/stars_ny.jpg",
+									  "resources/stars_pz.jpg",
+									  "resources/stars_nz.jpg" },
+				device, queue, textureDescriptor, textureViewDescriptor, threadPool);
+		}
+
+		CubemapTimings const& timings = skyboxCubemap->Timings();
+		logger.Info(std::string("Skybox ") + (GetBlockFormat(textureDescriptor.format).has_value() ? "block-compressed" : "uncompressed"));
+		logger.Info("Skybox loaded in " + std::to_string(1000.0 * timings.total) + " ms (waiting for decoding " + std::to_string(1000.0 * timings.decoding) + " ms, seams " + std::to_string(1000.0 * timings.seams) + " ms, compression " + std::to_string(1000.0 * timings.compression) + " ms, uploads " + std::to_string(1000.0 * timings.uploads) + " ms)");
 
-		SamplerDescriptor samplerDescriptor(0.0f, 8.0f);
+		// Every level of the faces can be sampled
+		SamplerDescriptor samplerDescriptor(0.0f, static_cast<float>(textureDescriptor.mipLevelCount));
 		Sampler sampler(device, samplerDescriptor);
 
 		// MARK: Cube bindings array
 		std::vector<BindGroupEntry> bindGroupEntries {};
-		bindGroupEntries.push_back(BufferBinding(0, uniformBuffer, sizeof(MyUniforms), 0));
-		bindGroupEntries.push_back(TextureBinding(1, skyboxCubemap.View()));
+		bindGroupEntries.push_back(uniformArena.BindGroupEntry(0));
+		bindGroupEntries.push_back(TextureBinding(1, skyboxCubemap->View()));
 		bindGroupEntries.push_back(SamplerBinding(2, sampler));
 
 		BindGroupDescriptor bindGroupDescriptor(bindGroupLayouts[0], bindGroupEntries);
@@ -301,12 +336,12 @@ int main() {
 
 		float angleX = 0.0f;
 		float angleZ = 0.0f;
-		Math::Matrix4x4 view = Math::Matrix4x4::Identity();
+		Math::Transform3D view = Math::Transform3D::Identity();
 
 		// float time = 0.0f;
 
 		// MARK: Uniforms initialization
-		// Math::Matrix4x4 view = Math::Matrix4x4::LookAt(
+		// Math::Transform3D view = Math::Transform3D::LookAt(
 		//	cameraPosition,
 		//	Math::Vector3( 0.0f,  0.0f, 0.0f),
 		//	Math::Vector3( 0.0f,  1.0f, 0.0f)
@@ -317,12 +352,17 @@ int main() {
 		float near = 0.1f;
 		float far = 1000.0f;
 		Math::Matrix4x4 projection = Math::Matrix4x4::Perspective(vfov, ratio, near, far);
-		Math::Matrix4x4 viewProjection = projection * view;
+
+		// (projection * view)^-1 = view^-1 * projection^-1: the projection is only
+		// inverted once and the rigid view is inverted with a transpose every frame
+		Math::Matrix4x4 projectionInverse = Math::Matrix4x4::InverseProjection(projection);
 
 		MyUniforms uniforms = {
-			.viewDirectionProjectionInverse = Math::Matrix4x4::Transpose(Math::Matrix4x4::Inverse(viewProjection)) };
+			.viewDirectionProjectionInverse = Math::Matrix4x4::Transpose(Math::Transform3D::Inverse(view).ToMatrix4x4() * projectionInverse) };
 
-		queue->writeBuffer(uniformBuffer.Handle(), 0, &uniforms, sizeof(MyUniforms));
+		// The uniforms of every frame are copied from mapped chunks by the
+		// command encoder of the frame
+		StagingBelt stagingBelt(device, 64 * 1024);
 
 		bool const* keyboard = SDL_GetKeyboardState(nullptr);
 
@@ -403,20 +443,21 @@ int main() {
 			}
 
 			// MARK: Update
-			view = Math::Matrix4x4(Math::Matrix4x4::RotateX(angleX) * Math::Matrix4x4::RotateY(angleZ));
+			view = Math::Transform3D::Rotate(Math::Quaternion::RotateX(angleX) * Math::Quaternion::RotateY(angleZ));
 
 			TextureView textureView = std::move(GetNextTexture(window, adapter, device, surface));
 
 			// time = static_cast<float>(frameBegin) / 1000.0f;
 
-			viewProjection = projection * view;
-
-			uniforms.viewDirectionProjectionInverse = Math::Matrix4x4::Transpose(Math::Matrix4x4::Inverse(viewProjection));
-			queue->writeBuffer(uniformBuffer.Handle(), 0, &uniforms, sizeof(MyUniforms));
+			uniforms.viewDirectionProjectionInverse = Math::Matrix4x4::Transpose(Math::Transform3D::Inverse(view).ToMatrix4x4() * projectionInverse);
+			uniformArena.Reset();
+			uint32_t uniformOffset = uniformArena.Push(uniforms);
+			uniformArena.Upload(stagingBelt);
 
 			// MARK: Render
 			CommandEncoderDescriptor commandEncoderDescriptor;
 			CommandEncoder commandEncoder(device, commandEncoderDescriptor);
+			stagingBelt.Finish(commandEncoder);
 
 			std::vector<RenderPassColorAttachment> renderPassColorAttachments {};
 			renderPassColorAttachments.push_back(RenderPassColorAttachment(textureView));
@@ -430,7 +471,7 @@ int main() {
 
 			renderPassEncoder->setPipeline(cubeRenderPipeline.Handle());
 			// renderPassEncoder->setVertexBuffer(0, vertexBuffer.Handle(), 0, vertexData.size() * sizeof(VertexAttributes));
-			renderPassEncoder->setBindGroup(0, bindGroups[0].Handle(), 0, nullptr);
+			renderPassEncoder->setBindGroup(0, bindGroups[0].Handle(), 1, &uniformOffset);
 			renderPassEncoder->draw(3, 1, 0, 0);
 
 			renderPassEncoder->end();
@@ -439,6 +480,7 @@ int main() {
 			CommandBuffer commandBuffer(commandEncoder);
 
 			queue->submit(commandBuffer.Handle());
+			stagingBelt.Recall(queue);
 
 			surface->present();
 
@@ -0,0 +1,209 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/BVH.hpp>
+
+// Bumpy 48x48 grid, as a triangle soup, over [-12, 12] on x and z
+static std::vector<Math::Vector3> MakeTerrain() {
+	auto height = [](int i, int j) {
+		return std::sin(0.4f * static_cast<float>(i)) * std::cos(0.3f * static_cast<float>(j)) * 2.0f;
+	};
+
+	auto point = [&](int i, int j) {
+		return Math::Vector3(0.5f * static_cast<float>(i) - 12.0f, height(i, j), 0.5f * static_cast<float>(j) - 12.0f);
+	};
+
+	std::vector<Math::Vector3> positions {};
+	for (int i = 0; i < 48; ++i) {
+		for (int j = 0; j < 48; ++j) {
+			for (auto [di, dj] : { std::pair { 0, 0 }, std::pair { 1, 0 }, std::pair { 1, 1 }, std::pair { 0, 0 }, std::pair { 1, 1 }, std::pair { 0, 1 } }) {
+				positions.push_back(point(i + di, j + dj));
+			}
+		}
+	}
+
+	return positions;
+}
+
+// Closest hit by testing every triangle
+static float BruteForceRaycast(std::vector<Math::Vector3> const& positions, Math::Ray const& ray) {
+	float closest = std::numeric_limits<float>::infinity();
+	for (size_t t = 0; t < positions.size(); t += 3) {
+		Math::Vector3 edge1 = positions[t + 1] - positions[t];
+		Math::Vector3 edge2 = positions[t + 2] - positions[t];
+		Math::Vector3 p = Math::Vector3::Cross(ray.direction, edge2);
+		float determinant = Math::Vector3::Dot(edge1, p);
+		if (determinant == 0.0f) {
+			continue;
+		}
+
+		float inversedDeterminant = 1.0f / determinant;
+		Math::Vector3 s = ray.origin - positions[t];
+		float u = Math::Vector3::Dot(s, p) * inversedDeterminant;
+		Math::Vector3 q = Math::Vector3::Cross(s, edge1);
+		float v = Math::Vector3::Dot(ray.direction, q) * inversedDeterminant;
+		float distance = Math::Vector3::Dot(edge2, q) * inversedDeterminant;
+		if (u >= 0.0f && u <= 1.0f && v >= 0.0f && u + v <= 1.0f && distance >= 0.0f) {
+			closest = std::min(closest, distance);
+		}
+	}
+
+	return closest;
+}
+
+static Math::AABB TriangleBounds(std::vector<Math::Vector3> const& positions, size_t triangle) {
+	return Math::AABB::FromPoints(std::span(positions).subspan(3 * triangle, 3));
+}
+
+// MARK: Structure
+TEST_CASE("Structure of the hierarchy", "[bvh-structure]") {
+	std::vector<Math::Vector3> positions = MakeTerrain();
+	Math::BVH bvh = Math::BVH::Build(positions);
+
+	REQUIRE(bvh.GetTriangleCount() == positions.size() / 3);
+	REQUIRE(bvh.GetBounds() == Math::AABB::FromPoints(positions));
+
+	// Every triangle is in exactly one leaf and the children are inside their parent
+	auto nodes = bvh.GetNodes();
+	std::vector<int> seen(bvh.GetTriangleCount(), 0);
+	size_t invalidChildren = 0;
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		if (nodes[i].IsLeaf()) {
+			for (uint32_t t = nodes[i].offset; t < nodes[i].offset + nodes[i].count; ++t) {
+				++seen[t];
+			}
+
+			continue;
+		}
+
+		for (size_t child : { i + 1, static_cast<size_t>(nodes[i].offset) }) {
+			if (child >= nodes.size() || Math::AABB::Merge(nodes[i].bounds, nodes[child].bounds) != nodes[i].bounds) {
+				++invalidChildren;
+			}
+		}
+	}
+
+	REQUIRE(invalidChildren == 0);
+
+	REQUIRE(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+
+	SECTION("Parallel build", "[bvh-parallel]") {
+		Math::BVH parallel = Math::BVH::Build(positions, 4);
+		auto parallelNodes = parallel.GetNodes();
+
+		REQUIRE(parallelNodes.size() == nodes.size());
+		size_t mismatches = 0;
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			if (parallelNodes[i].bounds != nodes[i].bounds || parallelNodes[i].offset != nodes[i].offset || parallelNodes[i].count != nodes[i].count) {
+				++mismatches;
+			}
+		}
+
+		REQUIRE(mismatches == 0);
+	}
+
+	SECTION("Indexed triangles", "[bvh-indexed]") {
+		std::vector<Math::Vector3> vertices { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f } };
+		std::vector<uint32_t> indices { 0, 1, 2, 0, 2, 3 };
+		Math::BVH indexed = Math::BVH::Build(vertices, indices);
+
+		Math::RayHit hit {};
+		REQUIRE(indexed.Raycast(Math::Ray { Math::Vector3(0.25f, 1.0f, 0.75f), Math::Vector3(0.0f, -1.0f, 0.0f) }, hit));
+		REQUIRE(hit.triangle == 1);
+		REQUIRE(hit.distance == 1.0f);
+	}
+
+	SECTION("Empty mesh", "[bvh-empty]") {
+		Math::BVH empty = Math::BVH::Build(std::span<Math::Vector3 const>());
+		Math::RayHit hit {};
+		REQUIRE_FALSE(empty.Raycast(Math::Ray { Math::Vector3(0.0f), Math::Vector3(0.0f, -1.0f, 0.0f) }, hit));
+	}
+}
+
+// MARK: Ray queries
+TEST_CASE("Ray queries", "[bvh-raycast]") {
+	std::vector<Math::Vector3> positions = MakeTerrain();
+	Math::BVH bvh = Math::BVH::Build(positions);
+
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<float> coordinate(-15.0f, 15.0f);
+
+	int hitCount = 0;
+	for (int i = 0; i < 500; ++i) {
+		Math::Ray ray { Math::Vector3(coordinate(generator), 5.0f, coordinate(generator)), Math::Vector3(0.3f * coordinate(generator), -10.0f, 0.3f * coordinate(generator)) };
+
+		float expected = BruteForceRaycast(positions, ray);
+		Math::RayHit hit {};
+		bool found = bvh.Raycast(ray, hit);
+
+		REQUIRE(found == std::isfinite(expected));
+		if (found) {
+			REQUIRE(hit.distance == expected);
+
+			// The hit point is on the reported triangle
+			Math::Vector3 const* triangle = &positions[3 * hit.triangle];
+			Math::Vector3 point = ray.origin + ray.direction * hit.distance;
+			Math::Vector3 interpolated = triangle[0] * (1.0f - hit.u - hit.v) + triangle[1] * hit.u + triangle[2] * hit.v;
+			REQUIRE(Math::Vector3::Magnitude(point - interpolated) < 1.0e-3f);
+			++hitCount;
+		}
+	}
+
+	REQUIRE(hitCount > 100);
+	REQUIRE(hitCount < 500);
+
+	// Limited distance
+	Math::Ray down { Math::Vector3(0.1f, 5.0f, 0.2f), Math::Vector3(0.0f, -1.0f, 0.0f) };
+	Math::RayHit hit {};
+	REQUIRE(bvh.Raycast(down, hit));
+	REQUIRE_FALSE(bvh.Raycast(down, hit, hit.distance * 0.5f));
+}
+
+// MARK: Volume queries
+TEST_CASE("Box and frustum queries", "[bvh-query]") {
+	std::vector<Math::Vector3> positions = MakeTerrain();
+	Math::BVH bvh = Math::BVH::Build(positions);
+
+	SECTION("Box", "[bvh-query-box]") {
+		Math::AABB box { Math::Vector3(-3.0f, -0.5f, 1.0f), Math::Vector3(2.0f, 0.5f, 4.0f) };
+
+		std::vector<uint32_t> expected {};
+		for (size_t t = 0; t < positions.size() / 3; ++t) {
+			if (TriangleBounds(positions, t).Intersects(box)) {
+				expected.push_back(static_cast<uint32_t>(t));
+			}
+		}
+
+		std::vector<uint32_t> triangles {};
+		bvh.Query(box, triangles);
+		std::sort(triangles.begin(), triangles.end());
+
+		REQUIRE(!expected.empty());
+		REQUIRE(triangles == expected);
+	}
+
+	SECTION("Frustum", "[bvh-query-frustum]") {
+		Math::Matrix4x4 view = Math::Matrix4x4::LookAt(Math::Vector3(0.0f, 6.0f, -20.0f), Math::Vector3(2.0f, 0.0f, 0.0f), Math::Vector3(0.0f, 1.0f, 0.0f));
+		Math::Frustum frustum(Math::Matrix4x4::Perspective(0.6f, 1.0f, 0.1f, 100.0f) * view);
+
+		std::vector<uint32_t> expected {};
+		for (size_t t = 0; t < positions.size() / 3; ++t) {
+			if (frustum.Intersects(TriangleBounds(positions, t))) {
+				expected.push_back(static_cast<uint32_t>(t));
+			}
+		}
+
+		std::vector<uint32_t> triangles {};
+		bvh.Query(frustum, triangles);
+		std::sort(triangles.begin(), triangles.end());
+
+		REQUIRE(!expected.empty());
+		REQUIRE(expected.size() < positions.size() / 3);
+		REQUIRE(triangles == expected);
+	}
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Batch.hpp>
+
+static Math::Matrix4x4 const transform =
+	Math::Matrix4x4::Translate(1.5f, -2.0f, 0.25f) *
+	Math::Matrix4x4::RotateY(0.7f) *
+	Math::Matrix4x4::Scale(2.0f, 0.5f, 3.0f);
+
+// 11 elements: two SIMD blocks and a scalar tail
+static std::vector<Math::Vector3> MakePoints() {
+	std::vector<Math::Vector3> points {};
+	for (int i = 0; i < 11; ++i) {
+		points.emplace_back(0.5f * i, 1.0f - 0.25f * i, -3.0f + 0.75f * i);
+	}
+
+	return points;
+}
+
+static Math::Vector3 Xyz(Math::Vector4 const& v) {
+	return Math::Vector3(v.x, v.y, v.z);
+}
+
+// MARK: Points and directions
+TEST_CASE("Transforming arrays of 3D vectors", "[batch-vector3]") {
+	std::vector<Math::Vector3> points = MakePoints();
+	std::vector<Math::Vector3> result(points.size());
+
+	SECTION("Transforming points", "[batch-points]") {
+		Math::TransformPoints(transform, points, result);
+		for (size_t i = 0; i < points.size(); ++i) {
+			REQUIRE(result[i] == Xyz(transform * Math::Vector4(points[i], 1.0f)));
+		}
+	}
+
+	SECTION("Transforming directions", "[batch-directions]") {
+		Math::TransformDirections(transform, points, result);
+		for (size_t i = 0; i < points.size(); ++i) {
+			REQUIRE(result[i] == Xyz(transform * Math::Vector4(points[i], 0.0f)));
+		}
+	}
+
+	SECTION("Transforming points in place with several threads", "[batch-points-threads]") {
+		std::vector<Math::Vector3> inPlace = points;
+		Math::TransformPoints(transform, inPlace, inPlace, 3);
+		Math::TransformPoints(transform, points, result);
+		REQUIRE(inPlace == result);
+	}
+
+	SECTION("Transforming points stored as structure of arrays", "[batch-points-soa]") {
+		std::vector<float> x {};
+		std::vector<float> y {};
+		std::vector<float> z {};
+		for (auto const& point : points) {
+			x.push_back(point.x);
+			y.push_back(point.y);
+			z.push_back(point.z);
+		}
+
+		Math::TransformPoints(transform, Math::ConstVector3SoA { x, y, z }, Math::Vector3SoA { x, y, z }, 2);
+		for (size_t i = 0; i < points.size(); ++i) {
+			REQUIRE(Math::Vector3(x[i], y[i], z[i]) == Xyz(transform * Math::Vector4(points[i], 1.0f)));
+		}
+	}
+}
+
+// MARK: 4D vectors
+TEST_CASE("Transforming arrays of 4D vectors", "[batch-vector4]") {
+	std::vector<Math::Vector4> vectors {};
+	for (auto const& point : MakePoints()) {
+		vectors.emplace_back(point, 0.5f);
+	}
+
+	std::vector<Math::Vector4> result(vectors.size());
+	Math::TransformVectors(transform, vectors, result, 4);
+	for (size_t i = 0; i < vectors.size(); ++i) {
+		REQUIRE(result[i] == transform * vectors[i]);
+	}
+}
+
+// MARK: Matrices
+TEST_CASE("Multiplying arrays of matrices", "[batch-matrices]") {
+	std::vector<Math::Matrix4x4> models {};
+	for (int i = 0; i < 9; ++i) {
+		models.push_back(Math::Matrix4x4::RotateX(0.1f * i) * Math::Matrix4x4::Translate(float(i), 0.0f, -float(i)));
+	}
+
+	std::vector<Math::Matrix4x4> result(models.size());
+
+	SECTION("Multiplying one matrix by an array", "[batch-matrices-broadcast]") {
+		Math::MultiplyMatrices(transform, models, result, 2);
+		for (size_t i = 0; i < models.size(); ++i) {
+			REQUIRE(result[i] == transform * models[i]);
+		}
+	}
+
+	SECTION("Multiplying two arrays element-wise in place", "[batch-matrices-pairwise]") {
+		result = models;
+		Math::MultiplyMatrices(result, models, result);
+		for (size_t i = 0; i < models.size(); ++i) {
+			REQUIRE(result[i] == models[i] * models[i]);
+		}
+	}
+}
@@ -0,0 +1,218 @@
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+
+// Like most of a photo: detail in the luminance, and colors that change
+// slowly across the image. Alpha follows the luminance.
+static std::vector<uint8_t> MakeSmoothImage(uint32_t width, uint32_t height) {
+	std::vector<uint8_t> pixels(4 * static_cast<size_t>(width) * height);
+	for (uint32_t y = 0; y < height; ++y) {
+		for (uint32_t x = 0; x < width; ++x) {
+			float luminance = 127.5f + 100.0f * std::sin(0.15f * static_cast<float>(x)) * std::cos(0.1f * static_cast<float>(y));
+			float tint = 30.0f * static_cast<float>(x) / static_cast<float>(width);
+
+			uint8_t* pixel = &pixels[4 * (static_cast<size_t>(y) * width + x)];
+			pixel[0] = static_cast<uint8_t>(luminance);
+			pixel[1] = static_cast<uint8_t>(0.8f * luminance + tint);
+			pixel[2] = static_cast<uint8_t>(0.5f * luminance + 40.0f - tint);
+			pixel[3] = static_cast<uint8_t>(255.0f - luminance / 2.0f);
+		}
+	}
+
+	return pixels;
+}
+
+// Mean squared error of the channels from firstChannel to lastChannel
+static double MeanSquaredError(std::vector<uint8_t> const& a, std::vector<uint8_t> const& b, uint32_t firstChannel, uint32_t lastChannel) {
+	double sum = 0.0;
+	size_t count = 0;
+	for (size_t i = 0; i < a.size(); ++i) {
+		if (i % 4 >= firstChannel && i % 4 <= lastChannel) {
+			double delta = static_cast<double>(a[i]) - static_cast<double>(b[i]);
+			sum += delta * delta;
+			++count;
+		}
+	}
+
+	return sum / static_cast<double>(count);
+}
+
+static std::vector<uint8_t> RoundTrip(std::vector<uint8_t> const& image, uint32_t width, uint32_t height, BlockFormat format, unsigned threadCount = 1) {
+	std::vector<uint8_t> blocks(CompressedSize(format, width, height));
+	CompressRGBA8(image.data(), width, height, blocks.data(), format, threadCount);
+
+	std::vector<uint8_t> decoded(image.size());
+	DecompressRGBA8(blocks.data(), width, height, decoded.data(), format);
+	return decoded;
+}
+
+// MARK: Sizes
+TEST_CASE("Block sizes", "[block-compression]") {
+	REQUIRE(BlockBytes(BlockFormat::BC1) == 8);
+	REQUIRE(BlockBytes(BlockFormat::BC3) == 16);
+	REQUIRE(BlockBytes(BlockFormat::BC7) == 16);
+
+	REQUIRE(BlockCount(1) == 1);
+	REQUIRE(BlockCount(4) == 1);
+	REQUIRE(BlockCount(5) == 2);
+
+	REQUIRE(CompressedSize(BlockFormat::BC1, 1, 1) == 8);
+	REQUIRE(CompressedSize(BlockFormat::BC1, 4096, 4096) == 4096 * 4096 / 2);
+	REQUIRE(CompressedSize(BlockFormat::BC7, 5, 9) == 2 * 3 * 16);
+}
+
+// MARK: Blocks
+TEST_CASE("Block compression", "[block-compression]") {
+	SECTION("Solid colors", "[block-compression-solid]") {
+		// Exact in 5:6:5, and an alpha that BC3 keeps as it is
+		std::vector<uint8_t> image {};
+		for (uint32_t i = 0; i < 16; ++i) {
+			image.insert(image.end(), { 255, 130, 0, 77 });
+		}
+
+		std::vector<uint8_t> bc1 = RoundTrip(image, 4, 4, BlockFormat::BC1);
+		std::vector<uint8_t> bc3 = RoundTrip(image, 4, 4, BlockFormat::BC3);
+		std::vector<uint8_t> bc7 = RoundTrip(image, 4, 4, BlockFormat::BC7);
+		for (uint32_t pixel = 0; pixel < 16; ++pixel) {
+			REQUIRE(bc1[4 * pixel + 0] == 255);
+			REQUIRE(bc1[4 * pixel + 1] == 130);
+			REQUIRE(bc1[4 * pixel + 2] == 0);
+			REQUIRE(bc1[4 * pixel + 3] == 255);
+
+			REQUIRE(std::vector<uint8_t>(bc3.begin() + 4 * pixel, bc3.begin() + 4 * pixel + 4) == std::vector<uint8_t> { 255, 130, 0, 77 });
+
+			for (uint32_t channel = 0; channel < 4; ++channel) {
+				REQUIRE(std::abs(bc7[4 * pixel + channel] - image[4 * pixel + channel]) <= 1);
+			}
+		}
+	}
+
+	SECTION("Two colors", "[block-compression-two-colors]") {
+		// Every format can store the 2 colors of a block exactly when they
+		// are endpoints it can represent
+		std::vector<uint8_t> image {};
+		for (uint32_t i = 0; i < 16; ++i) {
+			if (i % 3 == 0) {
+				image.insert(image.end(), { 0, 0, 0, 0 });
+			}
+
+			else {
+				image.insert(image.end(), { 255, 255, 255, 255 });
+			}
+		}
+
+		std::vector<uint8_t> bc1 = RoundTrip(image, 4, 4, BlockFormat::BC1);
+		std::vector<uint8_t> bc3 = RoundTrip(image, 4, 4, BlockFormat::BC3);
+		std::vector<uint8_t> bc7 = RoundTrip(image, 4, 4, BlockFormat::BC7);
+		REQUIRE(MeanSquaredError(bc1, image, 0, 2) == 0.0);
+		REQUIRE(MeanSquaredError(bc3, image, 0, 3) == 0.0);
+		REQUIRE(MeanSquaredError(bc7, image, 0, 3) == 0.0);
+	}
+
+	SECTION("Bit layout", "[block-compression-layout]") {
+		std::vector<uint8_t> image = MakeSmoothImage(4, 4);
+
+		// BC1 in the 4 color mode: color0 > color1
+		std::vector<uint8_t> bc1(8);
+		CompressRGBA8(image.data(), 4, 4, bc1.data(), BlockFormat::BC1);
+		REQUIRE((bc1[0] | (bc1[1] << 8)) > (bc1[2] | (bc1[3] << 8)));
+
+		// BC3 in the 8 alpha mode: alpha0 > alpha1
+		std::vector<uint8_t> bc3(16);
+		CompressRGBA8(image.data(), 4, 4, bc3.data(), BlockFormat::BC3);
+		REQUIRE(bc3[0] > bc3[1]);
+
+		// BC7 mode 6: 6 zeros and a one
+		std::vector<uint8_t> bc7(16);
+		CompressRGBA8(image.data(), 4, 4, bc7.data(), BlockFormat::BC7);
+		REQUIRE((bc7[0] & 0x7f) == 0x40);
+	}
+
+	SECTION("Quality", "[block-compression-quality]") {
+		std::vector<uint8_t> image = MakeSmoothImage(64, 64);
+
+		double bc1 = MeanSquaredError(RoundTrip(image, 64, 64, BlockFormat::BC1), image, 0, 2);
+		double bc3 = MeanSquaredError(RoundTrip(image, 64, 64, BlockFormat::BC3), image, 0, 2);
+		double bc7 = MeanSquaredError(RoundTrip(image, 64, 64, BlockFormat::BC7), image, 0, 2);
+
+		// About 40 dB for BC1 and above 45 dB for BC7
+		REQUIRE(bc1 < 8.0);
+		REQUIRE(bc3 == bc1);
+		REQUIRE(bc7 < 2.0);
+		REQUIRE(bc7 < bc1);
+
+		// BC1 is opaque, BC3 and BC7 keep alpha
+		std::vector<uint8_t> bc1Decoded = RoundTrip(image, 64, 64, BlockFormat::BC1);
+		REQUIRE(bc1Decoded[3] == 255);
+		REQUIRE(MeanSquaredError(RoundTrip(image, 64, 64, BlockFormat::BC3), image, 3, 3) < 1.0);
+		REQUIRE(MeanSquaredError(RoundTrip(image, 64, 64, BlockFormat::BC7), image, 3, 3) < 2.0);
+	}
+
+	SECTION("Partial blocks", "[block-compression-partial]") {
+		// The pixels outside the image repeat the borders, so a block of a
+		// single color stays exact
+		std::vector<uint8_t> image {};
+		for (uint32_t i = 0; i < 7 * 5; ++i) {
+			image.insert(image.end(), { 8, 4, 8, 255 });
+		}
+
+		for (BlockFormat format : { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC7 }) {
+			std::vector<uint8_t> blocks(CompressedSize(format, 7, 5));
+			CompressRGBA8(image.data(), 7, 5, blocks.data(), format);
+
+			// Only the pixels of the image are written
+			std::vector<uint8_t> decoded(image.size() + 4, 42);
+			DecompressRGBA8(blocks.data(), 7, 5, decoded.data(), format);
+			REQUIRE(decoded.back() == 42);
+
+			decoded.resize(image.size());
+			REQUIRE(MeanSquaredError(decoded, image, 0, 2) <= 1.0);
+		}
+	}
+
+	SECTION("Threads", "[block-compression-threads]") {
+		std::vector<uint8_t> image = MakeSmoothImage(300, 260);
+		for (BlockFormat format : { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC7 }) {
+			std::vector<uint8_t> single(CompressedSize(format, 300, 260));
+			std::vector<uint8_t> threaded(single.size());
+			CompressRGBA8(image.data(), 300, 260, single.data(), format, 1);
+			CompressRGBA8(image.data(), 300, 260, threaded.data(), format, 4);
+			REQUIRE(single == threaded);
+		}
+	}
+}
+
+// MARK: Mip chains
+TEST_CASE("Block-compressed mip chains", "[block-compression-chain]") {
+	std::vector<uint8_t> image = MakeSmoothImage(32, 16);
+	MipChain chain(image.data(), 32, 16);
+	BlockCompressedChain compressed(chain, BlockFormat::BC7);
+
+	REQUIRE(compressed.GetFormat() == BlockFormat::BC7);
+	REQUIRE(compressed.GetLevelCount() == chain.GetLevelCount());
+
+	size_t offset = 0;
+	for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+		MipChain::Level const& mipLevel = chain.GetLevel(level);
+		REQUIRE(compressed.GetLevel(level).width == mipLevel.width);
+		REQUIRE(compressed.GetLevel(level).height == mipLevel.height);
+		REQUIRE(compressed.GetLevel(level).offset == offset);
+		REQUIRE(compressed.GetSize(level) == CompressedSize(BlockFormat::BC7, mipLevel.width, mipLevel.height));
+		REQUIRE(static_cast<size_t>(compressed.GetRowSize(level)) * compressed.GetRowCount(level) == compressed.GetSize(level));
+
+		std::vector<uint8_t> blocks(compressed.GetSize(level));
+		CompressRGBA8(chain.GetData(level), mipLevel.width, mipLevel.height, blocks.data(), BlockFormat::BC7);
+		REQUIRE(std::vector<uint8_t>(compressed.GetData(level), compressed.GetData(level) + compressed.GetSize(level)) == blocks);
+
+		offset += compressed.GetSize(level);
+	}
+
+	// 1x1 levels are still whole blocks
+	REQUIRE(compressed.GetSize(chain.GetLevelCount() - 1) == 16);
+}
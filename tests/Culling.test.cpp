@@ -0,0 +1,162 @@
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Culling.hpp>
+
+static Math::Matrix4x4 const view = Math::Matrix4x4::LookAt(Math::Vector3(2.0f, 1.0f, -10.0f), Math::Vector3(0.0f), Math::Vector3(0.0f, 1.0f, 0.0f));
+static Math::Matrix4x4 const projection = Math::Matrix4x4::Perspective(1.0471975f, 16.0f / 9.0f, 0.1f, 100.0f);
+
+// 1003 elements: several blocks of 8 and a scalar tail, spread around the
+// frustum so that some are inside, some outside and some across its planes
+static std::vector<Math::AABB> MakeBoxes() {
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> size(0.1f, 8.0f);
+
+	std::vector<Math::AABB> boxes {};
+	for (int i = 0; i < 1003; ++i) {
+		Math::Vector3 min(position(generator), position(generator), position(generator));
+		boxes.push_back(Math::AABB { min, min + Math::Vector3(size(generator), size(generator), size(generator)) });
+	}
+
+	return boxes;
+}
+
+// MARK: Bounds
+TEST_CASE("Construction of bounding volumes", "[bounds]") {
+	std::vector<Math::Vector3> points { { 1.0f, -2.0f, 3.0f }, { -1.0f, 4.0f, 0.5f }, { 0.0f, 0.0f, 5.0f } };
+
+	SECTION("Bounding box of points", "[bounds-aabb]") {
+		Math::AABB box = Math::AABB::FromPoints(points);
+		REQUIRE(box == Math::AABB { Math::Vector3(-1.0f, -2.0f, 0.5f), Math::Vector3(1.0f, 4.0f, 5.0f) });
+		REQUIRE(box.Center() == Math::Vector3(0.0f, 1.0f, 2.75f));
+		REQUIRE(box.Extents() == Math::Vector3(1.0f, 3.0f, 2.25f));
+
+		constexpr Math::AABB merged = Math::AABB::Merge(Math::AABB { Math::Vector3(0.0f), Math::Vector3(1.0f) }, Math::AABB { Math::Vector3(-1.0f, 0.5f, 0.5f), Math::Vector3(0.5f, 2.0f, 0.5f) });
+		CONSTEXPR_REQUIRE(merged == Math::AABB { Math::Vector3(-1.0f, 0.0f, 0.0f), Math::Vector3(1.0f, 2.0f, 1.0f) });
+	}
+
+	SECTION("Transformed bounding box", "[bounds-aabb-transform]") {
+		Math::Matrix4x4 m = Math::Matrix4x4::Translate(3.0f, 0.0f, -1.0f) * Math::Matrix4x4::RotateY(0.6f) * Math::Matrix4x4::Scale(2.0f, 1.0f, 0.5f);
+		Math::AABB box { Math::Vector3(-1.0f, -2.0f, 0.5f), Math::Vector3(1.0f, 4.0f, 5.0f) };
+
+		std::vector<Math::Vector3> corners {};
+		for (int i = 0; i < 8; ++i) {
+			Math::Vector4 corner(i & 1 ? box.max.x : box.min.x, i & 2 ? box.max.y : box.min.y, i & 4 ? box.max.z : box.min.z, 1.0f);
+			Math::Vector4 transformed = m * corner;
+			corners.emplace_back(transformed.x, transformed.y, transformed.z);
+		}
+
+		Math::AABB expected = Math::AABB::FromPoints(corners);
+		Math::AABB transformed = Math::AABB::Transform(m, box);
+		for (size_t i = 0; i < 3; ++i) {
+			REQUIRE(std::abs(transformed.min[i] - expected.min[i]) < 1.0e-5f);
+			REQUIRE(std::abs(transformed.max[i] - expected.max[i]) < 1.0e-5f);
+		}
+	}
+
+	SECTION("Bounding sphere", "[bounds-sphere]") {
+		Math::BoundingSphere sphere = Math::BoundingSphere::FromPoints(points);
+		for (auto const& point : points) {
+			REQUIRE(sphere.Contains(point));
+		}
+
+		Math::BoundingSphere transformed = Math::BoundingSphere::Transform(Math::Matrix4x4::Translate(1.0f, 2.0f, 3.0f) * Math::Matrix4x4::Scale(1.0f, 3.0f, 2.0f), sphere);
+		REQUIRE(std::abs(transformed.radius - 3.0f * sphere.radius) < 1.0e-5f);
+	}
+}
+
+// MARK: Frustum
+TEST_CASE("Frustum of a view-projection matrix", "[frustum]") {
+	Math::Frustum frustum(projection * view);
+
+	SECTION("Points", "[frustum-points]") {
+		REQUIRE(frustum.Contains(Math::Vector3(0.0f)));
+		REQUIRE(frustum.Contains(Math::Vector3(2.0f, 1.0f, -9.85f)));
+		REQUIRE_FALSE(frustum.Contains(Math::Vector3(2.0f, 1.0f, -9.95f)));
+		REQUIRE_FALSE(frustum.Contains(Math::Vector3(2.0f, 1.0f, -11.0f)));
+		REQUIRE_FALSE(frustum.Contains(Math::Vector3(-2.0f, -1.0f, 100.0f)));
+	}
+
+	SECTION("Planes give distances", "[frustum-planes]") {
+		for (auto const& plane : frustum.GetPlanes()) {
+			REQUIRE(std::abs(Math::Vector3::Magnitude(Math::Vector3(plane.x, plane.y, plane.z)) - 1.0f) < 1.0e-5f);
+		}
+
+		// The origin is sqrt(105) units in front of the camera
+		Math::Vector4 const& near = frustum.GetPlanes()[Math::Frustum::Near];
+		REQUIRE(std::abs(near.w - (std::sqrt(105.0f) - 0.1f)) < 1.0e-4f);
+	}
+
+	SECTION("Bounds", "[frustum-bounds]") {
+		REQUIRE(frustum.Intersects(Math::AABB { Math::Vector3(-1.0f), Math::Vector3(1.0f) }));
+		REQUIRE(frustum.Intersects(Math::AABB { Math::Vector3(-100.0f), Math::Vector3(100.0f) }));
+		REQUIRE_FALSE(frustum.Intersects(Math::AABB { Math::Vector3(0.0f, 0.0f, -30.0f), Math::Vector3(1.0f, 1.0f, -20.0f) }));
+		REQUIRE(frustum.Intersects(Math::BoundingSphere { Math::Vector3(2.0f, 1.0f, -12.0f), 2.5f }));
+		REQUIRE_FALSE(frustum.Intersects(Math::BoundingSphere { Math::Vector3(2.0f, 1.0f, -12.0f), 1.5f }));
+	}
+
+	SECTION("Reversed-Z and infinite projections", "[frustum-reversed-z]") {
+		Math::Frustum reversed(Math::Matrix4x4::Perspective(1.0471975f, 16.0f / 9.0f, 0.1f, 100.0f, true) * view);
+		Math::Frustum infinite(Math::Matrix4x4::Perspective(1.0471975f, 16.0f / 9.0f, 0.1f, std::numeric_limits<float>::infinity(), true) * view);
+
+		for (auto const& box : MakeBoxes()) {
+			REQUIRE(reversed.Intersects(box) == frustum.Intersects(box));
+		}
+
+		REQUIRE_FALSE(frustum.Contains(Math::Vector3(-2.0f, -1.0f, 100.0f)));
+		REQUIRE(infinite.Contains(Math::Vector3(-2.0f, -1.0f, 100.0f)));
+		REQUIRE(infinite.Contains(Math::Vector3(-20.0f, -10.0f, 1.0e6f)));
+	}
+}
+
+// MARK: Batch culling
+TEST_CASE("Culling arrays of bounds", "[culling]") {
+	Math::Frustum frustum(projection * view);
+	std::vector<Math::AABB> boxes = MakeBoxes();
+
+	SECTION("Boxes", "[culling-boxes]") {
+		std::vector<uint8_t> visible(boxes.size());
+		Math::CullBoxes(frustum, boxes, visible);
+
+		size_t visibleCount = 0;
+		for (size_t i = 0; i < boxes.size(); ++i) {
+			REQUIRE((visible[i] != 0) == frustum.Intersects(boxes[i]));
+			visibleCount += visible[i];
+		}
+
+		// Both outcomes must be covered for the comparison to mean something
+		REQUIRE(visibleCount > 10);
+		REQUIRE(visibleCount < boxes.size() - 10);
+	}
+
+	SECTION("Spheres", "[culling-spheres]") {
+		std::vector<Math::BoundingSphere> spheres {};
+		for (auto const& box : boxes) {
+			spheres.push_back(Math::BoundingSphere::FromAABB(box));
+		}
+
+		std::vector<uint8_t> visible(spheres.size());
+		Math::CullSpheres(frustum, spheres, visible);
+		for (size_t i = 0; i < spheres.size(); ++i) {
+			REQUIRE((visible[i] != 0) == frustum.Intersects(spheres[i]));
+		}
+	}
+
+	SECTION("Indices with several threads", "[culling-threads]") {
+		std::vector<uint32_t> expected {};
+		for (size_t i = 0; i < boxes.size(); ++i) {
+			if (frustum.Intersects(boxes[i])) {
+				expected.push_back(static_cast<uint32_t>(i));
+			}
+		}
+
+		std::vector<uint32_t> indices { 7, 8, 9 };
+		REQUIRE(Math::CullBoxes(frustum, boxes, indices, 5) == expected.size());
+		REQUIRE(indices == expected);
+	}
+}
@@ -0,0 +1,69 @@
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Geometry/GeometryParser.hpp>
+
+// MARK: Geometry parser
+TEST_CASE("Geometry parser", "[geometry-parser]") {
+	SECTION("Points and indices", "[geometry-parser-sections]") {
+		std::string text =
+			"# Two triangles\r\n"
+			"[points]\r\n"
+			"-0.5 -0.5 0.0 1.0 0.0 0.0\r\n"
+			"0.5\t-0.5 0.0 0.0 1.0 0.0  \r\n"
+			"\r\n"
+			"0.5 0.5 0.0 0.0 0.0 1.0\n"
+			"-0.5 0.5 0.0 1e-1 0.25 0.5\n"
+			"[indices]\n"
+			"0 1 2\n"
+			"# Second triangle\n"
+			"0 2 3";
+
+		std::vector<float> pointData {};
+		std::vector<uint32_t> indexData {};
+		REQUIRE(ParseGeometry(text, pointData, indexData, 3));
+		REQUIRE(pointData.size() == 4 * 6);
+		REQUIRE(pointData[0] == -0.5f);
+		REQUIRE(pointData[7] == -0.5f);
+		REQUIRE(pointData[22] == 0.25f);
+		REQUIRE(pointData[21] == 0.1f);
+		REQUIRE(indexData == std::vector<uint32_t> { 0, 1, 2, 0, 2, 3 });
+
+		// Indented comments and section headers
+		REQUIRE(ParseGeometry("  [indices]\n\t# Comment\n  # Comment\n 4 5 6\n", pointData, indexData, 3));
+		REQUIRE(indexData == std::vector<uint32_t> { 4, 5, 6 });
+
+		// 2D points, the color after the 2 coordinates
+		REQUIRE(ParseGeometry("[points]\n1 2 0.1 0.2 0.3\n", pointData, indexData, 2));
+		REQUIRE(pointData.size() == 5);
+		REQUIRE(indexData.empty());
+	}
+
+	SECTION("32-bit indices", "[geometry-parser-indices]") {
+		std::vector<float> pointData {};
+		std::vector<uint32_t> indexData {};
+		REQUIRE(ParseGeometry("[indices]\n70000 65536 4000000000\n", pointData, indexData, 3));
+		REQUIRE(indexData == std::vector<uint32_t> { 70000, 65536, 4000000000u });
+	}
+
+	SECTION("Malformed lines", "[geometry-parser-malformed]") {
+		std::vector<float> pointData {};
+		std::vector<uint32_t> indexData {};
+		REQUIRE_FALSE(ParseGeometry("[points]\n0.0 1.0\n", pointData, indexData, 3));
+		REQUIRE_FALSE(ParseGeometry("[indices]\n0 1 x\n", pointData, indexData, 3));
+		REQUIRE_FALSE(ParseGeometry("[indices]\n0 -1 2\n", pointData, indexData, 3));
+
+		// Nothing of the lines read before the malformed one
+		REQUIRE_FALSE(ParseGeometry("[points]\n0 0 0 1 1 1\n[indices]\n0 0 0\n0 1\n", pointData, indexData, 3));
+		REQUIRE(pointData.empty());
+		REQUIRE(indexData.empty());
+
+		// Nothing outside of the sections
+		REQUIRE(ParseGeometry("0 1 2\n", pointData, indexData, 3));
+		REQUIRE(pointData.empty());
+		REQUIRE(indexData.empty());
+	}
+}
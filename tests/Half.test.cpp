@@ -0,0 +1,63 @@
+#include <cmath>
+#include <limits>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Vector.hpp>
+
+// MARK: Size
+TEST_CASE("Math::Half is 2 bytes in size", "[half-size]") {
+	REQUIRE(sizeof(Math::Half) == 2);
+	REQUIRE(sizeof(Math::Vector3h) == 6);
+	REQUIRE(sizeof(Math::Vector4h) == 8);
+}
+
+// MARK: Conversion
+TEST_CASE("Conversion between float and half", "[half-conversion]") {
+	SECTION("Exactly representable values round-trip", "[half-exact]") {
+		CONSTEXPR_REQUIRE(Math::Half(1.0f).bits == 0x3C00);
+		CONSTEXPR_REQUIRE(Math::Half(-2.0f).bits == 0xC000);
+		CONSTEXPR_REQUIRE(Math::Half(65504.0f).bits == 0x7BFF);
+		CONSTEXPR_REQUIRE(static_cast<float>(Math::Half(0.333251953125f)) == 0.333251953125f);
+		CONSTEXPR_REQUIRE(static_cast<float>(Math::Half::FromBits(0x0001)) == 5.9604644775390625e-8f);
+	}
+
+	SECTION("Rounding is to nearest even", "[half-rounding]") {
+		// 1 + 2^-11 is halfway between 1 and the next half, 1 + 2^-10
+		CONSTEXPR_REQUIRE(Math::Half(1.00048828125f).bits == 0x3C00);
+		CONSTEXPR_REQUIRE(Math::Half(1.00146484375f).bits == 0x3C02);
+		CONSTEXPR_REQUIRE(Math::Half(1.0005f).bits == 0x3C01);
+	}
+
+	SECTION("Out of range values", "[half-range]") {
+		CONSTEXPR_REQUIRE(Math::Half(1.0e6f).bits == 0x7C00);
+		CONSTEXPR_REQUIRE(Math::Half(-1.0e6f).bits == 0xFC00);
+		CONSTEXPR_REQUIRE(Math::Half(1.0e-10f).bits == 0x0000);
+		REQUIRE(std::isnan(static_cast<float>(Math::Half(std::numeric_limits<float>::quiet_NaN()))));
+	}
+
+	SECTION("Every half survives a round-trip through float", "[half-round-trip]") {
+		int mismatches = 0;
+		for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+			Math::Half h = Math::Half::FromBits(static_cast<uint16_t>(bits));
+			float f = static_cast<float>(h);
+			if (!std::isnan(f) && Math::Half(f).bits != h.bits) {
+				++mismatches;
+			}
+		}
+
+		REQUIRE(mismatches == 0);
+	}
+}
+
+// MARK: Vectors
+TEST_CASE("Half precision vectors", "[half-vector]") {
+	Math::Vector4 v(0.5f, -1.25f, 1024.0f, 0.1f);
+	Math::Vector4h packed(v);
+	Math::Vector4 unpacked(packed);
+
+	REQUIRE(unpacked.x == 0.5f);
+	REQUIRE(unpacked.y == -1.25f);
+	REQUIRE(unpacked.z == 1024.0f);
+	REQUIRE(std::abs(unpacked.w - 0.1f) < 1.0e-4f);
+}
@@ -0,0 +1,101 @@
+#include <string>
+#include <memory>
+
+#include <snitch/snitch.hpp>
+
+#include <Utils/LruCache.hpp>
+
+// MARK: LRU cache
+TEST_CASE("LRU cache", "[lru-cache]") {
+	SECTION("Hits and misses", "[lru-cache-find]") {
+		Utils::LruCache<std::string, int> cache(100);
+		REQUIRE(cache.Find("a") == nullptr);
+
+		std::shared_ptr<int> a = cache.Insert("a", std::make_shared<int>(1), 10);
+		REQUIRE(*a == 1);
+		REQUIRE(cache.Find("a") == a);
+		REQUIRE(cache.GetCount() == 1);
+		REQUIRE(cache.GetUsedBytes() == 10);
+
+		REQUIRE(cache.GetStatistics().hits == 1);
+		REQUIRE(cache.GetStatistics().misses == 1);
+		REQUIRE(cache.GetStatistics().evictions == 0);
+
+		// Replacing a value changes the bytes used
+		cache.Insert("a", std::make_shared<int>(2), 30);
+		REQUIRE(*cache.Find("a") == 2);
+		REQUIRE(cache.GetCount() == 1);
+		REQUIRE(cache.GetUsedBytes() == 30);
+		REQUIRE(*a == 1);
+
+		REQUIRE(cache.Erase("a"));
+		REQUIRE(!cache.Erase("a"));
+		REQUIRE(cache.GetUsedBytes() == 0);
+	}
+
+	SECTION("Least recently used first", "[lru-cache-eviction]") {
+		Utils::LruCache<int, int> cache(30);
+		cache.Insert(1, std::make_shared<int>(1), 10);
+		cache.Insert(2, std::make_shared<int>(2), 10);
+		cache.Insert(3, std::make_shared<int>(3), 10);
+		REQUIRE(cache.GetCount() == 3);
+
+		// 1 becomes the most recently used, so 2 goes first
+		REQUIRE(cache.Find(1) != nullptr);
+		cache.Insert(4, std::make_shared<int>(4), 10);
+		REQUIRE(cache.GetCount() == 3);
+		REQUIRE(cache.GetUsedBytes() == 30);
+		REQUIRE(cache.Find(2) == nullptr);
+		REQUIRE(cache.Find(1) != nullptr);
+		REQUIRE(cache.GetStatistics().evictions == 1);
+
+		// Larger than the budget on its own, still returned
+		std::shared_ptr<int> large = cache.Insert(5, std::make_shared<int>(5), 50);
+		REQUIRE(*large == 5);
+		REQUIRE(cache.GetCount() == 1);
+		REQUIRE(cache.GetUsedBytes() == 50);
+
+		large.reset();
+		REQUIRE(cache.Trim() == 1);
+		REQUIRE(cache.GetCount() == 0);
+	}
+
+	SECTION("Referenced values stay", "[lru-cache-references]") {
+		Utils::LruCache<int, int> cache(20);
+		std::shared_ptr<int> first = cache.Insert(1, std::make_shared<int>(1), 10);
+		cache.Insert(2, std::make_shared<int>(2), 10);
+		std::shared_ptr<int> third = cache.Insert(3, std::make_shared<int>(3), 10);
+
+		// 1 is the least recently used, but referenced
+		REQUIRE(cache.Find(1) == first);
+		REQUIRE(cache.Find(2) == nullptr);
+		REQUIRE(cache.GetUsedBytes() == 20);
+
+		// Over the budget until the handles are released
+		cache.SetByteBudget(5);
+		REQUIRE(cache.GetCount() == 2);
+		REQUIRE(cache.GetUsedBytes() == 20);
+
+		first.reset();
+		REQUIRE(cache.Trim() == 1);
+		REQUIRE(cache.Find(3) == third);
+		REQUIRE(cache.GetUsedBytes() == 10);
+
+		// Without any budget
+		third.reset();
+		REQUIRE(cache.Trim(0) == 1);
+		REQUIRE(cache.GetUsedBytes() == 0);
+	}
+
+	SECTION("Clear", "[lru-cache-clear]") {
+		Utils::LruCache<int, int> cache(100);
+		std::shared_ptr<int> kept = cache.Insert(1, std::make_shared<int>(1), 10);
+		cache.Insert(2, std::make_shared<int>(2), 10);
+
+		cache.Clear();
+		REQUIRE(cache.GetCount() == 0);
+		REQUIRE(cache.GetUsedBytes() == 0);
+		REQUIRE(*kept == 1);
+		REQUIRE(kept.use_count() == 1);
+	}
+}
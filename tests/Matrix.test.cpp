@@ -0,0 +1,76 @@
+#include <cmath>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Matrix.hpp>
+
+// MARK: Aliases
+TEST_CASE("Matrix and vector aliases keep their layout", "[matrix-aliases]") {
+	REQUIRE(sizeof(Math::Vector2) == 8);
+	REQUIRE(sizeof(Math::Vector3) == 12);
+	REQUIRE(sizeof(Math::Vector4) == 16);
+	REQUIRE(sizeof(Math::Matrix2x2) == 16);
+	REQUIRE(sizeof(Math::Matrix3x3) == 36);
+	REQUIRE(sizeof(Math::Matrix4x4d) == 128);
+	REQUIRE(alignof(Math::Matrix4x4d) == 16);
+}
+
+// MARK: Construction
+TEST_CASE("Construction of vectors from smaller parts", "[vector-parts]") {
+	constexpr Math::Vector2 xy(1.0f, 2.0f);
+	constexpr Math::Vector2 zw(3.0f, 4.0f);
+
+	CONSTEXPR_REQUIRE(Math::Vector4(xy, zw) == Math::Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	CONSTEXPR_REQUIRE(Math::Vector4(Math::Vector3(xy, 3.0f), 4.0f) == Math::Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	CONSTEXPR_REQUIRE(Math::Vector4(0.0f, xy, 0.0f) == Math::Vector4(0.0f, 1.0f, 2.0f, 0.0f));
+	CONSTEXPR_REQUIRE(Math::Vector<5, int>(1, 2, 3, 4, 5)[4] == 5);
+}
+
+// MARK: Non-square
+TEST_CASE("Products of non-square matrices", "[matrix-non-square]") {
+	constexpr Math::Matrix<2, 3, float> a(
+		1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f);
+
+	constexpr Math::Matrix<3, 2, float> transposed = Math::Matrix<2, 3, float>::Transpose(a);
+	CONSTEXPR_REQUIRE(transposed(2, 1) == 6.0f);
+
+	constexpr Math::Matrix2x2 product = a * transposed;
+	CONSTEXPR_REQUIRE(product == Math::Matrix2x2(14.0f, 32.0f, 32.0f, 77.0f));
+
+	CONSTEXPR_REQUIRE(a * Math::Vector3(1.0f, 0.0f, -1.0f) == Math::Vector2(-2.0f, -2.0f));
+}
+
+// MARK: Determinant
+TEST_CASE("Determinant and inverse of square matrices", "[matrix-determinant]") {
+	constexpr Math::Matrix3x3 m(
+		2.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 1.0f);
+
+	CONSTEXPR_REQUIRE(Math::Matrix3x3::Determinant(m) == 1.0f);
+	CONSTEXPR_REQUIRE(m * Math::Matrix3x3::Inverse(m) == Math::Matrix3x3::Identity());
+
+	constexpr Math::Matrix<5, 5, double> diagonal(1.0, 2.0, 3.0, 4.0, 5.0);
+	CONSTEXPR_REQUIRE(Math::Matrix<5, 5, double>::Determinant(diagonal) == 120.0);
+}
+
+// MARK: Double precision
+TEST_CASE("Double precision world coordinates", "[matrix-double]") {
+	// Far from the origin, float cannot represent a centimeter offset anymore
+	Math::Vector4d position(6'371'000.0, 12'345'678.0, -4'000'000.0, 1.0);
+	Math::Matrix4x4d translation = Math::Matrix4x4d::Translate(0.01, 0.0, 0.0);
+	Math::Vector4d moved = translation * position;
+
+	REQUIRE(std::abs(moved.x - position.x - 0.01) < 1.0e-8);
+	REQUIRE(static_cast<float>(position.y) + 0.01f == static_cast<float>(position.y));
+
+	Math::Matrix4x4d camera = Math::Matrix4x4d::Perspective(1.0471975, 1.5, 0.1, 1000.0) * Math::Matrix4x4d::RotateY(0.4);
+	Math::Matrix4x4d identity = camera * Math::Matrix4x4d::Inverse(camera);
+	for (int i = 0; i < 16; ++i) {
+		REQUIRE(std::abs(identity[i] - Math::Matrix4x4d::Identity()[i]) < 1.0e-12);
+	}
+
+	Math::Matrix4x4 single(camera);
+	REQUIRE(single[0] == static_cast<float>(camera[0]));
+}
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Matrix.hpp>
+
+// Reference implementations, written the way Matrix4x4 used to compute them
+// before the Simd backend was introduced.
+static Math::Matrix4x4 ReferenceMultiply(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs) {
+	Math::Matrix4x4 result;
+	for (int n = 0; n < 4; ++n) {
+		for (int m = 0; m < 4; ++m) {
+			result(n, m) = Math::Vector4::Dot(lhs.Line(n), rhs.Column(m));
+		}
+	}
+
+	return result;
+}
+
+static Math::Matrix4x4 ReferenceTranspose(Math::Matrix4x4 const& m) {
+	return Math::Matrix4x4(m.Column(0), m.Column(1), m.Column(2), m.Column(3));
+}
+
+static Math::Matrix4x4 ReferenceInverse(Math::Matrix4x4 const& m) {
+	Math::Matrix4x4 adjugate = ReferenceTranspose(m.CofactorMatrix());
+	return adjugate / Math::Matrix4x4::Determinant(m);
+}
+
+static bool AlmostEqual(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs, float epsilon) {
+	for (int i = 0; i < 16; ++i) {
+		if (std::abs(lhs[i] - rhs[i]) > epsilon * std::max(1.0f, std::abs(rhs[i]))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static constexpr Math::Matrix4x4 general(
+	2.0f, -1.0f, 0.5f, 3.0f,
+	0.25f, 4.0f, -2.0f, 1.0f,
+	-3.0f, 0.75f, 1.5f, -0.5f,
+	1.0f, 2.0f, -1.0f, 5.0f);
+
+static Math::Matrix4x4 const camera =
+	Math::Matrix4x4::Perspective(1.0471975f, 256.0f / 240.0f, 0.1f, 1000.0f) *
+	Math::Matrix4x4::RotateX(0.3f) * Math::Matrix4x4::RotateY(-1.2f);
+
+// MARK: Size
+TEST_CASE("Math::Matrix4x4 is always 64 bytes in size", "[matrix-size]") {
+	REQUIRE(sizeof(Math::Matrix4x4) == 64);
+	REQUIRE(alignof(Math::Matrix4x4) == 16);
+}
+
+// MARK: Multiplication
+TEST_CASE("Multiplication of two matrices", "[matrix-multiply]") {
+	SECTION("Identity is neutral", "[multiply-identity]") {
+		REQUIRE(general * Math::Matrix4x4::Identity() == general);
+		REQUIRE(Math::Matrix4x4::Identity() * general == general);
+	}
+
+	SECTION("Result is bit-exact with the scalar dot products", "[multiply-bit-exact]") {
+		REQUIRE(general * camera == ReferenceMultiply(general, camera));
+		REQUIRE(camera * general == ReferenceMultiply(camera, general));
+		REQUIRE(camera * camera == ReferenceMultiply(camera, camera));
+	}
+
+	SECTION("Assigning multiplication", "[multiply-assignment]") {
+		Math::Matrix4x4 result = general;
+		result *= camera;
+		REQUIRE(result == ReferenceMultiply(general, camera));
+	}
+}
+
+// MARK: Transposition
+TEST_CASE("Transposition of a matrix", "[matrix-transpose]") {
+	REQUIRE(Math::Matrix4x4::Transpose(general) == ReferenceTranspose(general));
+	REQUIRE(Math::Matrix4x4::Transpose(Math::Matrix4x4::Transpose(camera)) == camera);
+
+	Math::Matrix4x4 result = general;
+	result.Transposed();
+	REQUIRE(result == ReferenceTranspose(general));
+}
+
+// MARK: Inversion
+TEST_CASE("Inversion of a matrix", "[matrix-inverse]") {
+	SECTION("Matches the cofactor expansion", "[inverse-cofactor]") {
+		REQUIRE(AlmostEqual(Math::Matrix4x4::Inverse(general), ReferenceInverse(general), 1e-5f));
+		REQUIRE(AlmostEqual(Math::Matrix4x4::Inverse(camera), ReferenceInverse(camera), 1e-5f));
+	}
+
+	SECTION("Product with the inverse is the identity", "[inverse-identity]") {
+		REQUIRE(AlmostEqual(general * Math::Matrix4x4::Inverse(general), Math::Matrix4x4::Identity(), 1e-5f));
+		REQUIRE(AlmostEqual(Math::Matrix4x4::Inverse(camera) * camera, Math::Matrix4x4::Identity(), 1e-5f));
+	}
+
+	SECTION("Diagonal matrices are inverted exactly", "[inverse-diagonal]") {
+		REQUIRE(Math::Matrix4x4::Inverse(Math::Matrix4x4(2.0f, 4.0f, 0.5f, 1.0f)) == Math::Matrix4x4(0.5f, 0.25f, 2.0f, 1.0f));
+	}
+
+	SECTION("Inversing in place", "[inverse-assignment]") {
+		Math::Matrix4x4 result = general;
+		result.Inversed();
+		REQUIRE(result == Math::Matrix4x4::Inverse(general));
+	}
+}
+
+// MARK: Compile-time evaluation
+TEST_CASE("Matrices are usable in constant expressions", "[matrix-constexpr]") {
+	constexpr Math::Matrix4x4 translation = Math::Matrix4x4::Translate(1.0f, 2.0f, 3.0f);
+	constexpr Math::Matrix4x4 scale = Math::Matrix4x4::Scale(2.0f);
+
+	SECTION("Folding products, transpositions and inverses", "[constexpr-fold]") {
+		CONSTEXPR_REQUIRE(translation * scale == Math::Matrix4x4(
+			2.0f, 0.0f, 0.0f, 1.0f,
+			0.0f, 2.0f, 0.0f, 2.0f,
+			0.0f, 0.0f, 2.0f, 3.0f,
+			0.0f, 0.0f, 0.0f, 1.0f));
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Transpose(translation).Line(3) == Math::Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Inverse(scale) == Math::Matrix4x4::Scale(0.5f));
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Inverse(translation) == Math::Matrix4x4::Translate(-1.0f, -2.0f, -3.0f));
+	}
+
+	SECTION("Compile-time and runtime results are identical", "[constexpr-runtime]") {
+		constexpr Math::Matrix4x4 product = general * translation;
+		constexpr Math::Matrix4x4 inverse = Math::Matrix4x4::Inverse(general);
+
+		Math::Matrix4x4 runtimeGeneral = general;
+		REQUIRE(product == runtimeGeneral * translation);
+		REQUIRE(inverse == Math::Matrix4x4::Inverse(runtimeGeneral));
+	}
+}
@@ -0,0 +1,87 @@
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Geometry/Mesh.hpp>
+
+static VertexAttributes Corner(float x, float y, float u = 0.0f) {
+	return VertexAttributes { { x, y, 0.0f }, { 0.0f, 0.0f, 1.0f }, { u, 0.0f } };
+}
+
+// MARK: Welding
+TEST_CASE("Vertex welding", "[mesh-welding]") {
+	SECTION("Shared corners", "[mesh-welding-shared]") {
+		// Quad as two triangles, the diagonal corners repeated
+		std::vector<VertexAttributes> corners {
+			Corner(0, 0), Corner(1, 0), Corner(1, 1),
+			Corner(0, 0), Corner(1, 1), Corner(0, 1) };
+
+		IndexedMesh mesh = WeldVertices(corners);
+		REQUIRE(mesh.vertices.size() == 4);
+		REQUIRE(mesh.indices == std::vector<uint32_t> { 0, 1, 2, 0, 2, 3 });
+		REQUIRE(mesh.parts.size() == 1);
+		REQUIRE(mesh.parts[0].indexCount == 6);
+
+		for (size_t i = 0; i < corners.size(); ++i) {
+			REQUIRE(mesh.vertices[mesh.indices[i]].position == corners[i].position);
+		}
+
+		MeshMemory memory = GetMeshMemory(mesh);
+		REQUIRE(memory.soupBytes == 6 * sizeof(VertexAttributes));
+		REQUIRE(memory.vertexBytes == 4 * sizeof(VertexAttributes));
+		REQUIRE(memory.indexBytes == 6 * sizeof(uint16_t));
+		REQUIRE(memory.GetSavedBytes() == 2 * sizeof(VertexAttributes) - 12);
+	}
+
+	SECTION("Distinct attributes", "[mesh-welding-distinct]") {
+		// Same position, other texture coordinates: a seam, kept apart
+		std::vector<VertexAttributes> corners { Corner(0, 0), Corner(0, 0, 1.0f), Corner(-0.0f, 0) };
+
+		IndexedMesh mesh = WeldVertices(corners);
+		REQUIRE(mesh.vertices.size() == 2);
+		REQUIRE(mesh.indices == std::vector<uint32_t> { 0, 1, 0 });
+	}
+
+	SECTION("Several parts", "[mesh-welding-parts]") {
+		IndexedMesh mesh {};
+		VertexWelder welder(mesh);
+		for (VertexAttributes const& corner : { Corner(0, 0), Corner(1, 0), Corner(1, 1) }) {
+			welder.Add(corner);
+		}
+
+		mesh.parts.push_back(MeshPart { "first", 0, 3 });
+
+		// A second welder over the same mesh finds its vertices
+		VertexWelder other(mesh);
+		REQUIRE(other.Add(Corner(1, 1)) == 2);
+		REQUIRE(other.Add(Corner(2, 2)) == 3);
+		REQUIRE(mesh.indices.size() == 5);
+	}
+}
+
+// MARK: Index buffer
+TEST_CASE("Index buffer", "[mesh-indices]") {
+	IndexedMesh mesh {};
+	mesh.vertices.resize(3);
+	mesh.indices = { 0, 1, 2 };
+	REQUIRE(HasShortIndices(mesh));
+	REQUIRE(GetIndexSize(mesh) == 2);
+
+	std::vector<uint8_t> data = PackIndices(mesh);
+	REQUIRE(data.size() == 6);
+	uint16_t last = 0;
+	std::memcpy(&last, &data[4], sizeof(uint16_t));
+	REQUIRE(last == 2);
+
+	// Past 65536 vertices, 32-bit indices
+	mesh.vertices.resize(70000);
+	mesh.indices = { 0, 69999, 65536 };
+	REQUIRE_FALSE(HasShortIndices(mesh));
+	data = PackIndices(mesh);
+	REQUIRE(data.size() == 12);
+	uint32_t wide = 0;
+	std::memcpy(&wide, &data[4], sizeof(uint32_t));
+	REQUIRE(wide == 69999);
+}
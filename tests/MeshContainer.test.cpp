@@ -0,0 +1,196 @@
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <cstdint>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Geometry/MeshContainer.hpp>
+
+#include "TemporaryFiles.hpp"
+
+// Grid of size x size quads in the XZ plane
+static IndexedMesh Grid(uint32_t size) {
+	IndexedMesh mesh {};
+	for (uint32_t i = 0; i <= size; ++i) {
+		for (uint32_t j = 0; j <= size; ++j) {
+			float u = static_cast<float>(i) / static_cast<float>(size);
+			float v = static_cast<float>(j) / static_cast<float>(size);
+			mesh.vertices.push_back(VertexAttributes { { static_cast<float>(i), 0.5f, -static_cast<float>(j) }, { 0.0f, 1.0f, 0.0f }, { u, v } });
+		}
+	}
+
+	for (uint32_t i = 0; i < size; ++i) {
+		for (uint32_t j = 0; j < size; ++j) {
+			uint32_t a = i * (size + 1) + j;
+			uint32_t b = a + size + 1;
+			mesh.indices.insert(mesh.indices.end(), { a, b, b + 1, a, b + 1, a + 1 });
+		}
+	}
+
+	uint32_t half = static_cast<uint32_t>(mesh.indices.size() / 2);
+	mesh.parts = { MeshPart { "first", 0, half }, MeshPart { "second", half, half } };
+	return mesh;
+}
+
+// MARK: Round trip
+TEST_CASE("Mesh containers", "[mesh-container]") {
+	SECTION("Full precision", "[mesh-container-full]") {
+		IndexedMesh mesh = Grid(4);
+		std::filesystem::path path = TemporaryPath("grid.gsmesh");
+		MeshContainerWriter(mesh).Write(path);
+		REQUIRE(!std::filesystem::exists(path.string() + ".tmp"));
+
+		MeshContainer container(path);
+		REQUIRE(!container.IsQuantized());
+		REQUIRE(container.GetVertexStride() == sizeof(VertexAttributes));
+		REQUIRE(container.GetVertexCount() == 25);
+		REQUIRE(container.GetIndexSize() == 2);
+		REQUIRE(container.GetIndexCount() == 96);
+		REQUIRE(container.GetAttributes().size() == 3);
+		REQUIRE(container.GetAttributes()[2].format == MeshAttributeFormat::Float32x2);
+		REQUIRE(container.GetAttributes()[2].offset == offsetof(VertexAttributes, uv));
+		REQUIRE(container.GetBounds().min == Math::Vector3(0.0f, 0.5f, -4.0f));
+		REQUIRE(container.GetBounds().max == Math::Vector3(4.0f, 0.5f, 0.0f));
+		REQUIRE(container.GetDequantization() == Math::Matrix4x4::Identity());
+		REQUIRE(container.GetMeshletCount() == 0);
+
+		// The buffers as they are in memory
+		REQUIRE(container.GetVertexDataSize() == mesh.vertices.size() * sizeof(VertexAttributes));
+		REQUIRE(std::memcmp(container.GetVertexData(), mesh.vertices.data(), container.GetVertexDataSize()) == 0);
+		std::vector<uint8_t> indices = PackIndices(mesh);
+		REQUIRE(container.GetIndexDataSize() == indices.size());
+		REQUIRE(std::memcmp(container.GetIndexData(), indices.data(), indices.size()) == 0);
+
+		REQUIRE(container.GetParts().size() == 2);
+		REQUIRE(container.GetParts()[1].firstIndex == 48);
+		REQUIRE(container.GetParts()[1].indexCount == 48);
+
+		container = MeshContainer();
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Quantized with meshlets", "[mesh-container-quantized]") {
+		IndexedMesh mesh = Grid(16);
+		QuantizedMesh quantized = QuantizeMesh(mesh);
+		Meshlets meshlets = BuildMeshlets(mesh, 32, 40);
+
+		MeshContainerWriter writer(quantized);
+		writer.SetMeshlets(meshlets);
+		std::filesystem::path path = TemporaryPath("quantized.gsmesh");
+		writer.Write(path);
+
+		MeshContainer container(path);
+		REQUIRE(container.IsQuantized());
+		REQUIRE(container.GetVertexStride() == sizeof(QuantizedVertex));
+		REQUIRE(container.GetAttributes()[0].format == MeshAttributeFormat::Snorm16x4);
+		REQUIRE(container.GetDequantization() == quantized.dequantization);
+		REQUIRE(std::memcmp(container.GetVertexData(), quantized.vertices.data(), container.GetVertexDataSize()) == 0);
+
+		REQUIRE(container.GetMeshletCount() == meshlets.meshlets.size());
+		for (uint32_t i = 0; i < container.GetMeshletCount(); ++i) {
+			MeshContainerMeshlet meshlet = container.GetMeshlet(i);
+			REQUIRE(meshlet.vertexOffset == meshlets.meshlets[i].vertexOffset);
+			REQUIRE(meshlet.triangleCount == meshlets.meshlets[i].triangleCount);
+			REQUIRE(meshlet.boundsMax[0] == meshlets.meshlets[i].bounds.max.x);
+		}
+
+		REQUIRE(container.GetMeshletVertex(static_cast<uint32_t>(meshlets.vertices.size() - 1)) == meshlets.vertices.back());
+		REQUIRE(std::memcmp(container.GetMeshletTriangles(), meshlets.triangles.data(), meshlets.triangles.size()) == 0);
+
+		container = MeshContainer();
+		std::filesystem::remove(path);
+	}
+
+	SECTION("32-bit indices", "[mesh-container-wide]") {
+		IndexedMesh mesh = Grid(300);
+		std::filesystem::path path = TemporaryPath("wide.gsmesh");
+		MeshContainerWriter(mesh).Write(path);
+
+		MeshContainer container(path);
+		REQUIRE(container.GetIndexSize() == 4);
+		REQUIRE(container.GetIndexDataSize() == mesh.indices.size() * sizeof(uint32_t));
+		REQUIRE(std::memcmp(container.GetIndexData(), mesh.indices.data(), container.GetIndexDataSize()) == 0);
+
+		container = MeshContainer();
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Padded indices", "[mesh-container-padding]") {
+		// 3 indices of 2 bytes, padded to 8 for writeBuffer
+		IndexedMesh mesh = Grid(1);
+		mesh.indices.resize(3);
+		mesh.parts = { MeshPart { "triangle", 0, 3 } };
+		std::filesystem::path path = TemporaryPath("padded.gsmesh");
+		MeshContainerWriter(mesh).Write(path);
+
+		MeshContainer container(path);
+		REQUIRE(container.GetIndexDataSize() == 8);
+		REQUIRE(container.GetIndexData()[6] == 0);
+		REQUIRE(container.GetIndexData()[7] == 0);
+
+		container = MeshContainer();
+		std::filesystem::remove(path);
+	}
+}
+
+// MARK: Errors
+TEST_CASE("Invalid mesh containers", "[mesh-container-errors]") {
+	SECTION("Writing", "[mesh-container-write-errors]") {
+		IndexedMesh mesh = Grid(2);
+		mesh.parts.push_back(MeshPart { "outside", 20, 6 });
+		REQUIRE_THROWS_AS(MeshContainerWriter { mesh }, std::runtime_error);
+
+		mesh.parts.pop_back();
+		REQUIRE_THROWS_AS(MeshContainerWriter(mesh).Write(TemporaryPath("missing/grid.gsmesh")), std::runtime_error);
+	}
+
+	SECTION("Reading", "[mesh-container-read-errors]") {
+		IndexedMesh mesh = Grid(4);
+		MeshContainerWriter writer(mesh);
+		writer.SetMeshlets(BuildMeshlets(mesh));
+		std::filesystem::path path = TemporaryPath("invalid.gsmesh");
+		writer.Write(path);
+		std::vector<char> valid = ReadFile(path);
+
+		REQUIRE_THROWS_AS(MeshContainer { TemporaryPath("does_not_exist.gsmesh") }, std::runtime_error);
+
+		std::vector<char> truncated(valid.begin(), valid.end() - 1);
+		WriteFile(path, truncated);
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		std::vector<char> wrongMagic = valid;
+		wrongMagic[0] = 'X';
+		WriteFile(path, wrongMagic);
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		// The index size, after the identifier and 5 values
+		std::vector<char> wrongIndexSize = valid;
+		wrongIndexSize[8 + 5 * 4] = 3;
+		WriteFile(path, wrongIndexSize);
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		// The format of the first attribute, right after the header
+		std::vector<char> wrongFormat = valid;
+		wrongFormat[sizeof(MeshContainerHeader) + 4] = 42;
+		WriteFile(path, wrongFormat);
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		// An offset of the first attribute that wraps around with its size
+		std::vector<char> wrappingOffset = valid;
+		uint32_t offset = UINT32_MAX - 3;
+		std::memcpy(&wrappingOffset[sizeof(MeshContainerHeader) + 8], &offset, sizeof(uint32_t));
+		WriteFile(path, wrappingOffset);
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		WriteFile(path, std::vector<char>(valid.begin(), valid.begin() + 10));
+		REQUIRE_THROWS_AS(MeshContainer { path }, std::runtime_error);
+
+		WriteFile(path, valid);
+		REQUIRE(MeshContainer(path).GetVertexCount() == 25);
+
+		std::filesystem::remove(path);
+	}
+}
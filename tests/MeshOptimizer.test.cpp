@@ -0,0 +1,190 @@
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <cstdint>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Geometry/MeshOptimizer.hpp>
+
+// Grid of size x size quads, its triangles in a random order
+static IndexedMesh ShuffledGrid(uint32_t size) {
+	IndexedMesh mesh {};
+	for (uint32_t i = 0; i <= size; ++i) {
+		for (uint32_t j = 0; j <= size; ++j) {
+			mesh.vertices.push_back(VertexAttributes { { static_cast<float>(i), 0.0f, static_cast<float>(j) }, { 0.0f, 1.0f, 0.0f }, {} });
+		}
+	}
+
+	std::vector<std::array<uint32_t, 3>> triangles {};
+	for (uint32_t i = 0; i < size; ++i) {
+		for (uint32_t j = 0; j < size; ++j) {
+			uint32_t a = i * (size + 1) + j;
+			uint32_t b = a + size + 1;
+			triangles.push_back({ a, b, b + 1 });
+			triangles.push_back({ a, b + 1, a + 1 });
+		}
+	}
+
+	std::mt19937 random(42);
+	std::shuffle(triangles.begin(), triangles.end(), random);
+	for (auto const& triangle : triangles) {
+		mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+	}
+
+	return mesh;
+}
+
+// Triangles as sorted triples of positions, the same for any order of the
+// triangles and of the vertices, with the winding kept in each triple
+static std::vector<std::array<float, 9>> Triangles(IndexedMesh const& mesh, size_t first, size_t count) {
+	std::vector<std::array<float, 9>> triangles {};
+	for (size_t i = first; i < first + count; i += 3) {
+		// Rotated so that the smallest corner comes first, keeping the winding
+		size_t smallest = 0;
+		for (size_t corner = 1; corner < 3; ++corner) {
+			Math::Vector3 const& p = mesh.vertices[mesh.indices[i + corner]].position;
+			Math::Vector3 const& q = mesh.vertices[mesh.indices[i + smallest]].position;
+			if (std::array { p.x, p.y, p.z } < std::array { q.x, q.y, q.z }) {
+				smallest = corner;
+			}
+		}
+
+		std::array<float, 9> triangle {};
+		for (size_t corner = 0; corner < 3; ++corner) {
+			Math::Vector3 const& p = mesh.vertices[mesh.indices[i + (smallest + corner) % 3]].position;
+			triangle[3 * corner + 0] = p.x;
+			triangle[3 * corner + 1] = p.y;
+			triangle[3 * corner + 2] = p.z;
+		}
+
+		triangles.push_back(triangle);
+	}
+
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+// MARK: Analysis
+TEST_CASE("Vertex cache analysis", "[mesh-optimizer-analysis]") {
+	std::vector<uint32_t> indices { 0, 1, 2, 2, 1, 3 };
+	VertexCacheStatistics statistics = AnalyzeVertexCache(indices, 4);
+	REQUIRE(statistics.misses == 4);
+	REQUIRE(statistics.acmr == 2.0f);
+	REQUIRE(statistics.atvr == 1.0f);
+
+	// FIFO cache of 3 vertices: 3 evicts 0, which then evicts 1, which evicts 2
+	indices = { 0, 1, 2, 1, 2, 3, 0, 1, 2 };
+	REQUIRE(AnalyzeVertexCache(indices, 4, 3).misses == 7);
+
+	REQUIRE(AnalyzeVertexCache(std::vector<uint32_t> {}, 0).acmr == 0.0f);
+	REQUIRE_THROWS_AS(AnalyzeVertexCache(std::vector<uint32_t> { 0, 1 }, 2), std::runtime_error);
+	REQUIRE_THROWS_AS(AnalyzeVertexCache(std::vector<uint32_t> { 0, 1, 4 }, 4), std::runtime_error);
+}
+
+// MARK: Optimization
+TEST_CASE("Mesh optimization", "[mesh-optimizer]") {
+	SECTION("Vertex cache", "[mesh-optimizer-cache]") {
+		IndexedMesh mesh = ShuffledGrid(32);
+		auto before = Triangles(mesh, 0, mesh.indices.size());
+		float shuffledAcmr = AnalyzeVertexCache(mesh.indices, mesh.vertices.size()).acmr;
+
+		OptimizeVertexCache(mesh.indices, mesh.vertices.size());
+		REQUIRE(Triangles(mesh, 0, mesh.indices.size()) == before);
+
+		float acmr = AnalyzeVertexCache(mesh.indices, mesh.vertices.size()).acmr;
+		REQUIRE(shuffledAcmr > 2.0f);
+		REQUIRE(acmr < 0.9f);
+	}
+
+	SECTION("Overdraw", "[mesh-optimizer-overdraw]") {
+		IndexedMesh mesh = ShuffledGrid(32);
+		auto before = Triangles(mesh, 0, mesh.indices.size());
+
+		OptimizeVertexCache(mesh.indices, mesh.vertices.size());
+		float acmr = AnalyzeVertexCache(mesh.indices, mesh.vertices.size()).acmr;
+		OptimizeOverdraw(mesh.indices, mesh.vertices);
+		REQUIRE(Triangles(mesh, 0, mesh.indices.size()) == before);
+
+		// Clusters cost a few more misses at most
+		REQUIRE(AnalyzeVertexCache(mesh.indices, mesh.vertices.size()).acmr < 1.2f * acmr);
+	}
+
+	SECTION("Vertex fetch", "[mesh-optimizer-fetch]") {
+		IndexedMesh mesh = ShuffledGrid(8);
+		mesh.vertices.push_back(VertexAttributes {}); // Unused
+		auto before = Triangles(mesh, 0, mesh.indices.size());
+
+		OptimizeVertexFetch(mesh);
+		REQUIRE(mesh.vertices.size() == 81);
+		REQUIRE(Triangles(mesh, 0, mesh.indices.size()) == before);
+
+		// Each new vertex is the next one in the buffer
+		uint32_t next = 0;
+		for (uint32_t index : mesh.indices) {
+			REQUIRE(index <= next);
+			next = std::max(next, index + 1);
+		}
+	}
+
+	SECTION("Parts", "[mesh-optimizer-parts]") {
+		IndexedMesh mesh = ShuffledGrid(16);
+		uint32_t half = static_cast<uint32_t>(mesh.indices.size() / 2);
+		mesh.parts = { MeshPart { "first", 0, half }, MeshPart { "second", half, half } };
+		auto first = Triangles(mesh, 0, half);
+		auto second = Triangles(mesh, half, half);
+
+		OptimizeMesh(mesh);
+		REQUIRE(Triangles(mesh, 0, half) == first);
+		REQUIRE(Triangles(mesh, half, half) == second);
+
+		mesh.parts.push_back(MeshPart { "outside", half, half + 3 });
+		REQUIRE_THROWS_AS(OptimizeMesh(mesh), std::runtime_error);
+	}
+}
+
+// MARK: Meshlets
+TEST_CASE("Meshlets", "[mesh-optimizer-meshlets]") {
+	IndexedMesh mesh = ShuffledGrid(16);
+	OptimizeMesh(mesh);
+	Meshlets meshlets = BuildMeshlets(mesh, 64, 124);
+	REQUIRE(meshlets.meshlets.size() > 1);
+	REQUIRE(meshlets.triangles.size() == mesh.indices.size());
+
+	// The triangles of the meshlets are those of the mesh, in their order
+	size_t index = 0;
+	uint32_t vertexOffset = 0;
+	uint32_t triangleOffset = 0;
+	for (Meshlet const& meshlet : meshlets.meshlets) {
+		REQUIRE(meshlet.vertexOffset == vertexOffset);
+		REQUIRE(meshlet.triangleOffset == triangleOffset);
+		REQUIRE(meshlet.vertexCount <= 64);
+		REQUIRE(meshlet.triangleCount <= 124);
+
+		for (uint32_t triangle = meshlet.triangleOffset; triangle < meshlet.triangleOffset + meshlet.triangleCount; ++triangle) {
+			for (uint32_t corner = 0; corner < 3; ++corner) {
+				uint8_t local = meshlets.triangles[3 * triangle + corner];
+				REQUIRE(local < meshlet.vertexCount);
+
+				uint32_t vertex = meshlets.vertices[meshlet.vertexOffset + local];
+				REQUIRE(vertex == mesh.indices[index++]);
+				REQUIRE(meshlet.bounds.Contains(mesh.vertices[vertex].position));
+			}
+		}
+
+		vertexOffset += meshlet.vertexCount;
+		triangleOffset += meshlet.triangleCount;
+	}
+
+	REQUIRE(vertexOffset == meshlets.vertices.size());
+
+	// Grid cells share their vertices, fewer than 3 per triangle
+	REQUIRE(meshlets.vertices.size() < mesh.indices.size() / 2);
+
+	REQUIRE_THROWS_AS(BuildMeshlets(mesh, 2, 124), std::runtime_error);
+	REQUIRE_THROWS_AS(BuildMeshlets(mesh, 257, 124), std::runtime_error);
+	REQUIRE_THROWS_AS(BuildMeshlets(mesh, 64, 0), std::runtime_error);
+	REQUIRE(BuildMeshlets(IndexedMesh {}).meshlets.empty());
+}
@@ -0,0 +1,311 @@
+#include <cmath>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Texture/MipMaps.hpp>
+
+static std::vector<uint8_t> MakeImage(uint32_t width, uint32_t height) {
+	std::mt19937 generator(width * 131 + height);
+	std::uniform_int_distribution<int> value(0, 255);
+
+	std::vector<uint8_t> pixels(4 * static_cast<size_t>(width) * height);
+	for (uint8_t& pixel : pixels) {
+		pixel = static_cast<uint8_t>(value(generator));
+	}
+
+	return pixels;
+}
+
+// Each destination pixel from the source pixels of its block, the last block
+// of an odd dimension being 3 pixels wide
+static std::vector<uint8_t> ExpectedLevel(std::vector<uint8_t> const& source, uint32_t width, uint32_t height, ColorSpace colorSpace = ColorSpace::Linear) {
+	uint32_t levelWidth = NextMipSize(width);
+	uint32_t levelHeight = NextMipSize(height);
+
+	auto range = [](uint32_t i, uint32_t size, uint32_t levelSize) {
+		uint32_t begin = size == 1 ? 0 : 2 * i;
+		uint32_t end = size == 1 ? 1 : (i + 1 == levelSize ? size : 2 * i + 2);
+		return std::pair { begin, end };
+	};
+
+	std::vector<uint8_t> level(4 * static_cast<size_t>(levelWidth) * levelHeight);
+	for (uint32_t y = 0; y < levelHeight; ++y) {
+		for (uint32_t x = 0; x < levelWidth; ++x) {
+			auto [x0, x1] = range(x, width, levelWidth);
+			auto [y0, y1] = range(y, height, levelHeight);
+			uint32_t count = (x1 - x0) * (y1 - y0);
+
+			for (uint32_t channel = 0; channel < 4; ++channel) {
+				uint32_t sum = 0;
+				float linearSum = 0.0f;
+				for (uint32_t j = y0; j < y1; ++j) {
+					for (uint32_t i = x0; i < x1; ++i) {
+						sum += source[4 * (j * width + i) + channel];
+						linearSum += SrgbToLinear(source[4 * (j * width + i) + channel]);
+					}
+				}
+
+				bool srgb = colorSpace == ColorSpace::Srgb && channel != 3;
+				level[4 * (y * levelWidth + x) + channel] = srgb ? LinearToSrgb(linearSum / static_cast<float>(count)) : static_cast<uint8_t>((sum + count / 2) / count);
+			}
+		}
+	}
+
+	return level;
+}
+
+// MARK: Downsampling
+TEST_CASE("Downsampling of RGBA8 images", "[mipmaps-downsample]") {
+	SECTION("Sizes", "[mipmaps-sizes]") {
+		REQUIRE(NextMipSize(8) == 4);
+		REQUIRE(NextMipSize(7) == 3);
+		REQUIRE(NextMipSize(1) == 1);
+		REQUIRE(MipLevelCount(4096, 4096) == 13);
+		REQUIRE(MipLevelCount(300, 17) == 9);
+		REQUIRE(MipLevelCount(1, 1) == 1);
+		REQUIRE(MipLevelCount(0, 0) == 0);
+	}
+
+	SECTION("Even, odd and thin images", "[mipmaps-odd]") {
+		std::pair<uint32_t, uint32_t> const sizes[] = { { 1, 1 }, { 2, 2 }, { 3, 3 }, { 5, 7 }, { 1, 9 }, { 9, 1 }, { 2, 5 }, { 37, 18 }, { 64, 64 }, { 130, 67 } };
+		for (auto [width, height] : sizes) {
+			std::vector<uint8_t> source = MakeImage(width, height);
+			std::vector<uint8_t> level(4 * static_cast<size_t>(NextMipSize(width)) * NextMipSize(height));
+			DownsampleRGBA8(source.data(), width, height, level.data());
+
+			REQUIRE(level == ExpectedLevel(source, width, height));
+		}
+	}
+
+	SECTION("Rounding", "[mipmaps-rounding]") {
+		// 0 + 1 + 1 + 1 is 0.75 on average, and 2 + 2 + 2 + 3 is 2.25
+		std::vector<uint8_t> source {
+			0, 2, 255, 0, 1, 2, 255, 0,
+			1, 2, 255, 0, 1, 3, 254, 0,
+		};
+		std::vector<uint8_t> level(4);
+		DownsampleRGBA8(source.data(), 2, 2, level.data());
+
+		REQUIRE(level == std::vector<uint8_t> { 1, 2, 255, 0 });
+	}
+
+	SECTION("Several threads", "[mipmaps-threads]") {
+		uint32_t width = 1030;
+		uint32_t height = 531;
+		std::vector<uint8_t> source = MakeImage(width, height);
+		std::vector<uint8_t> level(4 * static_cast<size_t>(NextMipSize(width)) * NextMipSize(height));
+		DownsampleRGBA8(source.data(), width, height, level.data(), 3);
+
+		REQUIRE(level == ExpectedLevel(source, width, height));
+	}
+}
+
+// MARK: Filters
+TEST_CASE("Gamma-correct and windowed sinc filters", "[mipmaps-filters]") {
+	SECTION("sRGB transfer functions", "[mipmaps-srgb]") {
+		for (int i = 0; i < 256; ++i) {
+			REQUIRE(LinearToSrgb(SrgbToLinear(static_cast<uint8_t>(i))) == i);
+		}
+
+		REQUIRE(SrgbToLinear(0) == 0.0f);
+		REQUIRE(SrgbToLinear(255) == 1.0f);
+		REQUIRE(LinearToSrgb(-1.0f) == 0);
+		REQUIRE(LinearToSrgb(2.0f) == 255);
+		REQUIRE(LinearToSrgb(0.5f) == 188);
+		REQUIRE(std::abs(SrgbToLinear(188) - 0.5029f) < 1.0e-4f);
+	}
+
+	SECTION("Box average in linear space", "[mipmaps-srgb-box]") {
+		// Black and white: half of the light, which sRGB encodes as 188, alpha staying linear
+		std::vector<uint8_t> source {
+			0, 0, 0, 0, 255, 255, 255, 255,
+			255, 255, 255, 255, 0, 0, 0, 0,
+		};
+		std::vector<uint8_t> level(4);
+
+		DownsampleRGBA8(source.data(), 2, 2, level.data(), MipFilter::Box, ColorSpace::Srgb);
+		REQUIRE(level == std::vector<uint8_t> { 188, 188, 188, 128 });
+
+		DownsampleRGBA8(source.data(), 2, 2, level.data(), MipFilter::Box, ColorSpace::Linear);
+		REQUIRE(level == std::vector<uint8_t> { 128, 128, 128, 128 });
+	}
+
+	SECTION("Odd sizes", "[mipmaps-srgb-odd]") {
+		// Same blocks as the integer filter. The floats are summed in another
+		// order than the expected values, which may round the other way.
+		std::pair<uint32_t, uint32_t> const sizes[] = { { 1, 1 }, { 3, 3 }, { 5, 7 }, { 1, 9 }, { 9, 1 }, { 37, 18 } };
+		for (auto [width, height] : sizes) {
+			std::vector<uint8_t> source = MakeImage(width, height);
+			std::vector<uint8_t> level(4 * static_cast<size_t>(NextMipSize(width)) * NextMipSize(height));
+			DownsampleRGBA8(source.data(), width, height, level.data(), MipFilter::Box, ColorSpace::Srgb);
+
+			std::vector<uint8_t> expected = ExpectedLevel(source, width, height, ColorSpace::Srgb);
+			size_t differences = 0;
+			for (size_t i = 0; i < level.size(); ++i) {
+				if (std::abs(level[i] - expected[i]) > 1) {
+					++differences;
+				}
+			}
+
+			REQUIRE(differences == 0);
+		}
+	}
+
+	SECTION("Kernels keep flat colors and stay in range", "[mipmaps-kernels]") {
+		for (MipFilter filter : { MipFilter::Kaiser, MipFilter::Lanczos }) {
+			std::vector<uint8_t> flat(4 * 37 * 20);
+			for (size_t i = 0; i < flat.size(); ++i) {
+				flat[i] = static_cast<uint8_t>(i % 4 == 3 ? 200 : 77);
+			}
+
+			std::vector<uint8_t> level(4 * 18 * 10);
+			DownsampleRGBA8(flat.data(), 37, 20, level.data(), filter, ColorSpace::Srgb);
+			REQUIRE(std::all_of(level.begin(), level.end(), [&, i = size_t(0)](uint8_t value) mutable { return value == (i++ % 4 == 3 ? 200 : 77); }));
+
+			// A hard edge rings with these kernels, which must be clamped
+			std::vector<uint8_t> edge(4 * 16 * 4);
+			for (size_t i = 0; i < edge.size(); ++i) {
+				edge[i] = (i / 4) % 16 < 8 ? 0 : 255;
+			}
+
+			std::vector<uint8_t> edgeLevel(4 * 8 * 2);
+			DownsampleRGBA8(edge.data(), 16, 4, edgeLevel.data(), filter, ColorSpace::Linear);
+			REQUIRE(edgeLevel[0] == 0);
+			REQUIRE(edgeLevel[4 * 7] == 255);
+			REQUIRE(edgeLevel[4 * 3] < edgeLevel[4 * 4]);
+		}
+	}
+
+	SECTION("Several threads", "[mipmaps-filters-threads]") {
+		uint32_t width = 1030;
+		uint32_t height = 531;
+		std::vector<uint8_t> source = MakeImage(width, height);
+		std::vector<uint8_t> single(4 * static_cast<size_t>(NextMipSize(width)) * NextMipSize(height));
+		std::vector<uint8_t> threaded(single.size());
+		DownsampleRGBA8(source.data(), width, height, single.data(), MipFilter::Kaiser, ColorSpace::Srgb);
+		DownsampleRGBA8(source.data(), width, height, threaded.data(), MipFilter::Kaiser, ColorSpace::Srgb, 3);
+
+		REQUIRE(single == threaded);
+	}
+}
+
+// MARK: Mip chain
+TEST_CASE("Mip chain of an image", "[mipmaps-chain]") {
+	uint32_t width = 45;
+	uint32_t height = 12;
+	std::vector<uint8_t> image = MakeImage(width, height);
+	MipChain chain(image.data(), width, height);
+
+	REQUIRE(chain.GetLevelCount() == 6);
+	REQUIRE(std::vector<uint8_t>(chain.GetData(0), chain.GetData(0) + chain.GetSize(0)) == image);
+
+	std::vector<uint8_t> expected = image;
+	size_t offset = 0;
+	for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+		MipChain::Level const& mipLevel = chain.GetLevel(level);
+		REQUIRE(mipLevel.width == width);
+		REQUIRE(mipLevel.height == height);
+		REQUIRE(mipLevel.offset == offset);
+		REQUIRE(std::vector<uint8_t>(chain.GetData(level), chain.GetData(level) + chain.GetSize(level)) == expected);
+
+		offset += chain.GetSize(level);
+		expected = ExpectedLevel(expected, width, height);
+		width = NextMipSize(width);
+		height = NextMipSize(height);
+	}
+
+	REQUIRE(chain.GetBuffer().size() == offset);
+	REQUIRE(chain.GetLevel(5).width == 1);
+	REQUIRE(chain.GetLevel(5).height == 1);
+
+	SECTION("Fewer levels", "[mipmaps-chain-levels]") {
+		chain.Generate(image.data(), 45, 12, 2);
+		REQUIRE(chain.GetLevelCount() == 2);
+		REQUIRE(chain.GetBuffer().size() == 4 * (45 * 12 + 22 * 6));
+
+		REQUIRE_THROWS_AS(chain.Generate(image.data(), 45, 12, 7), std::runtime_error);
+	}
+
+	SECTION("sRGB chain", "[mipmaps-chain-srgb]") {
+		chain.Generate(image.data(), 45, 12, MipFilter::Lanczos, ColorSpace::Srgb);
+		REQUIRE(chain.GetLevelCount() == 6);
+		REQUIRE(std::vector<uint8_t>(chain.GetData(0), chain.GetData(0) + chain.GetSize(0)) == image);
+
+		std::vector<uint8_t> level(4 * 22 * 6);
+		DownsampleRGBA8(image.data(), 45, 12, level.data(), MipFilter::Lanczos, ColorSpace::Srgb);
+		REQUIRE(std::vector<uint8_t>(chain.GetData(1), chain.GetData(1) + chain.GetSize(1)) == level);
+	}
+}
+
+// MARK: Cubemaps
+TEST_CASE("Mip chains of cubemap faces", "[mipmaps-cubemap]") {
+	uint32_t size = 20;
+	std::array<std::vector<uint8_t>, 6> images {};
+	std::array<uint8_t const*, 6> faces {};
+	for (size_t face = 0; face < 6; ++face) {
+		images[face] = MakeImage(size, size + static_cast<uint32_t>(face));
+		images[face].resize(4 * static_cast<size_t>(size) * size);
+		faces[face] = images[face].data();
+	}
+
+	auto texel = [](MipChain const& chain, uint32_t level, uint32_t x, uint32_t y) {
+		uint8_t const* data = chain.GetData(level) + 4 * (static_cast<size_t>(y) * chain.GetLevel(level).width + x);
+		return std::vector<uint8_t>(data, data + 4);
+	};
+
+	SECTION("Faces in parallel", "[mipmaps-cubemap-threads]") {
+		std::array<MipChain, 6> chains = GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, false);
+		std::array<MipChain, 6> sequential = GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, false, 0, 1);
+
+		for (size_t face = 0; face < 6; ++face) {
+			MipChain expected(faces[face], size, size, MipFilter::Box, ColorSpace::Srgb);
+			REQUIRE(chains[face].GetLevelCount() == 5);
+			REQUIRE(chains[face].GetBuffer() == expected.GetBuffer());
+			REQUIRE(sequential[face].GetBuffer() == expected.GetBuffer());
+		}
+
+		REQUIRE_THROWS_AS(GenerateCubemapMipChains(faces, size, MipFilter::Box, ColorSpace::Srgb, false, 6), std::runtime_error);
+	}
+
+	SECTION("Seams", "[mipmaps-cubemap-seams]") {
+		std::array<MipChain, 6> chains = GenerateCubemapMipChains(faces, size, MipFilter::Kaiser, ColorSpace::Linear, true);
+
+		// The first level is the images
+		for (size_t face = 0; face < 6; ++face) {
+			REQUIRE(std::vector<uint8_t>(chains[face].GetData(0), chains[face].GetData(0) + chains[face].GetSize(0)) == images[face]);
+		}
+
+		for (uint32_t level = 1; level < chains[0].GetLevelCount(); ++level) {
+			uint32_t n = chains[0].GetLevel(level).width;
+			for (uint32_t i = 0; i < n; ++i) {
+				// The right column of +X is the left column of -Z, and the top
+				// row of +Y is the top row of -Z, reversed
+				REQUIRE(texel(chains[0], level, n - 1, i) == texel(chains[5], level, 0, i));
+				REQUIRE(texel(chains[2], level, i, 0) == texel(chains[5], level, n - 1 - i, 0));
+
+				// The bottom row of +Z is the top row of -Y
+				REQUIRE(texel(chains[4], level, i, n - 1) == texel(chains[3], level, i, 0));
+			}
+
+			// +X, +Y and -Z meet at the top right corner of +X
+			REQUIRE(texel(chains[0], level, n - 1, 0) == texel(chains[2], level, n - 1, 0));
+			REQUIRE(texel(chains[0], level, n - 1, 0) == texel(chains[5], level, 0, 0));
+		}
+
+		// Away from the edges, nothing changes
+		MipChain expected(faces[1], size, size, MipFilter::Kaiser, ColorSpace::Linear);
+		REQUIRE(texel(chains[1], 1, 4, 5) == texel(expected, 1, 4, 5));
+
+		// The last level is the average of the 6 faces
+		uint32_t last = chains[0].GetLevelCount() - 1;
+		for (size_t face = 1; face < 6; ++face) {
+			REQUIRE(texel(chains[face], last, 0, 0) == texel(chains[0], last, 0, 0));
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#include <stdexcept>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Texture/MipResidency.hpp>
+
+// MARK: Residency
+TEST_CASE("Residency of streamed mip levels", "[mip-residency]") {
+	SECTION("From the smallest level", "[mip-residency-order]") {
+		MipResidency residency(5, 0);
+		REQUIRE(residency.IsEmpty());
+		REQUIRE(!residency.IsComplete());
+		REQUIRE(residency.GetResidentLevel() == 5);
+		REQUIRE(residency.GetNextLevel() == 4);
+
+		residency.MarkNextLevelUploaded();
+		REQUIRE(!residency.IsEmpty());
+		REQUIRE(residency.GetResidentLevel() == 4);
+		REQUIRE(residency.GetViewBaseLevel() == 4);
+		REQUIRE(residency.GetViewLevelCount() == 1);
+
+		for (int i = 0; i < 10; ++i) {
+			residency.MarkNextLevelUploaded();
+		}
+
+		REQUIRE(residency.IsComplete());
+		REQUIRE(residency.GetResidentLevel() == 0);
+		REQUIRE(residency.GetViewBaseLevel() == 0);
+		REQUIRE(residency.GetViewLevelCount() == 5);
+	}
+
+	SECTION("Base level", "[mip-residency-base]") {
+		// A 64x64 image kept at 16x16: the texture has levels 2 to 6
+		MipResidency residency(7, 2);
+		while (!residency.IsComplete()) {
+			residency.MarkNextLevelUploaded();
+		}
+
+		REQUIRE(residency.GetResidentLevel() == 2);
+		REQUIRE(residency.GetViewBaseLevel() == 0);
+		REQUIRE(residency.GetViewLevelCount() == 5);
+
+		MipResidency partial(7, 2);
+		partial.MarkNextLevelUploaded();
+		partial.MarkNextLevelUploaded();
+		REQUIRE(partial.GetViewBaseLevel() == 3);
+		REQUIRE(partial.GetViewLevelCount() == 2);
+
+		REQUIRE_THROWS_AS(MipResidency(7, 7), std::runtime_error);
+	}
+}
+
+// MARK: Budget
+TEST_CASE("Upload budget of a frame", "[upload-budget]") {
+	SECTION("Fitting uploads", "[upload-budget-fit]") {
+		UploadBudget budget(100);
+		REQUIRE(budget.TryConsume(60));
+		REQUIRE(!budget.TryConsume(60));
+		REQUIRE(budget.TryConsume(40));
+		REQUIRE(budget.GetUsed() == 100);
+		REQUIRE(budget.GetRemaining() == 0);
+		REQUIRE(!budget.TryConsume(1));
+	}
+
+	SECTION("Larger than the budget", "[upload-budget-large]") {
+		UploadBudget budget(100);
+		REQUIRE(budget.TryConsume(1000));
+		REQUIRE(budget.GetRemaining() == 0);
+		REQUIRE(!budget.TryConsume(1));
+
+		UploadBudget empty(0);
+		REQUIRE(!empty.TryConsume(1));
+		REQUIRE(empty.GetUsed() == 0);
+	}
+}
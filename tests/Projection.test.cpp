@@ -0,0 +1,111 @@
+#include <cmath>
+#include <limits>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Matrix.hpp>
+#include <Math/DepthPrecision.hpp>
+
+static float Depth(Math::Matrix4x4 const& projection, float distance) {
+	Math::Vector4 clip = projection * Math::Vector4(0.0f, 0.0f, distance, 1.0f);
+	return clip.z / clip.w;
+}
+
+static bool AlmostEqual(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs, float epsilon) {
+	for (int i = 0; i < 16; ++i) {
+		if (std::abs(lhs[i] - rhs[i]) > epsilon * std::max(1.0f, std::abs(rhs[i]))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static constexpr float infinity = std::numeric_limits<float>::infinity();
+
+// MARK: Depth range
+TEST_CASE("Depth range of the projections", "[projection-depth]") {
+	SECTION("Perspective", "[projection-perspective]") {
+		Math::Matrix4x4 standard = Math::Matrix4x4::Perspective(1.0f, 1.5f, 0.1f, 100.0f);
+		Math::Matrix4x4 reversed = Math::Matrix4x4::Perspective(1.0f, 1.5f, 0.1f, 100.0f, true);
+
+		REQUIRE(std::abs(Depth(standard, 0.1f)) < 1.0e-6f);
+		REQUIRE(std::abs(Depth(standard, 100.0f) - 1.0f) < 1.0e-6f);
+		REQUIRE(std::abs(Depth(reversed, 0.1f) - 1.0f) < 1.0e-6f);
+		REQUIRE(std::abs(Depth(reversed, 100.0f)) < 1.0e-6f);
+	}
+
+	SECTION("Infinite perspective", "[projection-infinite]") {
+		Math::Matrix4x4 standard = Math::Matrix4x4::Perspective(1.0f, 1.5f, 0.1f, infinity);
+		Math::Matrix4x4 reversed = Math::Matrix4x4::Perspective(1.0f, 1.5f, 0.1f, infinity, true);
+
+		REQUIRE(Depth(standard, 0.1f) == 0.0f);
+		REQUIRE(Depth(reversed, 0.1f) == 1.0f);
+		REQUIRE(Depth(standard, 1.0e30f) == 1.0f);
+		REQUIRE(Depth(reversed, 1.0e30f) < 1.0e-30f);
+	}
+
+	SECTION("Off-center frustum", "[projection-frustum]") {
+		Math::Matrix4x4 frustum = Math::Matrix4x4::Frustum(-0.1f, 0.3f, -0.05f, 0.15f, 0.1f, 50.0f);
+		Math::Vector4 corner = frustum * Math::Vector4(3.0f, 1.5f, 1.0f, 1.0f);
+
+		REQUIRE(std::abs(corner.x / corner.w - 1.0f) < 1.0e-6f);
+		REQUIRE(std::abs(corner.y / corner.w - 1.0f) < 1.0e-6f);
+	}
+
+	SECTION("Orthographic", "[projection-orthographic]") {
+		constexpr Math::Matrix4x4 orthographic = Math::Matrix4x4::Orthographic(-2.0f, 6.0f, -1.0f, 3.0f, 1.0f, 9.0f);
+		constexpr Math::Vector4 corner = orthographic * Math::Vector4(6.0f, -1.0f, 9.0f, 1.0f);
+
+		CONSTEXPR_REQUIRE(corner == Math::Vector4(1.0f, -1.0f, 1.0f, 1.0f));
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Orthographic(8.0f, 4.0f, 1.0f, 9.0f, true) * Math::Vector4(4.0f, 2.0f, 1.0f, 1.0f) == Math::Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+
+		// From the ratio, a view 2 units high, reversedZ not taken as a height
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Orthographic(2.0f, 1.0f, 9.0f) * Math::Vector4(2.0f, 1.0f, 1.0f, 1.0f) == Math::Vector4(1.0f, 1.0f, 0.0f, 1.0f));
+		CONSTEXPR_REQUIRE(Math::Matrix4x4::Orthographic(2.0f, 1.0f, 9.0f, true) * Math::Vector4(-2.0f, 1.0f, 1.0f, 1.0f) == Math::Vector4(-1.0f, 1.0f, 1.0f, 1.0f));
+	}
+}
+
+// MARK: Inverse
+TEST_CASE("Closed-form inverse of the projections", "[projection-inverse]") {
+	Math::Matrix4x4 const projections[] = {
+		Math::Matrix4x4::Perspective(1.0471975f, 256.0f / 240.0f, 0.1f, 1000.0f),
+		Math::Matrix4x4::Perspective(1.0471975f, 256.0f / 240.0f, 0.1f, 1000.0f, true),
+		Math::Matrix4x4::Frustum(-0.1f, 0.3f, -0.05f, 0.15f, 0.1f, 50.0f, true),
+		Math::Matrix4x4::Orthographic(1.5f, 0.1f, 100.0f),
+		Math::Matrix4x4::Orthographic(-2.0f, 6.0f, -1.0f, 3.0f, 1.0f, 9.0f, true),
+	};
+
+	for (Math::Matrix4x4 const& projection : projections) {
+		REQUIRE(AlmostEqual(Math::Matrix4x4::InverseProjection(projection), Math::Matrix4x4::Inverse(projection), 1.0e-5f));
+	}
+
+	// The general inverse is not defined for the infinite projections
+	Math::Matrix4x4 infinite = Math::Matrix4x4::Perspective(1.0f, 1.5f, 0.1f, infinity, true);
+	REQUIRE(AlmostEqual(infinite * Math::Matrix4x4::InverseProjection(infinite), Math::Matrix4x4::Identity(), 1.0e-6f));
+}
+
+// MARK: Precision
+TEST_CASE("Depth precision of the projections", "[projection-precision]") {
+	float const near = 0.1f;
+	float const far = 100000.0f;
+
+	Math::Matrix4x4 standard = Math::Matrix4x4::Perspective(1.0f, 1.5f, near, far);
+	Math::Matrix4x4 reversed = Math::Matrix4x4::Perspective(1.0f, 1.5f, near, far, true);
+	Math::Matrix4x4 reversedInfinite = Math::Matrix4x4::Perspective(1.0f, 1.5f, near, infinity, true);
+
+	double standardFloat = Math::MeasureDepthPrecision(standard, Math::DepthFormat::Depth32Float, near, far).maxError;
+	double reversedFloat = Math::MeasureDepthPrecision(reversed, Math::DepthFormat::Depth32Float, near, far).maxError;
+	double reversedInfiniteFloat = Math::MeasureDepthPrecision(reversedInfinite, Math::DepthFormat::Depth32Float, near, far).maxError;
+	double standardUnorm = Math::MeasureDepthPrecision(standard, Math::DepthFormat::Depth24Plus, near, far).maxError;
+	double reversedUnorm = Math::MeasureDepthPrecision(reversed, Math::DepthFormat::Depth24Plus, near, far).maxError;
+
+	// Floats are dense near 0, where reversed-Z sends the far distances
+	REQUIRE(reversedFloat < 1.0e-5);
+	REQUIRE(reversedInfiniteFloat < 1.0e-5);
+	REQUIRE(standardFloat > 100.0 * reversedFloat);
+
+	// A normalized integer has a uniform spacing, reversing it barely helps
+	REQUIRE(standardUnorm > 0.01);
+	REQUIRE(reversedUnorm > 0.01);
+}
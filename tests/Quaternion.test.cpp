@@ -0,0 +1,133 @@
+#include <cmath>
+#include <algorithm>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Quaternion.hpp>
+
+static bool AlmostEqual(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs, float epsilon) {
+	for (int i = 0; i < 16; ++i) {
+		if (std::abs(lhs[i] - rhs[i]) > epsilon) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool AlmostEqual(Math::Vector3 const& lhs, Math::Vector3 const& rhs, float epsilon) {
+	return std::abs(lhs.x - rhs.x) <= epsilon && std::abs(lhs.y - rhs.y) <= epsilon && std::abs(lhs.z - rhs.z) <= epsilon;
+}
+
+// Angle between two rotations, insensitive to the q / -q ambiguity
+static float AngleBetween(Math::Quaternion const& lhs, Math::Quaternion const& rhs) {
+	float d = std::min(1.0f, std::abs(Math::Quaternion::Dot(lhs, rhs)));
+	return 2.0f * std::acos(d);
+}
+
+// MARK: Composition
+TEST_CASE("Composition of quaternions", "[quaternion-multiply]") {
+	SECTION("Identity is neutral", "[multiply-identity]") {
+		constexpr Math::Quaternion q(0.5f, -0.5f, 0.5f, 0.5f);
+
+		CONSTEXPR_REQUIRE(q * Math::Quaternion::Identity() == q);
+		CONSTEXPR_REQUIRE(Math::Quaternion::Identity() * q == q);
+	}
+
+	SECTION("Simd product matches the scalar formula", "[multiply-simd]") {
+		Math::Quaternion a(0.1f, -0.7f, 0.3f, 0.64f);
+		Math::Quaternion b(-0.45f, 0.2f, 0.81f, -0.33f);
+		Math::Quaterniond reference = Math::Quaterniond(a) * Math::Quaterniond(b);
+
+		constexpr Math::Quaternion ca(0.1f, -0.7f, 0.3f, 0.64f);
+		constexpr Math::Quaternion cb(-0.45f, 0.2f, 0.81f, -0.33f);
+		constexpr Math::Quaternion folded = ca * cb;
+
+		REQUIRE(a * b == folded);
+		REQUIRE(std::abs((a * b).w - static_cast<float>(reference.w)) < 1.0e-6f);
+	}
+
+	SECTION("Products follow the matrices", "[multiply-matrix]") {
+		Math::Quaternion q = Math::Quaternion::RotateX(0.3f) * Math::Quaternion::RotateY(-1.2f);
+		Math::Matrix4x4 m = Math::Matrix4x4::RotateX(0.3f) * Math::Matrix4x4::RotateY(-1.2f);
+
+		REQUIRE(AlmostEqual(q.ToMatrix4x4(), m, 1.0e-6f));
+	}
+}
+
+// MARK: Rotation
+TEST_CASE("Rotation of vectors", "[quaternion-rotate]") {
+	Math::Vector3 axis = Math::Vector3::Normalize(Math::Vector3(1.0f, 2.0f, -0.5f));
+	Math::Quaternion q = Math::Quaternion::AxisAngle(axis, 2.1f);
+	Math::Vector3 v(0.3f, -4.0f, 2.5f);
+
+	Math::Vector4 expected = q.ToMatrix4x4() * Math::Vector4(v, 1.0f);
+	REQUIRE(AlmostEqual(q * v, Math::Vector3(expected.x, expected.y, expected.z), 1.0e-5f));
+	REQUIRE(AlmostEqual(Math::Quaternion::Inverse(q) * (q * v), v, 1.0e-5f));
+}
+
+// MARK: Matrix conversion
+TEST_CASE("Conversion from and to matrices", "[quaternion-matrix]") {
+	float const angles[] = { 0.0f, 0.5f, 1.7f, 3.1f, -2.9f };
+
+	for (float x : angles) {
+		for (float y : angles) {
+			Math::Quaternion q = Math::Quaternion::RotateZ(0.25f) * Math::Quaternion::RotateX(x) * Math::Quaternion::RotateY(y);
+			Math::Quaternion roundTrip = Math::Quaternion::FromMatrix(q.ToMatrix3x3());
+
+			REQUIRE(AngleBetween(q, roundTrip) < 1.0e-3f);
+		}
+	}
+}
+
+// MARK: Interpolation
+TEST_CASE("Interpolation between quaternions", "[quaternion-interpolation]") {
+	Math::Quaternion from = Math::Quaternion::RotateY(0.2f);
+	Math::Quaternion to = Math::Quaternion::AxisAngle(Math::Vector3::Normalize(Math::Vector3(1.0f, 1.0f, 0.0f)), 2.5f);
+
+	SECTION("Slerp has a constant angular velocity", "[slerp]") {
+		float total = AngleBetween(from, to);
+		for (int i = 0; i <= 10; ++i) {
+			float t = static_cast<float>(i) / 10.0f;
+			Math::Quaternion q = Math::Quaternion::Slerp(from, to, t);
+
+			REQUIRE(std::abs(AngleBetween(from, q) - t * total) < 1.0e-3f);
+		}
+	}
+
+	SECTION("FastSlerp stays close to slerp", "[fast-slerp]") {
+		for (int i = 0; i <= 10; ++i) {
+			float t = static_cast<float>(i) / 10.0f;
+
+			REQUIRE(AngleBetween(Math::Quaternion::FastSlerp(from, to, t), Math::Quaternion::Slerp(from, to, t)) < 2.0e-3f);
+		}
+	}
+
+	SECTION("Interpolation takes the shortest arc", "[shortest-arc]") {
+		Math::Quaternion q = Math::Quaternion::Nlerp(from, -from, 0.5f);
+
+		REQUIRE(AngleBetween(q, from) < 1.0e-3f);
+	}
+}
+
+// MARK: Dual quaternions
+TEST_CASE("Rigid transforms as dual quaternions", "[dual-quaternion]") {
+	Math::Quaternion rotation = Math::Quaternion::RotateX(0.7f) * Math::Quaternion::RotateZ(-0.4f);
+	Math::Vector3 translation(1.0f, -2.0f, 3.5f);
+	Math::DualQuaternion transform = Math::DualQuaternion::FromRotationTranslation(rotation, translation);
+
+	Math::Matrix4x4 matrix = Math::Matrix4x4::Translate(1.0f, -2.0f, 3.5f) * rotation.ToMatrix4x4();
+	REQUIRE(AlmostEqual(transform.ToMatrix4x4(), matrix, 1.0e-5f));
+	REQUIRE(AlmostEqual(transform.Translation(), translation, 1.0e-5f));
+
+	Math::Vector3 p(0.5f, 4.0f, -1.0f);
+	Math::Vector4 expected = matrix * Math::Vector4(p, 1.0f);
+	REQUIRE(AlmostEqual(transform.TransformPoint(p), Math::Vector3(expected.x, expected.y, expected.z), 1.0e-5f));
+
+	Math::DualQuaternion other = Math::DualQuaternion::FromRotationTranslation(Math::Quaternion::RotateY(1.1f), Math::Vector3(0.0f, 5.0f, 0.0f));
+	REQUIRE(AlmostEqual((transform * other).ToMatrix4x4(), transform.ToMatrix4x4() * other.ToMatrix4x4(), 1.0e-5f));
+	REQUIRE(AlmostEqual((Math::DualQuaternion::Inverse(transform) * transform).ToMatrix4x4(), Math::Matrix4x4::Identity(), 1.0e-5f));
+
+	Math::DualQuaternion halfway = Math::DualQuaternion::Nlerp(Math::DualQuaternion::Identity(), Math::DualQuaternion::FromTranslation(translation), 0.5f);
+	REQUIRE(AlmostEqual(halfway.Translation(), translation * 0.5f, 1.0e-5f));
+}
@@ -0,0 +1,99 @@
+#include <vector>
+#include <stdexcept>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Buffer/StagingRing.hpp>
+
+// MARK: Staging ring
+TEST_CASE("Staging ring", "[staging-ring]") {
+	SECTION("Allocations", "[staging-ring-allocations]") {
+		StagingRing ring(256, 2);
+		REQUIRE(ring.GetChunkCount() == 2);
+		REQUIRE(ring.GetCapacity() == 512);
+
+		// Small writes share the chunk, at their alignment
+		StagingAllocation first = ring.Allocate(10, 4);
+		StagingAllocation second = ring.Allocate(8, 16);
+		REQUIRE(first.chunk == 0);
+		REQUIRE(first.offset == 0);
+		REQUIRE(second.chunk == 0);
+		REQUIRE(second.offset == 16);
+		REQUIRE(ring.GetChunkState(0) == StagingRing::ChunkState::Open);
+		REQUIRE(ring.GetChunkState(1) == StagingRing::ChunkState::Free);
+
+		// The next chunk once the first one is full
+		StagingAllocation third = ring.Allocate(240, 4);
+		REQUIRE(third.chunk == 1);
+		REQUIRE(third.offset == 0);
+
+		REQUIRE(ring.Close() == std::vector<uint32_t> { 0, 1 });
+		REQUIRE(ring.GetStatistics().stagedBytes == 24 + 240);
+		REQUIRE(ring.GetStatistics().stalls == 0);
+
+		REQUIRE_THROWS_AS(ring.Allocate(0, 4), std::runtime_error);
+		REQUIRE_THROWS_AS(ring.Allocate(4, 3), std::runtime_error);
+		REQUIRE_THROWS_AS(StagingRing(0, 1), std::runtime_error);
+	}
+
+	SECTION("Chunks in flight", "[staging-ring-in-flight]") {
+		StagingRing ring(64, 2);
+		ring.Allocate(64, 4);
+		REQUIRE(ring.Close() == std::vector<uint32_t> { 0 });
+		REQUIRE(ring.GetChunkState(0) == StagingRing::ChunkState::InFlight);
+
+		ring.Allocate(64, 4);
+		REQUIRE(ring.Close() == std::vector<uint32_t> { 1 });
+
+		// Every chunk is in flight, a third one is added
+		StagingAllocation stalled = ring.Allocate(16, 4);
+		REQUIRE(stalled.chunk == 2);
+		REQUIRE(ring.GetChunkCount() == 3);
+		REQUIRE(ring.GetStatistics().stalls == 1);
+		ring.Close();
+
+		// Recycled chunks are used again in the order of the ring
+		ring.Recycle(0);
+		ring.Recycle(1);
+		REQUIRE(ring.GetChunkState(0) == StagingRing::ChunkState::Free);
+		REQUIRE_THROWS_AS(ring.Recycle(0), std::runtime_error);
+
+		REQUIRE(ring.Allocate(16, 4).chunk == 0);
+		REQUIRE(ring.GetStatistics().wraparounds == 1);
+		REQUIRE(ring.Allocate(64, 4).chunk == 1);
+		REQUIRE(ring.GetStatistics().wraparounds == 1);
+		REQUIRE(ring.GetStatistics().stalls == 1);
+	}
+
+	SECTION("Large allocations", "[staging-ring-large]") {
+		StagingRing ring(64, 2);
+		ring.Allocate(16, 4);
+
+		// A temporary chunk of its own, which is not a stall
+		StagingAllocation large = ring.Allocate(1000, 4);
+		REQUIRE(large.chunk == 2);
+		REQUIRE(large.offset == 0);
+		REQUIRE(ring.GetChunkSize(2) == 1000);
+		REQUIRE(ring.IsTemporary(2));
+		REQUIRE(ring.GetStatistics().oversized == 1);
+		REQUIRE(ring.GetStatistics().stalls == 0);
+
+		// The next writes go on in the chunk written before
+		REQUIRE(ring.Allocate(32, 4).chunk == 0);
+		REQUIRE(ring.Close() == std::vector<uint32_t> { 0, 2 });
+		REQUIRE(ring.GetStatistics().stagedBytes == 48 + 1000);
+
+		// Released once recycled, and its place used by the next one
+		ring.Recycle(2);
+		REQUIRE(ring.GetChunkState(2) == StagingRing::ChunkState::Released);
+		REQUIRE(ring.GetChunkSize(2) == 0);
+		REQUIRE(ring.GetCapacity() == 128);
+		REQUIRE_THROWS_AS(ring.Recycle(2), std::runtime_error);
+
+		REQUIRE(ring.Allocate(500, 4).chunk == 2);
+		REQUIRE(ring.GetChunkCount() == 3);
+		REQUIRE(ring.GetChunkSize(2) == 500);
+		REQUIRE(ring.GetStatistics().oversized == 2);
+		REQUIRE(ring.GetStatistics().totalStagedBytes == 1548);
+	}
+}
@@ -0,0 +1,28 @@
+#ifndef TEMPORARYFILES_HPP
+#define TEMPORARYFILES_HPP
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <string>
+
+// Path of a file of the tests in the temporary directory. The random prefix,
+// drawn once per process, keeps concurrent runs from sharing their files.
+inline std::filesystem::path TemporaryPath(std::string const& name) {
+	static std::string const prefix = "gammashade_" + std::to_string(std::random_device {}()) + "_";
+	return std::filesystem::temp_directory_path() / (prefix + name);
+}
+
+inline std::vector<char> ReadFile(std::filesystem::path const& path) {
+	std::ifstream file(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+inline void WriteFile(std::filesystem::path const& path, std::vector<char> const& bytes) {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+#endif // TEMPORARYFILES_HPP
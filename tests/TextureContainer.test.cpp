@@ -0,0 +1,183 @@
+#include <filesystem>
+#include <vector>
+#include <array>
+#include <string>
+#include <stdexcept>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+
+#include "TemporaryFiles.hpp"
+
+static std::vector<uint8_t> MakeGradient(uint32_t width, uint32_t height, uint8_t seed) {
+	std::vector<uint8_t> pixels(4 * static_cast<size_t>(width) * height);
+	for (size_t i = 0; i < pixels.size(); ++i) {
+		pixels[i] = static_cast<uint8_t>(i * 7 + seed);
+	}
+
+	return pixels;
+}
+
+// MARK: Round trip
+TEST_CASE("Texture containers", "[texture-container]") {
+	SECTION("2D texture", "[texture-container-2d]") {
+		std::vector<uint8_t> image = MakeGradient(37, 20, 3);
+		MipChain chain(image.data(), 37, 20, MipFilter::Box, ColorSpace::Srgb);
+
+		TextureContainerWriter writer(TextureContainerFormat::RGBA8UnormSrgb, 37, 20, 1, chain.GetLevelCount());
+		for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+			writer.SetLevel(0, level, chain.GetData(level), chain.GetSize(level));
+		}
+
+		std::filesystem::path path = TemporaryPath("2d.gstex");
+		writer.Write(path);
+		REQUIRE(!std::filesystem::exists(path.string() + ".tmp"));
+
+		TextureContainer container(path);
+		REQUIRE(container.GetFormat() == TextureContainerFormat::RGBA8UnormSrgb);
+		REQUIRE(container.GetLayerCount() == 1);
+		REQUIRE(container.GetLevelCount() == 6);
+		REQUIRE(!container.IsCubemap());
+
+		for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+			REQUIRE(container.GetWidth(level) == chain.GetLevel(level).width);
+			REQUIRE(container.GetHeight(level) == chain.GetLevel(level).height);
+			REQUIRE(container.GetSize(level) == chain.GetSize(level));
+			REQUIRE(std::vector<uint8_t>(container.GetData(0, level), container.GetData(0, level) + container.GetSize(level)) == std::vector<uint8_t>(chain.GetData(level), chain.GetData(level) + chain.GetSize(level)));
+
+			// Aligned levels, the smallest first
+			REQUIRE(reinterpret_cast<uintptr_t>(container.GetData(0, level)) % 16 == 0);
+			if (level != 0) {
+				REQUIRE(container.GetData(0, level) < container.GetData(0, level - 1));
+			}
+		}
+
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Cubemap", "[texture-container-cubemap]") {
+		std::array<std::vector<uint8_t>, 6> faces {};
+		std::array<uint8_t const*, 6> data {};
+		for (uint8_t face = 0; face < 6; ++face) {
+			faces[face] = MakeGradient(16, 16, face);
+			data[face] = faces[face].data();
+		}
+
+		std::array<MipChain, 6> chains = GenerateCubemapMipChains(data, 16, MipFilter::Box, ColorSpace::Linear, true, 3);
+		TextureContainerWriter writer(TextureContainerFormat::RGBA8Unorm, 16, 16, 6, 3, true);
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			for (uint32_t level = 0; level < 3; ++level) {
+				writer.SetLevel(layer, level, chains[layer].GetData(level), chains[layer].GetSize(level));
+			}
+		}
+
+		std::filesystem::path path = TemporaryPath("cubemap.gstex");
+		writer.Write(path);
+
+		TextureContainer container(path);
+		REQUIRE(container.IsCubemap());
+		REQUIRE(container.GetLayerCount() == 6);
+		REQUIRE(container.GetLevelCount() == 3);
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			for (uint32_t level = 0; level < 3; ++level) {
+				REQUIRE(std::vector<uint8_t>(container.GetData(layer, level), container.GetData(layer, level) + container.GetSize(level)) == std::vector<uint8_t>(chains[layer].GetData(level), chains[layer].GetData(level) + chains[layer].GetSize(level)));
+			}
+		}
+
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Block-compressed texture", "[texture-container-block-compressed]") {
+		std::vector<uint8_t> image = MakeGradient(32, 12, 5);
+		MipChain chain(image.data(), 32, 12);
+		BlockCompressedChain compressed(chain, BlockFormat::BC7);
+
+		TextureContainerFormat format = GetContainerFormat(BlockFormat::BC7, ColorSpace::Srgb);
+		REQUIRE(format == TextureContainerFormat::BC7RGBAUnormSrgb);
+		REQUIRE(IsBlockCompressed(format));
+		REQUIRE(GetBlockFormat(format) == BlockFormat::BC7);
+		REQUIRE(GetColorSpace(format) == ColorSpace::Srgb);
+
+		TextureContainerWriter writer(format, 32, 12, 1, compressed.GetLevelCount());
+		for (uint32_t level = 0; level < compressed.GetLevelCount(); ++level) {
+			writer.SetLevel(0, level, compressed.GetData(level), compressed.GetSize(level));
+		}
+
+		std::filesystem::path path = TemporaryPath("bc7.gstex");
+		writer.Write(path);
+
+		// The levels smaller than a block still take a whole block
+		TextureContainer container(path);
+		REQUIRE(container.GetFormat() == format);
+		for (uint32_t level = 0; level < compressed.GetLevelCount(); ++level) {
+			REQUIRE(container.GetSize(level) == compressed.GetSize(level));
+			REQUIRE(TextureContainerRowSize(format, container.GetWidth(level)) == compressed.GetRowSize(level));
+			REQUIRE(TextureContainerRowCount(format, container.GetHeight(level)) == compressed.GetRowCount(level));
+			REQUIRE(std::vector<uint8_t>(container.GetData(0, level), container.GetData(0, level) + container.GetSize(level)) == std::vector<uint8_t>(compressed.GetData(level), compressed.GetData(level) + compressed.GetSize(level)));
+		}
+
+		REQUIRE(container.GetSize(container.GetLevelCount() - 1) == 16);
+
+		std::filesystem::remove(path);
+	}
+}
+
+// MARK: Errors
+TEST_CASE("Invalid texture containers", "[texture-container-errors]") {
+	std::vector<uint8_t> image = MakeGradient(8, 8, 0);
+	MipChain chain(image.data(), 8, 8);
+
+	SECTION("Writing", "[texture-container-write-errors]") {
+		REQUIRE_THROWS_AS(TextureContainerWriter(TextureContainerFormat::RGBA8Unorm, 8, 8, 1, 5), std::runtime_error);
+		REQUIRE_THROWS_AS(TextureContainerWriter(TextureContainerFormat::RGBA8Unorm, 8, 4, 6, 1, true), std::runtime_error);
+		REQUIRE_THROWS_AS(TextureContainerWriter(TextureContainerFormat::RGBA8Unorm, 0, 8, 1, 1), std::runtime_error);
+		REQUIRE_THROWS_AS(TextureContainerWriter(TextureContainerFormat::BC1RGBAUnorm, 8, 6, 1, 1), std::runtime_error);
+		REQUIRE_THROWS_AS(GetBlockFormat(TextureContainerFormat::RGBA8Unorm), std::runtime_error);
+
+		TextureContainerWriter writer(TextureContainerFormat::RGBA8Unorm, 8, 8, 1, 2);
+		REQUIRE_THROWS_AS(writer.SetLevel(0, 1, chain.GetData(0), chain.GetSize(0)), std::runtime_error);
+		REQUIRE_THROWS_AS(writer.SetLevel(1, 0, chain.GetData(0), chain.GetSize(0)), std::runtime_error);
+
+		writer.SetLevel(0, 0, chain.GetData(0), chain.GetSize(0));
+		REQUIRE_THROWS_AS(writer.Write(TemporaryPath("missing.gstex")), std::runtime_error);
+	}
+
+	SECTION("Reading", "[texture-container-read-errors]") {
+		std::filesystem::path path = TemporaryPath("invalid.gstex");
+		TextureContainerWriter writer(TextureContainerFormat::RGBA8Unorm, 8, 8, 1, 4);
+		for (uint32_t level = 0; level < 4; ++level) {
+			writer.SetLevel(0, level, chain.GetData(level), chain.GetSize(level));
+		}
+
+		writer.Write(path);
+		std::vector<char> valid = ReadFile(path);
+
+		REQUIRE_THROWS_AS(TextureContainer { TemporaryPath("does_not_exist.gstex") }, std::runtime_error);
+
+		std::vector<char> truncated(valid.begin(), valid.end() - 1);
+		WriteFile(path, truncated);
+		REQUIRE_THROWS_AS(TextureContainer { path }, std::runtime_error);
+
+		std::vector<char> wrongMagic = valid;
+		wrongMagic[0] = 'X';
+		WriteFile(path, wrongMagic);
+		REQUIRE_THROWS_AS(TextureContainer { path }, std::runtime_error);
+
+		// The level count, after the identifier and 5 values
+		std::vector<char> tooManyLevels = valid;
+		tooManyLevels[8 + 5 * 4] = 9;
+		WriteFile(path, tooManyLevels);
+		REQUIRE_THROWS_AS(TextureContainer { path }, std::runtime_error);
+
+		WriteFile(path, std::vector<char>(valid.begin(), valid.begin() + 10));
+		REQUIRE_THROWS_AS(TextureContainer { path }, std::runtime_error);
+
+		WriteFile(path, valid);
+		REQUIRE(TextureContainer(path).GetLevelCount() == 4);
+
+		std::filesystem::remove(path);
+	}
+}
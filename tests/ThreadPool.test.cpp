@@ -0,0 +1,48 @@
+#include <vector>
+#include <future>
+#include <atomic>
+#include <stdexcept>
+
+#include <snitch/snitch.hpp>
+
+#include <Utils/ThreadPool.hpp>
+
+// MARK: Thread pool
+TEST_CASE("Thread pool", "[thread-pool]") {
+	SECTION("Results in the order of submission", "[thread-pool-results]") {
+		Utils::ThreadPool threadPool(3);
+		REQUIRE(threadPool.GetThreadCount() == 3);
+
+		std::vector<std::future<int>> results {};
+		for (int i = 0; i < 100; ++i) {
+			results.push_back(threadPool.Submit([i]() { return i * i; }));
+		}
+
+		for (int i = 0; i < 100; ++i) {
+			REQUIRE(results[i].get() == i * i);
+		}
+	}
+
+	SECTION("Exceptions", "[thread-pool-exceptions]") {
+		Utils::ThreadPool threadPool(2);
+		std::future<int> failed = threadPool.Submit([]() -> int { throw std::runtime_error("Failed"); });
+		std::future<int> succeeded = threadPool.Submit([]() { return 7; });
+
+		REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+		REQUIRE(succeeded.get() == 7);
+	}
+
+	SECTION("Queued tasks run before destruction", "[thread-pool-destruction]") {
+		std::atomic<int> count { 0 };
+		{
+			Utils::ThreadPool threadPool(0);
+			REQUIRE(threadPool.GetThreadCount() == 1);
+
+			for (int i = 0; i < 50; ++i) {
+				threadPool.Submit([&count]() { count.fetch_add(1); });
+			}
+		}
+
+		REQUIRE(count.load() == 50);
+	}
+}
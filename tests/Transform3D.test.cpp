@@ -0,0 +1,68 @@
+#include <cmath>
+
+#include <snitch/snitch.hpp>
+
+#include <Math/Transform3D.hpp>
+
+static bool AlmostEqual(Math::Matrix4x4 const& lhs, Math::Matrix4x4 const& rhs, float epsilon) {
+	for (int i = 0; i < 16; ++i) {
+		if (std::abs(lhs[i] - rhs[i]) > epsilon) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// MARK: Kind
+TEST_CASE("Kind of the composed transforms", "[transform-kind]") {
+	using Kind = Math::Transform3D::Kind;
+
+	Math::Transform3D rigid = Math::Transform3D::Translate(1.0f, 2.0f, 3.0f) * Math::Transform3D::RotateY(0.5f);
+	Math::Transform3D uniform = rigid * Math::Transform3D::Scale(2.0f);
+	Math::Transform3D general = uniform * Math::Transform3D::Scale(1.0f, 2.0f, 3.0f);
+
+	REQUIRE(rigid.GetKind() == Kind::Rigid);
+	REQUIRE(uniform.GetKind() == Kind::UniformScale);
+	REQUIRE(general.GetKind() == Kind::General);
+	REQUIRE(Math::Transform3D::Scale(3.0f, 3.0f, 3.0f).GetKind() == Kind::UniformScale);
+	REQUIRE((general * rigid).GetKind() == Kind::General);
+}
+
+// MARK: Composition
+TEST_CASE("Composition of transforms", "[transform-multiply]") {
+	Math::Transform3D a = Math::Transform3D::Translate(1.0f, -2.0f, 0.5f) * Math::Transform3D::RotateX(0.3f) * Math::Transform3D::Scale(1.5f, 0.5f, 2.0f);
+	Math::Transform3D b = Math::Transform3D::RotateZ(-1.1f) * Math::Transform3D::Translate(4.0f, 0.0f, -3.0f);
+
+	Math::Matrix4x4 expected = a.ToMatrix4x4() * b.ToMatrix4x4();
+	REQUIRE((a * b).ToMatrix4x4() == expected);
+
+	constexpr Math::Transform3D c = Math::Transform3D::Translate(1.0f, 2.0f, 3.0f) * Math::Transform3D::Scale(2.0f);
+	CONSTEXPR_REQUIRE(c.TransformPoint(Math::Vector3(1.0f, 1.0f, 1.0f)) == Math::Vector3(3.0f, 4.0f, 5.0f));
+	CONSTEXPR_REQUIRE(c.TransformDirection(Math::Vector3(1.0f, 1.0f, 1.0f)) == Math::Vector3(2.0f, 2.0f, 2.0f));
+}
+
+// MARK: Inverse
+TEST_CASE("Inverse of transforms", "[transform-inverse]") {
+	Math::Transform3D const transforms[] = {
+		Math::Transform3D::LookAt(Math::Vector3(3.0f, 1.0f, -5.0f), Math::Vector3(0.0f), Math::Vector3(0.0f, 1.0f, 0.0f)),
+		Math::Transform3D::Translate(1.0f, 2.0f, 3.0f) * Math::Transform3D::Rotate(Math::Quaternion::RotateY(0.8f)) * Math::Transform3D::Scale(0.25f),
+		Math::Transform3D::RotateX(0.4f) * Math::Transform3D::Scale(3.0f, 0.5f, 1.0f) * Math::Transform3D::Translate(-1.0f, 0.0f, 7.0f),
+	};
+
+	for (Math::Transform3D const& t : transforms) {
+		Math::Matrix4x4 inverse = Math::Transform3D::Inverse(t).ToMatrix4x4();
+
+		REQUIRE(AlmostEqual(inverse, Math::Matrix4x4::Inverse(t.ToMatrix4x4()), 1.0e-5f));
+		REQUIRE(AlmostEqual((Math::Transform3D::Inverse(t) * t).ToMatrix4x4(), Math::Matrix4x4::Identity(), 1.0e-5f));
+	}
+}
+
+// MARK: Conversion
+TEST_CASE("Conversion from dual quaternions", "[transform-dual-quaternion]") {
+	Math::DualQuaternion q = Math::DualQuaternion::FromRotationTranslation(Math::Quaternion::RotateZ(0.6f), Math::Vector3(1.0f, 2.0f, 3.0f));
+	Math::Transform3D t(q);
+
+	REQUIRE(t.GetKind() == Math::Transform3D::Kind::Rigid);
+	REQUIRE(AlmostEqual(t.ToMatrix4x4(), q.ToMatrix4x4(), 0.0f));
+}
@@ -0,0 +1,57 @@
+#include <stdexcept>
+#include <cstdint>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Buffer/UniformAllocator.hpp>
+
+struct TestUniforms {
+public:
+	float color[4];
+	float time;
+};
+
+// MARK: Uniform allocator
+TEST_CASE("Uniform allocator", "[uniform-allocator]") {
+	SECTION("Aligned slices", "[uniform-allocator-slices]") {
+		UniformAllocator allocator(1000, 256);
+		REQUIRE(allocator.GetCapacity() == 1024);
+		REQUIRE(allocator.GetAlignment() == 256);
+
+		TestUniforms uniforms { { 1.0f, 0.5f, 0.25f, 1.0f }, 2.0f };
+		uint32_t first = allocator.Push(uniforms);
+		uint32_t second = allocator.Allocate(6);
+		REQUIRE(first == 0);
+		REQUIRE(second == 256);
+		REQUIRE(allocator.GetCount() == 2);
+
+		// Up to the end of the last slice, rounded to 4
+		REQUIRE(allocator.GetUsedBytes() == 264);
+
+		TestUniforms const* copy = reinterpret_cast<TestUniforms const*>(allocator.GetData() + first);
+		REQUIRE(copy->color[1] == 0.5f);
+		REQUIRE(copy->time == 2.0f);
+		REQUIRE(allocator.GetData(second)[5] == 0);
+	}
+
+	SECTION("Full allocator", "[uniform-allocator-full]") {
+		UniformAllocator allocator(512, 256);
+		allocator.Allocate(200);
+		allocator.Allocate(256);
+		REQUIRE_THROWS_AS(allocator.Allocate(4), std::runtime_error);
+		REQUIRE_THROWS_AS(allocator.Allocate(0), std::runtime_error);
+
+		// Reused from the start of the buffer
+		allocator.Reset();
+		REQUIRE(allocator.GetCount() == 0);
+		REQUIRE(allocator.GetUsedBytes() == 0);
+		REQUIRE(allocator.Allocate(512) == 0);
+	}
+
+	SECTION("Invalid allocators", "[uniform-allocator-invalid]") {
+		REQUIRE_THROWS_AS(UniformAllocator(256, 0), std::runtime_error);
+		REQUIRE_THROWS_AS(UniformAllocator(256, 2), std::runtime_error);
+		REQUIRE_THROWS_AS(UniformAllocator(256, 96), std::runtime_error);
+		REQUIRE_THROWS_AS(UniformAllocator(0, 256), std::runtime_error);
+	}
+}
@@ -3,13 +3,21 @@
 
 #include <snitch/snitch.hpp>
 
-#include <Math/Vector2.hpp>
+#include <Math/Vector.hpp>
 
 // MARK: Size
 TEST_CASE("Math::Vector2 is always 8 bytes in size", "[vector-size]") {
 	REQUIRE(sizeof(Math::Vector2) == 8);
 }
 
+// MARK: Compile-time evaluation
+TEST_CASE("Math::Vector2 is usable in constant expressions", "[vector-constexpr]") {
+	constexpr Math::Vector2 vec1(2.0f, -7.0f);
+	constexpr Math::Vector2 vec2(-5.0f, 3.0f);
+	CONSTEXPR_REQUIRE(vec1 + vec2 == Math::Vector2(-3.0f, -4.0f));
+	CONSTEXPR_REQUIRE(Math::Vector2::Dot(vec1, vec2) == -31.0f);
+}
+
 // MARK: Constructors
 TEST_CASE("Constructing a vector", "[vector-construction]") {
 	SECTION("Default constructing", "[construction-default]") {
@@ -0,0 +1,77 @@
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+#include <snitch/snitch.hpp>
+
+#include <Resources/Geometry/VertexQuantization.hpp>
+
+// MARK: Encodings
+TEST_CASE("Vertex encodings", "[vertex-quantization-encodings]") {
+	SECTION("Snorm16", "[vertex-quantization-snorm]") {
+		REQUIRE(EncodeSnorm16(1.0f) == 32767);
+		REQUIRE(EncodeSnorm16(-1.0f) == -32767);
+		REQUIRE(EncodeSnorm16(2.0f) == 32767);
+		REQUIRE(EncodeSnorm16(0.0f) == 0);
+		REQUIRE(DecodeSnorm16(-32768) == -1.0f);
+		REQUIRE(DecodeSnorm16(32767) == 1.0f);
+		REQUIRE(std::abs(DecodeSnorm16(EncodeSnorm16(0.3f)) - 0.3f) <= 0.5f / 32767.0f);
+	}
+
+	SECTION("Octahedral normals", "[vertex-quantization-octahedral]") {
+		std::vector<Math::Vector3> normals {
+			{ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f },
+			Math::Vector3::Normalize({ 1.0f, 2.0f, -3.0f }), Math::Vector3::Normalize({ -0.2f, -0.7f, -0.1f }) };
+
+		for (Math::Vector3 const& normal : normals) {
+			Math::Vector2 encoded = EncodeOctahedral(normal);
+			REQUIRE(std::abs(encoded.x) <= 1.0f);
+			REQUIRE(std::abs(encoded.y) <= 1.0f);
+
+			// Through snorm16 too, as the vertex fetch reads it
+			Math::Vector2 fetched(DecodeSnorm16(EncodeSnorm16(encoded.x)), DecodeSnorm16(EncodeSnorm16(encoded.y)));
+			REQUIRE(Math::Vector3::Dot(DecodeOctahedral(fetched), normal) > 0.99999f);
+		}
+
+		REQUIRE(DecodeOctahedral(EncodeOctahedral(Math::Vector3 {})) == Math::Vector3(0.0f, 0.0f, 1.0f));
+	}
+}
+
+// MARK: Meshes
+TEST_CASE("Quantized meshes", "[vertex-quantization-meshes]") {
+	IndexedMesh mesh {};
+	mesh.vertices = {
+		{ { -2.0f, 1.0f, 10.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f } },
+		{ { 6.0f, 1.0f, 12.5f }, Math::Vector3::Normalize({ 1.0f, 1.0f, -1.0f }), { 1.0f, 0.25f } },
+		{ { 0.3f, 1.0f, 11.0f }, { 0.0f, 0.0f, -1.0f }, { 0.5f, 0.333f } } };
+	mesh.indices = { 0, 1, 2 };
+	mesh.parts = { MeshPart { "triangle", 0, 3 } };
+
+	QuantizedMesh quantized = QuantizeMesh(mesh);
+	REQUIRE(quantized.indices == mesh.indices);
+	REQUIRE(quantized.parts.size() == 1);
+	REQUIRE(quantized.bounds.min == Math::Vector3(-2.0f, 1.0f, 10.0f));
+	REQUIRE(quantized.bounds.max == Math::Vector3(6.0f, 1.0f, 12.5f));
+	REQUIRE(quantized.vertices.size() * sizeof(QuantizedVertex) * 2 == mesh.vertices.size() * sizeof(VertexAttributes));
+
+	Math::Vector3 extents = quantized.bounds.Extents();
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		VertexAttributes const& source = mesh.vertices[i];
+		QuantizedVertex const& vertex = quantized.vertices[i];
+		VertexAttributes decoded = DequantizeVertex(vertex, quantized.bounds);
+
+		// Half a step of the bounds on each axis, the flat one being exact
+		REQUIRE(std::abs(decoded.position.x - source.position.x) <= extents.x / 32767.0f);
+		REQUIRE(decoded.position.y == source.position.y);
+		REQUIRE(std::abs(decoded.position.z - source.position.z) <= extents.z / 32767.0f);
+		REQUIRE(Math::Vector3::Dot(decoded.normal, source.normal) > 0.99999f);
+		REQUIRE(std::abs(decoded.uv.y - source.uv.y) <= 0.001f);
+
+		// What the vertex shader does with the fetched position
+		Math::Vector4 fetched(DecodeSnorm16(vertex.position[0]), DecodeSnorm16(vertex.position[1]), DecodeSnorm16(vertex.position[2]), DecodeSnorm16(vertex.position[3]));
+		Math::Vector4 position = quantized.dequantization * fetched;
+		REQUIRE(std::abs(position.x - source.position.x) <= extents.x / 32767.0f);
+		REQUIRE(std::abs(position.z - source.position.z) <= extents.z / 32767.0f);
+		REQUIRE(position.w == 1.0f);
+	}
+}
@@ -0,0 +1,484 @@
+#include <iostream>
+#include <iomanip>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <thread>
+#include <exception>
+#include <future>
+#include <optional>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+
+#include <Resources/Texture/Image.hpp>
+#include <Resources/Texture/MipMaps.hpp>
+#include <Resources/Texture/BlockCompression.hpp>
+#include <Resources/Texture/TextureContainer.hpp>
+#include <Resources/Geometry/GeometryLoader.hpp>
+#include <Resources/Geometry/MeshOptimizer.hpp>
+#include <Resources/Geometry/VertexQuantization.hpp>
+#include <Resources/Geometry/MeshContainer.hpp>
+#include <Utils/ThreadPool.hpp>
+
+// Converts images to texture containers, with every mip level already
+// filtered, and OBJ files to mesh containers, welded and optimized, so that
+// the application only has to map them and upload them
+
+struct CookOptions {
+public:
+	std::filesystem::path outputDirectory = "resources";
+	MipFilter filter = MipFilter::Kaiser;
+	ColorSpace colorSpace = ColorSpace::Srgb;
+	std::optional<BlockFormat> compression {};
+	bool seamAware = true;
+	bool quantize = false;
+	bool meshlets = false;
+	bool force = false;
+};
+
+// Faces in the order of the layers: +X, -X, +Y, -Y, +Z, -Z
+struct CubemapInput {
+public:
+	std::string name {};
+	std::array<std::filesystem::path, 6> faces {};
+};
+
+// MARK: Inputs
+// Suffixes of the faces of a cubemap in the names of the files, like
+// stars_px.jpg or pos-x.jpg
+static std::array<std::array<char const*, 6>, 3> const faceTokens { {
+	{ "px", "nx", "py", "ny", "pz", "nz" },
+	{ "pos-x", "neg-x", "pos-y", "neg-y", "pos-z", "neg-z" },
+	{ "pos_x", "neg_x", "pos_y", "neg_y", "pos_z", "neg_z" },
+} };
+
+// The faces of each complete set among paths are moved from paths to the
+// returned cubemaps. The name of a cubemap is the name of its +X face with
+// the suffix replaced by "cube", or followed by "_cube" if that one is taken.
+static std::vector<CubemapInput> FindCubemaps(std::vector<std::filesystem::path>& paths, std::set<std::string>& names) {
+	std::vector<CubemapInput> cubemaps {};
+
+	for (auto const& tokens : faceTokens) {
+		// Faces found for each prefix, sorted so that the names do not depend
+		// on the order of the files
+		std::map<std::string, std::array<std::filesystem::path, 6>> sets {};
+
+		for (std::filesystem::path const& path : paths) {
+			std::string stem = path.stem().string();
+
+			for (size_t face = 0; face < 6; ++face) {
+				std::string token = tokens[face];
+				if (stem.size() < token.size() || stem.compare(stem.size() - token.size(), token.size(), token) != 0) {
+					continue;
+				}
+
+				std::string prefix = stem.substr(0, stem.size() - token.size());
+				if (!prefix.empty() && prefix.back() != '_' && prefix.back() != '-' && prefix.back() != '.') {
+					continue;
+				}
+
+				sets[(path.parent_path() / prefix).string()][face] = path;
+			}
+		}
+
+		for (auto const& [prefix, faces] : sets) {
+			if (std::any_of(faces.begin(), faces.end(), [](std::filesystem::path const& face) { return face.empty(); })) {
+				continue;
+			}
+
+			std::string positiveX = faces[0].stem().string();
+			std::string name = positiveX.substr(0, positiveX.size() - std::string(tokens[0]).size()) + "cube";
+			if (names.count(name) != 0) {
+				name = positiveX + "_cube";
+			}
+
+			names.insert(name);
+			cubemaps.push_back({ name, faces });
+
+			for (std::filesystem::path const& face : faces) {
+				paths.erase(std::find(paths.begin(), paths.end(), face));
+			}
+		}
+	}
+
+	return cubemaps;
+}
+
+// Whether output exists and is newer than every input. The options are not
+// stored in the containers: changing them needs --force.
+static bool UpToDate(std::filesystem::path const& output, std::vector<std::filesystem::path> const& inputs) {
+	if (!std::filesystem::exists(output)) {
+		return false;
+	}
+
+	auto outputTime = std::filesystem::last_write_time(output);
+	return std::all_of(inputs.begin(), inputs.end(), [&](std::filesystem::path const& input) {
+		return std::filesystem::last_write_time(input) <= outputTime;
+	});
+}
+
+// MARK: Cooking
+// The blocks need whole blocks in the first level, the images of other sizes
+// are kept uncompressed
+static std::optional<BlockFormat> Compression(std::filesystem::path const& output, uint32_t width, uint32_t height, CookOptions const& options) {
+	if (options.compression.has_value() && (width % 4 != 0 || height % 4 != 0)) {
+		std::cerr << "Warning: " << output.string() << " is " << width << "x" << height << ", not a multiple of 4, kept uncompressed" << std::endl;
+		return std::nullopt;
+	}
+
+	return options.compression;
+}
+
+static TextureContainerFormat ContainerFormat(std::optional<BlockFormat> compression, ColorSpace colorSpace) {
+	return compression.has_value() ? GetContainerFormat(*compression, colorSpace) : GetContainerFormat(colorSpace);
+}
+
+static void PrintCooked(std::filesystem::path const& output, uint32_t width, uint32_t height, uint32_t layerCount, uint32_t levelCount, std::chrono::steady_clock::time_point start) {
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	double mebibytes = static_cast<double>(std::filesystem::file_size(output)) / (1024.0 * 1024.0);
+
+	std::cout << "Cooked " << output.string() << ": " << width << "x" << height << ", "
+		<< layerCount << (layerCount == 1 ? " layer, " : " layers, ") << levelCount << " levels, "
+		<< std::fixed << std::setprecision(1) << mebibytes << " MiB in " << std::setprecision(2) << seconds << " s" << std::endl;
+}
+
+static void CookTexture(std::filesystem::path const& path, std::filesystem::path const& output, CookOptions const& options, unsigned threadCount) {
+	auto start = std::chrono::steady_clock::now();
+
+	MipChain chain {};
+	{
+		Image image = Image::Load(path);
+		chain.Generate(image.Data(), image.Width(), image.Height(), options.filter, options.colorSpace, 0, threadCount);
+	}
+
+	MipChain::Level const& base = chain.GetLevel(0);
+	std::optional<BlockFormat> compression = Compression(output, base.width, base.height, options);
+	TextureContainerWriter writer(ContainerFormat(compression, options.colorSpace), base.width, base.height, 1, chain.GetLevelCount());
+
+	if (compression.has_value()) {
+		BlockCompressedChain compressed(chain, *compression, threadCount);
+		for (uint32_t level = 0; level < compressed.GetLevelCount(); ++level) {
+			writer.SetLevel(0, level, compressed.GetData(level), compressed.GetSize(level));
+		}
+	}
+
+	else {
+		for (uint32_t level = 0; level < chain.GetLevelCount(); ++level) {
+			writer.SetLevel(0, level, chain.GetData(level), chain.GetSize(level));
+		}
+	}
+
+	writer.Write(output);
+	PrintCooked(output, base.width, base.height, 1, chain.GetLevelCount(), start);
+}
+
+static void CookCubemap(CubemapInput const& cubemap, std::filesystem::path const& output, CookOptions const& options, Utils::ThreadPool& threadPool) {
+	auto start = std::chrono::steady_clock::now();
+
+	std::array<MipChain, 6> chains {};
+	{
+		std::array<Image, 6> faces = LoadCubemapFaces(cubemap.faces, threadPool);
+		if (faces[0].Width() != faces[0].Height()) {
+			throw std::runtime_error("Cubemap faces must be square");
+		}
+
+		std::array<uint8_t const*, 6> data {};
+		for (size_t face = 0; face < 6; ++face) {
+			data[face] = faces[face].Data();
+		}
+
+		chains = GenerateCubemapMipChains(data, faces[0].Width(), options.filter, options.colorSpace, options.seamAware, 0, threadPool.GetThreadCount());
+	}
+
+	uint32_t size = chains[0].GetLevel(0).width;
+	uint32_t levelCount = chains[0].GetLevelCount();
+	std::optional<BlockFormat> compression = Compression(output, size, size, options);
+	TextureContainerWriter writer(ContainerFormat(compression, options.colorSpace), size, size, 6, levelCount, true);
+
+	if (compression.has_value()) {
+		// A face per task, each chain being freed once compressed
+		std::array<std::future<BlockCompressedChain>, 6> compressions {};
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			compressions[layer] = threadPool.Submit([chain = std::move(chains[layer]), format = *compression]() {
+				return BlockCompressedChain(chain, format);
+			});
+		}
+
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			BlockCompressedChain compressed = compressions[layer].get();
+			for (uint32_t level = 0; level < levelCount; ++level) {
+				writer.SetLevel(layer, level, compressed.GetData(level), compressed.GetSize(level));
+			}
+		}
+	}
+
+	else {
+		for (uint32_t layer = 0; layer < 6; ++layer) {
+			for (uint32_t level = 0; level < levelCount; ++level) {
+				writer.SetLevel(layer, level, chains[layer].GetData(level), chains[layer].GetSize(level));
+			}
+		}
+	}
+
+	writer.Write(output);
+	PrintCooked(output, size, size, 6, levelCount, start);
+}
+
+static void CookMesh(std::filesystem::path const& path, std::filesystem::path const& output, CookOptions const& options) {
+	auto start = std::chrono::steady_clock::now();
+
+	IndexedMesh mesh {};
+	if (!LoadMeshFromOBJ(path, mesh)) {
+		throw std::runtime_error("Failed to load " + path.string());
+	}
+
+	OptimizeMesh(mesh);
+
+	Meshlets meshlets {};
+	if (options.meshlets) {
+		meshlets = BuildMeshlets(mesh);
+	}
+
+	// The quantized mesh must outlive the writer, which does not copy the vertices
+	QuantizedMesh quantized {};
+	if (options.quantize) {
+		quantized = QuantizeMesh(mesh);
+	}
+
+	MeshContainerWriter writer = options.quantize ? MeshContainerWriter(quantized) : MeshContainerWriter(mesh);
+	writer.SetMeshlets(meshlets);
+	writer.Write(output);
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	double kibibytes = static_cast<double>(std::filesystem::file_size(output)) / 1024.0;
+
+	std::cout << "Cooked " << output.string() << ": " << mesh.vertices.size() << " vertices, "
+		<< mesh.indices.size() / 3 << " triangles, " << meshlets.meshlets.size() << " meshlets, "
+		<< std::fixed << std::setprecision(1) << kibibytes << " KiB in " << std::setprecision(2) << seconds << " s" << std::endl;
+}
+
+// MARK: Main
+static void PrintUsage(char const* program) {
+	std::cout << "Usage: " << program << " [options] [images and meshes...]" << std::endl
+		<< "Cooks images to .gstex texture containers and OBJ meshes to .gsmesh mesh containers." << std::endl
+		<< "Without any file, cooks resources/*.jpg and resources/*.obj." << std::endl
+		<< "Complete sets of faces (stars_px.jpg ... stars_nz.jpg, pos-x.jpg ..., pos_x.jpg ...) become cubemaps." << std::endl
+		<< "\t--output <directory>           where the containers are written, resources by default" << std::endl
+		<< "\t--filter <box|kaiser|lanczos>  filter of the mip levels, kaiser by default" << std::endl
+		<< "\t--linear                       the images are not sRGB" << std::endl
+		<< "\t--compress <bc1|bc3|bc7>       block-compresses the levels, bc1 being opaque" << std::endl
+		<< "\t--no-seams                     does not blend the edges of the cubemap faces" << std::endl
+		<< "\t--quantize                     quantizes the vertices of the meshes to 16 bytes" << std::endl
+		<< "\t--meshlets                     adds meshlets of 64 vertices and 124 triangles to the meshes" << std::endl
+		<< "\t--force                        cooks the containers newer than their images too, needed when the options change" << std::endl
+		<< "\t--cubemap <name> <+x> <-x> <+y> <-y> <+z> <-z>  cooks these faces as a cubemap" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	CookOptions options {};
+	std::vector<std::filesystem::path> paths {};
+	std::vector<CubemapInput> cubemaps {};
+
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (argument == "--output" && hasValue) {
+			options.outputDirectory = argv[++i];
+		}
+
+		else if (argument == "--filter" && hasValue) {
+			std::string filter = argv[++i];
+			if (filter == "box") {
+				options.filter = MipFilter::Box;
+			}
+
+			else if (filter == "kaiser") {
+				options.filter = MipFilter::Kaiser;
+			}
+
+			else if (filter == "lanczos") {
+				options.filter = MipFilter::Lanczos;
+			}
+
+			else {
+				PrintUsage(argv[0]);
+				return 1;
+			}
+		}
+
+		else if (argument == "--compress" && hasValue) {
+			std::string compression = argv[++i];
+			if (compression == "bc1") {
+				options.compression = BlockFormat::BC1;
+			}
+
+			else if (compression == "bc3") {
+				options.compression = BlockFormat::BC3;
+			}
+
+			else if (compression == "bc7") {
+				options.compression = BlockFormat::BC7;
+			}
+
+			else {
+				PrintUsage(argv[0]);
+				return 1;
+			}
+		}
+
+		else if (argument == "--linear") {
+			options.colorSpace = ColorSpace::Linear;
+		}
+
+		else if (argument == "--no-seams") {
+			options.seamAware = false;
+		}
+
+		else if (argument == "--quantize") {
+			options.quantize = true;
+		}
+
+		else if (argument == "--meshlets") {
+			options.meshlets = true;
+		}
+
+		else if (argument == "--force") {
+			options.force = true;
+		}
+
+		else if (argument == "--cubemap" && i + 7 < argc) {
+			CubemapInput cubemap {};
+			cubemap.name = argv[++i];
+			for (std::filesystem::path& face : cubemap.faces) {
+				face = argv[++i];
+			}
+
+			cubemaps.push_back(std::move(cubemap));
+		}
+
+		else if (!argument.starts_with("--")) {
+			paths.push_back(argument);
+		}
+
+		else {
+			PrintUsage(argv[0]);
+			return argument == "--help" ? 0 : 1;
+		}
+	}
+
+	if (paths.empty() && cubemaps.empty()) {
+		if (!std::filesystem::is_directory("resources")) {
+			std::cerr << "No files given and no resources directory, the cook must run from the root of the repository" << std::endl;
+			return 1;
+		}
+
+		for (auto const& entry : std::filesystem::directory_iterator("resources")) {
+			if (entry.is_regular_file() && (entry.path().extension() == ".jpg" || entry.path().extension() == ".obj")) {
+				paths.push_back(entry.path());
+			}
+		}
+
+		std::sort(paths.begin(), paths.end());
+	}
+
+	// Meshes apart from the images
+	std::vector<std::filesystem::path> meshes {};
+	std::copy_if(paths.begin(), paths.end(), std::back_inserter(meshes), [](std::filesystem::path const& path) {
+		return path.extension() == ".obj";
+	});
+	std::erase_if(paths, [](std::filesystem::path const& path) {
+		return path.extension() == ".obj";
+	});
+
+	std::set<std::string> names {};
+	for (CubemapInput const& cubemap : cubemaps) {
+		names.insert(cubemap.name);
+	}
+
+	for (std::filesystem::path const& path : paths) {
+		names.insert(path.stem().string());
+	}
+
+	std::vector<CubemapInput> foundCubemaps = FindCubemaps(paths, names);
+	cubemaps.insert(cubemaps.end(), foundCubemaps.begin(), foundCubemaps.end());
+
+	Utils::ThreadPool threadPool {};
+	unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	bool failed = false;
+
+	try {
+		std::filesystem::create_directories(options.outputDirectory);
+	}
+
+	catch (std::exception const& e) {
+		std::cerr << "Failed to create " << options.outputDirectory.string() << ": " << e.what() << std::endl;
+		return 1;
+	}
+
+	for (CubemapInput const& cubemap : cubemaps) {
+		std::filesystem::path output = options.outputDirectory / (cubemap.name + ".gstex");
+
+		try {
+			if (!options.force && UpToDate(output, { cubemap.faces.begin(), cubemap.faces.end() })) {
+				std::cout << "Skipped " << output.string() << ", up to date" << std::endl;
+				continue;
+			}
+
+			CookCubemap(cubemap, output, options, threadPool);
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to cook " << output.string() << ": " << e.what() << std::endl;
+			failed = true;
+		}
+	}
+
+	for (std::filesystem::path const& path : paths) {
+		std::filesystem::path output = options.outputDirectory / (path.stem().string() + ".gstex");
+
+		try {
+			if (!options.force && UpToDate(output, { path })) {
+				std::cout << "Skipped " << output.string() << ", up to date" << std::endl;
+				continue;
+			}
+
+			CookTexture(path, output, options, threadCount);
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to cook " << output.string() << ": " << e.what() << std::endl;
+			failed = true;
+		}
+	}
+
+	for (std::filesystem::path const& path : meshes) {
+		std::filesystem::path output = options.outputDirectory / (path.stem().string() + ".gsmesh");
+
+		try {
+			if (!options.force && UpToDate(output, { path })) {
+				std::cout << "Skipped " << output.string() << ", up to date" << std::endl;
+				continue;
+			}
+
+			CookMesh(path, output, options);
+		}
+
+		catch (std::exception const& e) {
+			std::cerr << "Failed to cook " << output.string() << ": " << e.what() << std::endl;
+			failed = true;
+		}
+	}
+
+	return failed ? 1 : 0;
+}
@@ -32,11 +32,19 @@ package_end()
 
 set_languages("cxx20")
 
+option("scalar_math")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Use the portable scalar backend instead of SSE/NEON in Math")
+    add_defines("MATH_SIMD_SCALAR")
+option_end()
+
 -- add_requireconfs("**", { system = false }) -- forces to install packages even if they are in the system installed packages
 
 add_requires("libsdl3", { configs = { wayland = true, x11 = true, shared = true } })
 
 add_requires("wgpu-native-cpp", "tinyobjloader", "stb")
+add_requires("snitch")
 
 add_requires("sdl3webgpu", { configs = { shared = true, debug = true } })
 add_requireconfs("sdl3webgpu.libsdl3", { configs = { wayland = true, x11 = true, shared = true } })
@@ -52,6 +60,7 @@ target("wgpu-test")
 
     if is_plat("linux") then
         add_cxxflags("-pedantic", "-pedantic-errors")
+        add_syslinks("pthread")
 
         if is_mode("debug") then
             set_optimize("none")
@@ -70,10 +79,12 @@ target("wgpu-test")
     add_packages("wgpu-native", "libsdl3", "sdl3webgpu") 
     add_packages("wgpu-native-cpp", "tinyobjloader", "stb")
     add_packages("imgui")
+    add_options("scalar_math")
 
     add_files("src/*.cpp")
     add_files("src/Math/*.cpp")
     add_files("src/Helper/*.cpp")
+    add_files("src/Resources/Buffer/*.cpp")
     add_files("src/Resources/Geometry/*.cpp")
     add_files("src/Resources/Texture/*.cpp")
     add_files("src/Utils/*.cpp")
@@ -81,6 +92,7 @@ target("wgpu-test")
     add_headerfiles("inc/*.hpp")
     add_headerfiles("inc/Math/*.hpp")
     add_headerfiles("inc/Helper/*.hpp")
+    add_headerfiles("inc/Resources/Buffer/*.hpp")
     add_headerfiles("inc/Resources/Geometry/*.hpp")
     add_headerfiles("inc/Resources/Texture/*.hpp")
     add_headerfiles("inc/Utils/*.hpp")
@@ -92,3 +104,97 @@ target("wgpu-test")
     set_rundir("./")
     add_installfiles("resources/**")
 target_end()
+
+target("tests")
+    set_kind("binary")
+    set_default(false)
+
+    add_packages("snitch")
+    add_options("scalar_math")
+
+    add_files("tests/*.cpp")
+    add_files("src/Math/*.cpp")
+    add_files("src/Resources/Buffer/StagingRing.cpp")
+    add_files("src/Resources/Buffer/UniformAllocator.cpp")
+    add_files("src/Resources/Geometry/GeometryParser.cpp")
+    add_files("src/Resources/Geometry/Mesh.cpp")
+    add_files("src/Resources/Geometry/MeshOptimizer.cpp")
+    add_files("src/Resources/Geometry/VertexQuantization.cpp")
+    add_files("src/Resources/Geometry/MeshContainer.cpp")
+    add_files("src/Resources/Texture/MipMaps.cpp")
+    add_files("src/Resources/Texture/MipResidency.cpp")
+    add_files("src/Resources/Texture/TextureContainer.cpp")
+    add_files("src/Resources/Texture/BlockCompression.cpp")
+    add_files("src/Utils/MappedFile.cpp")
+    add_files("src/Utils/ThreadPool.cpp")
+
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+    add_includedirs("inc")
+
+    add_tests("default")
+target_end()
+
+target("bench")
+    set_kind("binary")
+    set_default(false)
+
+    add_packages("tinyobjloader", "stb")
+    add_options("scalar_math")
+
+    add_files("bench/*.cpp")
+    add_files("src/Math/*.cpp")
+    add_files("src/Resources/Geometry/GeometryLoader.cpp")
+    add_files("src/Resources/Geometry/GeometryParser.cpp")
+    add_files("src/Resources/Geometry/Mesh.cpp")
+    add_files("src/Resources/Geometry/MeshOptimizer.cpp")
+    add_files("src/Resources/Geometry/VertexQuantization.cpp")
+    add_files("src/Resources/Geometry/MeshContainer.cpp")
+    add_files("src/Resources/Texture/Image.cpp")
+    add_files("src/Resources/Texture/MipMaps.cpp")
+    add_files("src/Resources/Texture/TextureContainer.cpp")
+    add_files("src/Resources/Texture/BlockCompression.cpp")
+    add_files("src/Utils/MappedFile.cpp")
+    add_files("src/Utils/ThreadPool.cpp")
+
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+    add_includedirs("inc", "bench")
+
+    set_rundir("./")
+target_end()
+
+target("cook")
+    set_kind("binary")
+    set_default(false)
+
+    add_packages("tinyobjloader", "stb")
+    add_options("scalar_math")
+
+    add_files("tools/Cook.cpp")
+    add_files("src/Math/*.cpp")
+    add_files("src/Resources/Geometry/GeometryLoader.cpp")
+    add_files("src/Resources/Geometry/GeometryParser.cpp")
+    add_files("src/Resources/Geometry/Mesh.cpp")
+    add_files("src/Resources/Geometry/MeshOptimizer.cpp")
+    add_files("src/Resources/Geometry/VertexQuantization.cpp")
+    add_files("src/Resources/Geometry/MeshContainer.cpp")
+    add_files("src/Resources/Texture/Image.cpp")
+    add_files("src/Resources/Texture/MipMaps.cpp")
+    add_files("src/Resources/Texture/TextureContainer.cpp")
+    add_files("src/Resources/Texture/BlockCompression.cpp")
+    add_files("src/Utils/MappedFile.cpp")
+    add_files("src/Utils/ThreadPool.cpp")
+
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+    add_includedirs("inc")
+
+    set_rundir("./")
+target_end()